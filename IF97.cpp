@@ -6,7 +6,8 @@
 // This compiler flag causes the Region 3 v(p,T) function to be iterated to improve
 // accuracy.  If not defined, the Region 3 v(p,T) function will return the direct
 // value from the supplementary release IAPWS SR5-05(2016), which may be in error
-// by up to 1E-6 of the iterative solution in Region 3.
+// by up to 1E-6 of the iterative solution in Region 3.  The method can also be changed
+// at run time with set_region3_solver().
 #define REGION3_ITERATE
 
 #include "IF97.h"
@@ -14,6 +15,345 @@
 #include <stdio.h>
 #include <iomanip>
 #include <chrono>
+#include <cstring>
+
+// Sums every derivative in a bundle, so a timed loop keeps all of the sums it evaluates.
+static double bundle_sum(const IF97::GibbsDerivatives &d) {
+    return d.gammar + d.dgammar_dPI + d.d2gammar_dPI2 + d.dgammar_dTAU + d.d2gammar_dTAU2 + d.d2gammar_dPIdTAU
+         + d.gamma0 + d.dgamma0_dTAU + d.d2gamma0_dTAU2;
+}
+static double bundle_sum(const IF97::HelmholtzDerivatives &d) {
+    return d.phi + d.delta_dphi_ddelta + d.delta2_d2phi_ddelta2 + d.tau_dphi_dtau + d.tau2_d2phi_dtau2 + d.deltatau_d2phi_ddelta_dtau;
+}
+static double bundle_sum(double v) { return v; }
+
+// Times 1M calls of (R.*f)(x, y) over a 1000 x 1000 grid on [x0,x1] x [y0,y1] and returns the best of
+// three passes in ms, so that one disturbed pass does not decide a comparison.  The sum of all results
+// of a pass is returned in chk.
+template <class RegionT, class Result>
+static double time_sweep(const RegionT &R, Result (RegionT::*f)(double, double) const,
+                         double x0, double x1, double y0, double y1, double &chk) {
+    double best = 0;
+    for (int pass = 0; pass < 3; pass++) {
+        double sum = 0;
+        std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < 1000000; i++) sum += bundle_sum((R.*f)(x0 + (x1 - x0) * (i % 1000) / 1000, y0 + (y1 - y0) * (i / 1000) / 1000));
+        const double ms = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+        if (pass == 0 || ms < best) best = ms;
+        chk = sum;
+    }
+    return best;
+}
+
+// Prints one line of the powi() vs. power ladder timing table.  MISMATCH flags sums that differ by more
+// than rounding, SLOWER a table the library evaluates through ladders that lost to powi().  Tables below
+// IF97::LADDER_MIN_TERMS are evaluated with powi() and are only marked as such.
+static void ladder_report(const char *name, std::size_t terms, double ms_powi, double ms_ladder, double chk_powi, double chk_ladder) {
+    printf("  %s (%2d terms):  powi %7.2f ms   ladder %7.2f ms   speedup %4.2fx  %s%s\n", name, (int)terms, ms_powi, ms_ladder,
+           ms_powi / ms_ladder, (std::abs(chk_powi - chk_ladder) <= 1e-12 * std::abs(chk_powi)) ? "" : "MISMATCH ",
+           (terms < IF97::LADDER_MIN_TERMS) ? "(powi kept)" : (ms_ladder <= ms_powi) ? "" : "SLOWER");
+}
+
+// Backward T(p,X) sum evaluated term by term with std::pow, as Backwards::BackwardsRegion::T_pX did.
+static double tpx_pow(const IF97::Backwards::BackwardRegionResidualElement *d, std::size_t N, double x, double y, double f) {
+    double summer = 0;
+    for (std::size_t i = 0; i < N; ++i)
+        summer += d[i].n * std::pow(x, d[i].I) * std::pow(y, d[i].J) * std::pow(f, d[i].J);
+    return summer;
+}
+
+static volatile double horner_sink;
+
+// Checks the Horner and term-by-term Gibbs evaluators of a Region 1/2/5 object against a long double
+// reference of its six residual sums over a (T,p) grid that lies inside the region.  Errors are counted
+// in units of DBL_EPSILON times the sum of the absolute terms, the scale on which any summation order
+// rounds, so that cancellation in a sum (or an ill-conditioned property built from it) does not hide or
+// fake a difference.  Returns the largest error of derivs_horner(), that of derivs_termwise() in
+// ulp_termwise, and times 1M calls of each.
+static double horner_check(const IF97::BaseRegion &R, const RegionResidualElement *t, std::size_t N,
+                           double T0, double T1, double p0, double p1,
+                           double &ulp_termwise, double &ms_termwise, double &ms_horner) {
+    typedef IF97::GibbsDerivatives (IF97::BaseRegion::*GibbsSweep)(double, double) const;
+    const GibbsSweep f_termwise = &IF97::BaseRegion::derivs_termwise, f_horner = &IF97::BaseRegion::derivs_horner;
+    double ulp_horner = 0;
+    ulp_termwise = 0;
+    for (int i = 0; i <= 100; i++) {
+        for (int j = 0; j <= 100; j++) {
+            const double T = T0 + (T1 - T0) * i / 100, p = p0 + (p1 - p0) * j / 100;
+            const long double x = R.PIrterm(p), y = R.TAUrterm(T);
+            long double ref[6] = {0, 0, 0, 0, 0, 0}, scale[6] = {0, 0, 0, 0, 0, 0};
+            for (std::size_t k = 0; k < N; k++) {
+                const int I = t[k].I, J = t[k].J;
+                const long double n = t[k].n;
+                const long double term[6] = {n * std::pow(x, I) * std::pow(y, J), n * I * std::pow(x, I - 1) * std::pow(y, J),
+                                             n * I * (I - 1) * std::pow(x, I - 2) * std::pow(y, J), n * J * std::pow(x, I) * std::pow(y, J - 1),
+                                             n * J * (J - 1) * std::pow(x, I) * std::pow(y, J - 2), n * I * J * std::pow(x, I - 1) * std::pow(y, J - 1)};
+                for (int m = 0; m < 6; m++) { ref[m] += term[m]; scale[m] += std::abs(term[m]); }
+            }
+            const IF97::GibbsDerivatives a = R.derivs_termwise(T, p), b = R.derivs_horner(T, p);
+            const double sa[] = {a.gammar, a.dgammar_dPI, a.d2gammar_dPI2, a.dgammar_dTAU, a.d2gammar_dTAU2, a.d2gammar_dPIdTAU};
+            const double sb[] = {b.gammar, b.dgammar_dPI, b.d2gammar_dPI2, b.dgammar_dTAU, b.d2gammar_dTAU2, b.d2gammar_dPIdTAU};
+            for (int m = 0; m < 6; m++) {
+                if (scale[m] == 0) continue;
+                const long double ulp = scale[m] * std::numeric_limits<double>::epsilon();
+                ulp_termwise = std::max(ulp_termwise, (double)(std::abs(sa[m] - ref[m]) / ulp));
+                ulp_horner = std::max(ulp_horner, (double)(std::abs(sb[m] - ref[m]) / ulp));
+            }
+        }
+    }
+    double chk;
+    ms_termwise = time_sweep(R, f_termwise, T0, T1, p0, p1, chk);
+    ms_horner = time_sweep(R, f_horner, T0, T1, p0, p1, chk);
+    horner_sink = chk;
+    return ulp_horner;
+}
+
+// Compares the single-sweep Region 3 derivs() bundle against the separate phi-derivative functions
+// over a (T,rho) grid around the critical point.
+// Returns the largest absolute difference seen in the six reduced sums, and times 1M evaluations of
+// all six quantities each way.
+static double bundle_check(const IF97::Region3 &R, double &ms_separate, double &ms_bundle) {
+    double maxdiff = 0;
+    for (int i = 0; i <= 100; i++) {
+        for (int j = 0; j <= 100; j++) {
+            const double T = 623.15 + 150.0 * i / 100, rho = 150.0 + 450.0 * j / 100;
+            const IF97::HelmholtzDerivatives d = R.derivs(T, rho);
+            const double pa[] = {R.phi(T, rho), R.delta_dphi_ddelta(T, rho), R.delta2_d2phi_ddelta2(T, rho),
+                                 R.tau_dphi_dtau(T, rho), R.tau2_d2phi_dtau2(T, rho), R.deltatau_d2phi_ddelta_dtau(T, rho)};
+            const double pb[] = {d.phi, d.delta_dphi_ddelta, d.delta2_d2phi_ddelta2,
+                                 d.tau_dphi_dtau, d.tau2_d2phi_dtau2, d.deltatau_d2phi_ddelta_dtau};
+            for (int k = 0; k < 6; k++) maxdiff = std::max(maxdiff, std::abs(pa[k] - pb[k]));
+        }
+    }
+    double chk = 0;
+    std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < 1000000; i++) {
+        const double T = 623.15 + 150.0 * (i % 1000) / 1000, rho = 150.0 + 450.0 * (i / 1000) / 1000;
+        chk += R.phi(T, rho) + R.delta_dphi_ddelta(T, rho) + R.delta2_d2phi_ddelta2(T, rho)
+             + R.tau_dphi_dtau(T, rho) + R.tau2_d2phi_dtau2(T, rho) + R.deltatau_d2phi_ddelta_dtau(T, rho);
+    }
+    ms_separate = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < 1000000; i++) {
+        const IF97::HelmholtzDerivatives d = R.derivs(623.15 + 150.0 * (i % 1000) / 1000, 150.0 + 450.0 * (i / 1000) / 1000);
+        chk -= d.phi + d.delta_dphi_ddelta + d.delta2_d2phi_ddelta2 + d.tau_dphi_dtau + d.tau2_d2phi_dtau2 + d.deltatau_d2phi_ddelta_dtau;
+    }
+    ms_bundle = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+    horner_sink = chk;
+    return maxdiff;
+}
+
+#ifdef IF97_KERNELS
+// Region objects with their generated kernels cleared, so that a build with IF97_KERNELS can still
+// evaluate the table-walking sums the kernels replace and compare the two.
+struct Region1Tables : IF97::Region1 { Region1Tables() { resid_kernel = 0; ideal_kernel = 0; } };
+struct Region2Tables : IF97::Region2 { Region2Tables() { resid_kernel = 0; ideal_kernel = 0; } };
+struct Region5Tables : IF97::Region5 { Region5Tables() { resid_kernel = 0; ideal_kernel = 0; } };
+struct Region3Tables : IF97::Region3 {
+    Region3Tables() {
+        for (int k = 0; k < IF97::kernels::R3_PARTS; k++) phi_kernel[k] = 0;
+        derivs_kernel = 0;
+        ddelta_kernel = 0;
+    }
+};
+template <class Backward> struct BackwardTables : Backward { BackwardTables() { this->kernel = 0; } };
+
+static bool same_bits(double a, double b) { return std::memcmp(&a, &b, sizeof(double)) == 0; }
+
+// Counts the points of a 200 x 200 (T,p) grid at which any value of the Gibbs bundle of K (kernels)
+// differs in any bit from that of R (table-walking sums).
+static int kernel_mismatch(const IF97::BaseRegion &K, const IF97::BaseRegion &R, double T0, double T1, double p0, double p1) {
+    int bad = 0;
+    for (int i = 0; i < 200; i++) {
+        for (int j = 0; j < 200; j++) {
+            const double T = T0 + (T1 - T0) * i / 199, p = p0 + (p1 - p0) * j / 199;
+            const IF97::GibbsDerivatives a = K.derivs(T, p), b = R.derivs(T, p);
+            const double va[] = {a.gammar, a.dgammar_dPI, a.d2gammar_dPI2, a.dgammar_dTAU, a.d2gammar_dTAU2, a.d2gammar_dPIdTAU,
+                                 a.gamma0, a.dgamma0_dPI, a.d2gamma0_dPI2, a.dgamma0_dTAU, a.d2gamma0_dTAU2};
+            const double vb[] = {b.gammar, b.dgammar_dPI, b.d2gammar_dPI2, b.dgammar_dTAU, b.d2gammar_dTAU2, b.d2gammar_dPIdTAU,
+                                 b.gamma0, b.dgamma0_dPI, b.d2gamma0_dPI2, b.dgamma0_dTAU, b.d2gamma0_dTAU2};
+            for (int m = 0; m < 11; m++) if (!same_bits(va[m], vb[m])) { bad++; break; }
+        }
+    }
+    return bad;
+}
+
+// As above for the Region 3 derivs() bundle, the eight phi sums and ddelta_derivs(), over a (T,rho) grid.
+static int kernel_mismatch(const IF97::Region3 &K, const IF97::Region3 &R, double T0, double T1, double rho0, double rho1) {
+    typedef double (IF97::Region3::*PhiSum)(double, double) const;
+    const PhiSum sums[] = {&IF97::Region3::phi, &IF97::Region3::dphi_ddelta, &IF97::Region3::d2phi_ddelta2,
+                           &IF97::Region3::delta_dphi_ddelta, &IF97::Region3::tau_dphi_dtau, &IF97::Region3::delta2_d2phi_ddelta2,
+                           &IF97::Region3::tau2_d2phi_dtau2, &IF97::Region3::deltatau_d2phi_ddelta_dtau};
+    int bad = 0;
+    for (int i = 0; i < 200; i++) {
+        for (int j = 0; j < 200; j++) {
+            const double T = T0 + (T1 - T0) * i / 199, rho = rho0 + (rho1 - rho0) * j / 199;
+            const IF97::HelmholtzDerivatives a = K.derivs(T, rho), b = R.derivs(T, rho);
+            double va[17] = {a.phi, a.delta_dphi_ddelta, a.delta2_d2phi_ddelta2, a.tau_dphi_dtau, a.tau2_d2phi_dtau2,
+                             a.deltatau_d2phi_ddelta_dtau};
+            double vb[17] = {b.phi, b.delta_dphi_ddelta, b.delta2_d2phi_ddelta2, b.tau_dphi_dtau, b.tau2_d2phi_dtau2,
+                             b.deltatau_d2phi_ddelta_dtau};
+            for (int k = 0; k < 8; k++) { va[6 + k] = (K.*sums[k])(T, rho); vb[6 + k] = (R.*sums[k])(T, rho); }
+            K.ddelta_derivs(T, rho, va + 14);
+            R.ddelta_derivs(T, rho, vb + 14);
+            for (int m = 0; m < 17; m++) if (!same_bits(va[m], vb[m])) { bad++; break; }
+        }
+    }
+    return bad;
+}
+
+// As above for the backward v(T,p) of one Region 3 subregion, over a (T,p) box where its roots are real.
+template <class Subregion>
+static int kernel_mismatch_v(double T0, double T1, double p0, double p1) {
+    const Subregion K;
+    const BackwardTables<Subregion> R;
+    int bad = 0;
+    for (int i = 0; i < 200; i++)
+        for (int j = 0; j < 200; j++) {
+            const double T = T0 + (T1 - T0) * i / 199, p = p0 + (p1 - p0) * j / 199;
+            if (!same_bits(K.v(T, p), R.v(T, p))) bad++;
+        }
+    return bad;
+}
+
+// Largest relative difference between f(x, y) of the kernel object K and the table object R over a
+// 200 x 200 grid, for the backward equations, whose table-walking sums use std::pow().
+template <class Backward>
+static double kernel_diff(double (IF97::Backwards::BackwardsRegion::*f)(double, double) const,
+                          double x0, double x1, double y0, double y1) {
+    const Backward K;
+    const BackwardTables<Backward> R;
+    double maxdiff = 0;
+    for (int i = 0; i < 200; i++)
+        for (int j = 0; j < 200; j++) {
+            const double x = x0 + (x1 - x0) * i / 199, y = y0 + (y1 - y0) * j / 199;
+            const double a = (K.*f)(x, y), b = (R.*f)(x, y);
+            maxdiff = std::max(maxdiff, std::abs(a - b) / std::abs(b));
+        }
+    return maxdiff;
+}
+
+static double prop_call(const IF97::BaseRegion &R, IF97parameters key, double T, double p) { return R.output(key, T, p); }
+static double prop_call(const IF97::Region3 &R, IF97parameters key, double T, double p) { return R.output(key, T, p, NONE); }
+
+// Times rho, h, cp and w at every point of (T,p) through R.output(), best of three passes, and
+// returns the sum of the values in chk.
+template <class RegionT>
+static double time_props(const RegionT &R, const std::vector<double> &T, const std::vector<double> &p, double &chk) {
+    const IF97parameters keys[] = {IF97_DMASS, IF97_HMASS, IF97_CPMASS, IF97_W};
+    double best = 0;
+    for (int pass = 0; pass < 3; pass++) {
+        double sum = 0;
+        std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+        for (std::size_t i = 0; i < T.size(); i++)
+            for (int k = 0; k < 4; k++) sum += prop_call(R, keys[k], T[i], p[i]);
+        const double ms = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+        if (pass == 0 || ms < best) best = ms;
+        chk = sum;
+    }
+    return best;
+}
+#endif
+
+// Compares the lane-parallel BaseRegion::output(key, T[], p[], n, out[], level) of a Region 1/2/5 object
+// with the scalar output(key, T, p) over a (T,p) grid inside the region.
+// Returns the largest relative difference seen in rho, h, s, cp and w, and times the enthalpy of 1M
+// points each way.
+template <class RegionT>
+static double simd_check(const RegionT &R, double T0, double T1, double p0, double p1, IF97::IF97SIMD level,
+                         double &ms_scalar, double &ms_simd) {
+    const IF97parameters keys[] = {IF97_DMASS, IF97_HMASS, IF97_SMASS, IF97_CPMASS, IF97_W};
+    const std::size_t n = 1000000;
+    std::vector<double> T(n), p(n), out(n);
+    for (std::size_t i = 0; i < n; i++) {
+        T[i] = T0 + (T1 - T0) * (i % 1000) / 1000;
+        p[i] = p0 + (p1 - p0) * (i / 1000) / 1000;
+    }
+    double maxdiff = 0;
+    for (int k = 0; k < 5; k++) {
+        R.output(keys[k], &T[0], &p[0], 20011, &out[0], level);          // odd count exercises the scalar tail
+        for (std::size_t i = 0; i < 20011; i++) {
+            const double ref = R.output(keys[k], T[i], p[i]);
+            if (std::abs(ref) > 1e-3) maxdiff = std::max(maxdiff, std::abs(out[i] - ref) / std::abs(ref));
+        }
+    }
+    double chk = 0;
+    std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+    for (std::size_t i = 0; i < n; i++) chk += R.output(IF97_HMASS, T[i], p[i]);
+    ms_scalar = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+    start = std::chrono::high_resolution_clock::now();
+    R.output(IF97_HMASS, &T[0], &p[0], n, &out[0], level);
+    ms_simd = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+    for (std::size_t i = 0; i < n; i++) chk -= out[i];
+    horner_sink = chk;
+    return maxdiff;
+}
+
+// Region 3 subregion of (T,p) from the dividing lines, written out as nested if/else tests in the
+// form of [IAPWS SR5-05(2016)] Tables 2 and 10, as the library classified points before the pressure
+// band table Region3Backwards::Region3bands.  Kept only as an independent reference for that table.
+static char region3_subregion_reference(double T, double p) {
+    using namespace IF97::Region3Backwards;
+    const double pf = IF97::p_fact;
+    if (p > 40 * pf)
+        return (T <= DividingLine(LINE_AB, p)) ? 'A' : 'B';
+    if (p > 25 * pf) {
+        if (T <= DividingLine(LINE_CD, p)) return 'C';
+        if (T <= DividingLine(LINE_AB, p)) return 'D';
+        if (T <= DividingLine(LINE_EF, p)) return 'E';
+        return 'F';
+    }
+    if (p > 22.5 * pf) {
+        if (T <= DividingLine(LINE_CD, p)) return 'C';
+        if (p > 23.5 * pf && T <= DividingLine(LINE_GH, p)) return 'G';
+        if (T <= DividingLine(LINE_GH, p)) return 'L';
+        if (p > 23 * pf) {
+            if (T <= DividingLine(LINE_EF, p)) return 'H';
+            if (T <= DividingLine(LINE_IJ, p)) return 'I';
+        }
+        else {
+            if (T <= DividingLine(LINE_MN, p)) return 'M';
+            if (T <= DividingLine(LINE_EF, p)) return 'N';
+            if (T <= DividingLine(LINE_OP, p)) return 'O';
+            if (T <= DividingLine(LINE_IJ, p)) return 'P';
+        }
+        if (T <= DividingLine(LINE_JK, p)) return 'J';
+        return 'K';
+    }
+    if (p > 21.04336732 * pf) {
+        if (T <= DividingLine(LINE_CD, p)) return 'C';
+        if (T <= DividingLine(LINE_QU, p)) return 'Q';
+        if (T > DividingLine(LINE_JK, p)) return 'K';
+        if (T > DividingLine(LINE_RX, p)) return 'R';
+        if (p > 22.064 * pf) {                                      // Supercritical
+            const bool near = (p <= 22.11 * pf);
+            if (T <= DividingLine(LINE_UV, p)) return 'U';
+            if (T <= DividingLine(LINE_EF, p)) return near ? 'Y' : 'V';
+            if (T <= DividingLine(LINE_WX, p)) return near ? 'Z' : 'W';
+            return 'X';
+        }
+        if (T <= IF97::Tsat97(p)) {                                 // Sub-critical liquid side
+            if (p > 21.93161551 * pf && T > DividingLine(LINE_UV, p)) return 'Y';
+            return 'U';
+        }
+        if (p > 21.90096265 * pf && T <= DividingLine(LINE_WX, p)) return 'Z';   // Sub-critical vapor side
+        return 'X';
+    }
+    if (p > 20.5 * pf) {
+        if (T <= DividingLine(LINE_CD, p)) return 'C';
+        if (T <= IF97::Tsat97(p)) return 'S';
+        if (T <= DividingLine(LINE_JK, p)) return 'R';
+        return 'K';
+    }
+    if (p > 19.00881189173929 * pf) {
+        if (T <= DividingLine(LINE_CD, p)) return 'C';
+        if (T <= IF97::Tsat97(p)) return 'S';
+        return 'T';
+    }
+    if (p > 16.529164252604481 * pf)
+        return (T <= IF97::Tsat97(p)) ? 'C' : 'T';
+    return '?';
+}
 
 int main() {
 
@@ -159,9 +499,10 @@ int main() {
     cout << "        using the IF97 iterative solution in region 3, the error is actually the distance from these initial guess\n";
     cout << "        values to the more accurate iterative solution, not the actual error in the formulation.  See NOTE 3 below.\n";
     cout << "        To see the actual error in this explicit equation, undefine the REGION3_ITERATE flag at the top of this \n";
-    cout << "        file to turn off the iterative solution and provide just the explicit results from v(p,T).  Doing so will\n";
-    cout << "        increase the error in the previous verification table to the order of 1E-6 for points in region 3, but\n";
-    cout << "        drop the relative error in this table to on the order of 1E-10.\n\n";
+    cout << "        file, or call set_region3_solver(R3_DIRECT), to turn off the iterative solution and provide just the\n";
+    cout << "        explicit results from v(p,T).  Doing so will increase the error in the previous verification table to\n";
+    cout << "        the order of 1E-6 for points in region 3, but drop the relative error in this table to on the order\n";
+    cout << "        of 1E-10.\n\n";
     cout << "NOTE 4: IAPWS-IF97 is covered by a basic equation for the Helmholtz free energy, f(v,T).  In some steam\n";
     cout << "        power cycles, thermodynamic properties as a function of (p,T) are required in region 3.  This\n";
     cout << "        requires iteration of the Helmhotz equation to find v from p and T.  To avoid this iterative\n";
@@ -235,6 +576,967 @@ int main() {
     dif = duration_cast<duration<double>>(end - start) * 1000.0;  // time in ms
     printf("  Timing (100k psat calls): %5g ms\n",dif.count());
     printf("_______________________________________________________________________\n\n\n\n");
+    //
+    //  Timing test for the region polynomial sums, powi() per term vs. PowerLadder tables, through the
+    //  library's own evaluators: derivs_termwise() against derivs_powi() for Regions 1, 2 and 5 (all
+    //  six Gibbs sums plus the ideal-gas part), Region3::derivs() against Region3::derivs_powi(), and
+    //  the Region 3 backward v(T,p) of a few subregions against v_powi().
+    //
+    printf("_______________________________________________________________________\n");
+    printf("   Timing Test for powi() vs. power ladder region sums (1M calls)\n");
+    printf("_______________________________________________________________________\n");
+    {
+        typedef GibbsDerivatives (BaseRegion::*GibbsSweep)(double, double) const;
+        struct { const char *name; const BaseRegion *R; std::size_t terms; double T0, T1, p0, p1; } gibbs[] = {
+            {"Region 1  ", &Regions::R1, 34, 273.15, 623.15, 16.6, 100},
+            {"Region 2  ", &Regions::R2, 43, 623.15, 1073.15, 0.001, 16.5},
+            {"Region 5  ", &Regions::R5, 6, 1073.15, 2273.15, 0.001, 50},
+        };
+        double chk_powi, chk_ladder, ms_powi, ms_ladder;
+        for (std::size_t k = 0; k < sizeof(gibbs) / sizeof(gibbs[0]); k++) {
+            const GibbsSweep f_powi = &BaseRegion::derivs_powi, f_ladder = &BaseRegion::derivs_termwise;
+            ms_powi = time_sweep(*gibbs[k].R, f_powi, gibbs[k].T0, gibbs[k].T1, gibbs[k].p0, gibbs[k].p1, chk_powi);
+            ms_ladder = time_sweep(*gibbs[k].R, f_ladder, gibbs[k].T0, gibbs[k].T1, gibbs[k].p0, gibbs[k].p1, chk_ladder);
+            ladder_report(gibbs[k].name, gibbs[k].terms, ms_powi, ms_ladder, chk_powi, chk_ladder);
+        }
+        typedef HelmholtzDerivatives (Region3::*HelmholtzSweep)(double, double) const;
+        const HelmholtzSweep h_powi = &Region3::derivs_powi, h_ladder = &Region3::derivs;
+        ms_powi = time_sweep(Regions::R3, h_powi, 623.15, 773.15, 150, 600, chk_powi);
+        ms_ladder = time_sweep(Regions::R3, h_ladder, 623.15, 773.15, 150, 600, chk_ladder);
+        ladder_report("Region 3  ", 39, ms_powi, ms_ladder, chk_powi, chk_ladder);
+        // Backward v(T,p) over (T,p) boxes where each subregion's roots are real
+        static constexpr Region3Backwards::Region3a R3a{};
+        static constexpr Region3Backwards::Region3f R3f{};
+        static constexpr Region3Backwards::Region3m R3m{};
+        static constexpr Region3Backwards::Region3o R3o{};
+        ms_powi = time_sweep<Region3Backwards::Region3a, double>(R3a, &Region3Backwards::Region3a::v_powi, 630, 650, 40, 100, chk_powi);
+        ms_ladder = time_sweep<Region3Backwards::Region3a, double>(R3a, &Region3Backwards::Region3a::v, 630, 650, 40, 100, chk_ladder);
+        ladder_report("Region 3a ", 30, ms_powi, ms_ladder, chk_powi, chk_ladder);
+        ms_powi = time_sweep<Region3Backwards::Region3f, double>(R3f, &Region3Backwards::Region3f::v_powi, 700, 730, 24, 40, chk_powi);
+        ms_ladder = time_sweep<Region3Backwards::Region3f, double>(R3f, &Region3Backwards::Region3f::v, 700, 730, 24, 40, chk_ladder);
+        ladder_report("Region 3f ", 42, ms_powi, ms_ladder, chk_powi, chk_ladder);
+        ms_powi = time_sweep<Region3Backwards::Region3m, double>(R3m, &Region3Backwards::Region3m::v_powi, 648.5, 652, 22.5, 23.3, chk_powi);
+        ms_ladder = time_sweep<Region3Backwards::Region3m, double>(R3m, &Region3Backwards::Region3m::v, 648.5, 652, 22.5, 23.3, chk_ladder);
+        ladder_report("Region 3m ", 40, ms_powi, ms_ladder, chk_powi, chk_ladder);
+        ms_powi = time_sweep<Region3Backwards::Region3o, double>(R3o, &Region3Backwards::Region3o::v_powi, 640, 646, 22.5, 23, chk_powi);
+        ms_ladder = time_sweep<Region3Backwards::Region3o, double>(R3o, &Region3Backwards::Region3o::v, 640, 646, 22.5, 23, chk_ladder);
+        ladder_report("Region 3o ", 24, ms_powi, ms_ladder, chk_powi, chk_ladder);
+    }
+    printf("_______________________________________________________________________\n\n\n\n");
+    //
+    //  Backward T(p,h) and T(p,s) sums, std::pow per term vs. the integer-exponent ladders of
+    //  Backwards::BackwardsRegion.  Region 2a T(p,s) keeps std::pow for its fractional I exponents,
+    //  taken once per distinct I.
+    //
+    printf("_______________________________________________________________________\n");
+    printf("   Timing Test for std::pow vs. ladder backward T(p,X) sums (1M calls)\n");
+    printf("_______________________________________________________________________\n");
+    struct { const char *name; const Backwards::BackwardRegionResidualElement *data; std::size_t N;
+             const Backwards::BackwardsRegion *R; double p_star, X_star, T_star, a, b, f, p0, p1, X0, X1; } bsums[] = {
+        {"T(p,h) 1 ", Backwards::Coeff1H,  20, &Regions::B1H,  1,   2500, 1,   0,     1,    1, 1,    100, 500,  1500},
+        {"T(p,h) 2a", Backwards::Coeff2aH, 34, &Regions::B2aH, 1,   2000, 1,   0,    -2.1,  1, 0.01, 4,   2800, 3500},
+        {"T(p,h) 3a", Backwards::Coeff3aH, 31, &Regions::B3aH, 100, 2300, 760, 0.240, -0.615, 1, 25,  100, 1500, 2000},
+        {"T(p,s) 2a", Backwards::Coeff2aS, 46, &Regions::B2aS, 1,   2,    1,   0,    -2,   1, 0.01, 4,   7,    9},
+        {"T(p,s) 2b", Backwards::Coeff2bS, 44, &Regions::B2bS, 1,   0.7853, 1, 0,   -10,  -1, 5,    60,  6,    7},
+    };
+    const int nsum = 1000000;
+    for (std::size_t k = 0; k < sizeof(bsums) / sizeof(bsums[0]); k++) {
+        const double dp = (bsums[k].p1 - bsums[k].p0) / 1000, dX = (bsums[k].X1 - bsums[k].X0) / 1000;
+        double chk_pow = 0, chk_ladder = 0;
+        start = high_resolution_clock::now();
+        for (int i = 0; i < nsum; i++) {
+            const double p = bsums[k].p0 + (i % 1000) * dp, X = bsums[k].X0 + (i / 1000) * dX;
+            chk_pow += tpx_pow(bsums[k].data, bsums[k].N, p / bsums[k].p_star + bsums[k].a, X / bsums[k].X_star + bsums[k].b,
+                               bsums[k].f) * bsums[k].T_star;
+        }
+        end = high_resolution_clock::now();
+        duration<double> tpow = duration_cast<duration<double>>(end - start) * 1000.0;
+        start = high_resolution_clock::now();
+        for (int i = 0; i < nsum; i++)
+            chk_ladder += bsums[k].R->T_pX(bsums[k].p0 + (i % 1000) * dp, bsums[k].X0 + (i / 1000) * dX);
+        end = high_resolution_clock::now();
+        duration<double> tladder = duration_cast<duration<double>>(end - start) * 1000.0;
+        printf("  %s (%2d terms):  pow %7.2f ms   ladder %7.2f ms   speedup %4.2fx  %s\n", bsums[k].name, (int)bsums[k].N,
+               tpow.count(), tladder.count(), tpow.count() / tladder.count(),
+               (abs(chk_pow - chk_ladder) <= 1e-12 * abs(chk_pow)) ? "" : "MISMATCH");
+    }
+    printf("_______________________________________________________________________\n\n\n\n");
+    //
+    //  Horner vs. term-by-term evaluation of the Region 1, 2 and 5 Gibbs sums.  derivs() uses
+    //  the Horner form only when IF97_HORNER is defined, and then only for Regions 1 and 2; all
+    //  three are checked here either way.
+    //
+    printf("_______________________________________________________________________\n");
+    printf("   Horner vs. term-by-term Gibbs evaluation (1M derivs() calls)\n");
+    printf("_______________________________________________________________________\n");
+    double ulp_termwise, ms_termwise, ms_horner, hdiff;
+    struct { const char *name; const BaseRegion *R; const RegionResidualElement *t; std::size_t N; double T0, T1, p0, p1; } horner[] = {
+        {"Region 1", &Regions::R1, Region1residdata, 34, 273.15, 623.15, 16.6, 100.0},      // compressed liquid
+        {"Region 2", &Regions::R2, Region2residdata, 43, 623.15, 1073.15, 0.001, 16.5},     // superheated vapor
+        {"Region 5", &Regions::R5, Region5residdata, 6, 1073.15, 2273.15, 0.001, 50.0},     // high temperature
+    };
+    const double horner_ulp_max = 4;    // Worst Horner error allowed, in units of DBL_EPSILON*sum|terms|
+    for (std::size_t k = 0; k < sizeof(horner) / sizeof(horner[0]); k++) {
+        hdiff = horner_check(*horner[k].R, horner[k].t, horner[k].N, horner[k].T0, horner[k].T1, horner[k].p0, horner[k].p1,
+                             ulp_termwise, ms_termwise, ms_horner);
+        printf("  %s:  max error termwise %5.2f  Horner %5.2f ulp   termwise %7.2f ms   Horner %7.2f ms  %s\n", horner[k].name,
+               ulp_termwise, hdiff, ms_termwise, ms_horner, (hdiff <= horner_ulp_max) ? "" : "FAIL");
+    }
+    printf("  Errors are against a long double reference, in units of DBL_EPSILON times the sum of the\n");
+    printf("  absolute terms; a Horner error above %g is marked FAIL.\n", horner_ulp_max);
+    printf("_______________________________________________________________________\n\n\n\n");
+    //
+    //  Generated straight-line kernels (IF97_KERNELS) vs. the table-walking sums they replace.  The
+    //  Region 1/2/3/5 and Region 3 v(T,p) kernels must agree bit for bit; the backward T(p,X) and
+    //  p(h,s) kernels replace std::pow() and agree to rounding.  Property calls (rho, h, cp and w
+    //  through each region's output()) are timed both ways.  Needs -DIF97_USE_KERNELS=ON.
+    //
+    printf("_______________________________________________________________________\n");
+    printf("   Generated kernels vs. table-walking sums (IF97_KERNELS)\n");
+    printf("_______________________________________________________________________\n");
+#ifdef IF97_KERNELS
+    {
+        const Region1Tables R1t;
+        const Region2Tables R2t;
+        const Region3Tables R3t;
+        const Region5Tables R5t;
+        const int bad[] = {kernel_mismatch(Regions::R1, R1t, 273.15, 623.15, 16.6, 100.0),
+                           kernel_mismatch(Regions::R2, R2t, 623.15, 1073.15, 0.001, 16.5),
+                           kernel_mismatch(Regions::R3, R3t, 623.15, 863.15, 100.0, 800.0),
+                           kernel_mismatch(Regions::R5, R5t, 1073.15, 2273.15, 0.001, 50.0),
+                           kernel_mismatch_v<Region3Backwards::Region3a>(630, 650, 40, 100),
+                           kernel_mismatch_v<Region3Backwards::Region3f>(700, 730, 24, 40),
+                           kernel_mismatch_v<Region3Backwards::Region3m>(648.5, 652, 22.5, 23.3),
+                           kernel_mismatch_v<Region3Backwards::Region3o>(640, 646, 22.5, 23)};
+        int bad_total = 0;
+        for (int k = 0; k < 8; k++) bad_total += bad[k];
+        printf("  Points differing in any bit (200 x 200 grids):\n");
+        printf("    Region 1 %d   Region 2 %d   Region 3 %d   Region 5 %d\n", bad[0], bad[1], bad[2], bad[3]);
+        printf("    v(T,p) 3a %d   3f %d   3m %d   3o %d  %s\n", bad[4], bad[5], bad[6], bad[7], bad_total ? "FAIL" : "");
+        const double bdiff[] = {kernel_diff<Backwards::Region1H>(&Backwards::BackwardsRegion::T_pX, 1, 100, 500, 1500),
+                                kernel_diff<Backwards::Region2aH>(&Backwards::BackwardsRegion::T_pX, 0.01, 4, 2800, 3500),
+                                kernel_diff<Backwards::Region3aH>(&Backwards::BackwardsRegion::T_pX, 25, 100, 1500, 2000),
+                                kernel_diff<Backwards::Region2aS>(&Backwards::BackwardsRegion::T_pX, 0.01, 4, 7, 9),
+                                kernel_diff<Backwards::Region2bS>(&Backwards::BackwardsRegion::T_pX, 5, 60, 6, 7),
+                                kernel_diff<Backwards::Region1HS>(&Backwards::BackwardsRegion::p_hs, 100, 1500, 0.3, 3.5)};
+        printf("  Backward equations, max rel. diff:\n");
+        printf("    T(p,h) 1 %8.2e   2a %8.2e   3a %8.2e\n", bdiff[0], bdiff[1], bdiff[2]);
+        printf("    T(p,s) 2a %8.2e   2b %8.2e   p(h,s) 1 %8.2e\n", bdiff[3], bdiff[4], bdiff[5]);
+        // rho, h, cp and w over a 300 x 300 (T,p) grid of each region
+        struct { const char *name; IF97REGIONS region; double T0, T1, p0, p1; } grid[] = {
+            {"Region 1", REGION_1, 273.15, 623.15, 16.6, 100.0}, {"Region 2", REGION_2, 623.15, 1073.15, 0.001, 16.5},
+            {"Region 3", REGION_3, 623.15, 863.15, 16.6, 100.0}, {"Region 5", REGION_5, 1073.15, 2273.15, 0.001, 50.0}};
+        double ms_all_tables = 0, ms_all_kernels = 0;
+        for (int k = 0; k < 4; k++) {
+            vector<double> T, p;
+            for (int i = 0; i < 300; i++)
+                for (int j = 0; j < 300; j++) {
+                    const double Tk = grid[k].T0 + (grid[k].T1 - grid[k].T0) * i / 299, pk = grid[k].p0 + (grid[k].p1 - grid[k].p0) * j / 299;
+                    if (RegionDetermination_TP(Tk, pk) == grid[k].region) { T.push_back(Tk); p.push_back(pk); }
+                }
+            double chk_tables = 0, chk_kernels = 0, ms_tables = 0, ms_kernels = 0;
+            switch (grid[k].region) {
+                case REGION_1: ms_tables = time_props(R1t, T, p, chk_tables); ms_kernels = time_props(Regions::R1, T, p, chk_kernels); break;
+                case REGION_2: ms_tables = time_props(R2t, T, p, chk_tables); ms_kernels = time_props(Regions::R2, T, p, chk_kernels); break;
+                case REGION_3: ms_tables = time_props(R3t, T, p, chk_tables); ms_kernels = time_props(Regions::R3, T, p, chk_kernels); break;
+                default:       ms_tables = time_props(R5t, T, p, chk_tables); ms_kernels = time_props(Regions::R5, T, p, chk_kernels); break;
+            }
+            ms_all_tables += ms_tables; ms_all_kernels += ms_kernels;
+            printf("  %s (%5d points):  tables %7.2f ms   kernels %7.2f ms   speedup %4.2fx  %s\n", grid[k].name, (int)T.size(),
+                   ms_tables, ms_kernels, ms_tables / ms_kernels, same_bits(chk_tables, chk_kernels) ? "" : "MISMATCH");
+        }
+        printf("  All regions:               tables %7.2f ms   kernels %7.2f ms   speedup %4.2fx\n", ms_all_tables, ms_all_kernels,
+               ms_all_tables / ms_all_kernels);
+        printf("  Times are for rho, h, cp and w at every point through each region's output(), best of three.\n");
+    }
+#else
+    printf("  Not built with IF97_KERNELS; configure with -DIF97_USE_KERNELS=ON to run this section.\n");
+#endif
+    printf("_______________________________________________________________________\n\n\n\n");
+    //
+    //  Region 3: one derivs() sweep vs. the six separate phi-derivative sums.
+    //
+    printf("_______________________________________________________________________\n");
+    printf("   Region 3 Helmholtz bundle vs. separate sums (1M evaluations)\n");
+    printf("_______________________________________________________________________\n");
+    double ms_separate, ms_bundle;
+    hdiff = bundle_check(Region3(), ms_separate, ms_bundle);
+    printf("  Region 3:  max abs. diff %8.2e   separate %7.2f ms   bundle %7.2f ms\n", hdiff, ms_separate, ms_bundle);
+    printf("  The bundle sums the same terms in the same order, so the difference should be zero.\n");
+    printf("_______________________________________________________________________\n\n\n\n");
+    //
+    //  Lane-parallel Gibbs kernels vs. the scalar region output, for every kernel set this CPU runs.
+    //
+    printf("_______________________________________________________________________\n");
+    printf("   SIMD Region 1/2/5 Gibbs kernels vs. scalar output() (1M points)\n");
+    printf("_______________________________________________________________________\n");
+    {
+        const char *simd_name[] = {"scalar ", "AVX2   ", "AVX-512"};
+        for (int level = SIMD_AVX2; level <= simd_level(); level++) {
+            double ms_scalar, ms_simd, sdiff;
+            sdiff = simd_check(Region1(), 273.15, 623.15, 16.6, 100.0, (IF97SIMD)level, ms_scalar, ms_simd);
+            printf("  %s Region 1:  max rel. diff %8.2e   scalar %7.2f ms   SIMD %7.2f ms\n", simd_name[level], sdiff, ms_scalar, ms_simd);
+            sdiff = simd_check(Region2(), 623.15, 1073.15, 0.001, 16.5, (IF97SIMD)level, ms_scalar, ms_simd);
+            printf("  %s Region 2:  max rel. diff %8.2e   scalar %7.2f ms   SIMD %7.2f ms\n", simd_name[level], sdiff, ms_scalar, ms_simd);
+            sdiff = simd_check(Region5(), 1073.15, 2273.15, 0.001, 50.0, (IF97SIMD)level, ms_scalar, ms_simd);
+            printf("  %s Region 5:  max rel. diff %8.2e   scalar %7.2f ms   SIMD %7.2f ms\n", simd_name[level], sdiff, ms_scalar, ms_simd);
+        }
+        printf("  Widest kernel set on this CPU: %s\n", simd_name[simd_level()]);
+    }
+    printf("  Relative differences above should be on the order of 1E-11 or lower.\n");
+    printf("_______________________________________________________________________\n\n\n\n");
+    //
+    //  Region 3 lane kernels: subregion-grouped SR5-05 guesses and lane-masked density iteration,
+    //  vs. the scalar solver, on points scattered over all Region 3 subregions.
+    //
+    printf("_______________________________________________________________________\n");
+    printf("   SIMD Region 3 rho(T,p) and properties vs. scalar (250k points)\n");
+    printf("_______________________________________________________________________\n");
+    {
+        const Region3 R3;
+        vector<double> T3, p3;
+        for (int i = 0; T3.size() < 250000; i++) {                  // Scrambled order mixes the subregions
+            const double T = 623.15 + 240.0 * ((i * 7919LL) % 100003) / 100003, p = 16.6 + 83.4 * ((i * 104729LL) % 99991) / 99991;
+            if (RegionDetermination_TP(T, p) != REGION_3) continue;
+            T3.push_back(T); p3.push_back(p);
+        }
+        const std::size_t n = T3.size();
+        vector<double> rho(n), out(n);
+        vector<IF97STATUS> status(n);
+        const char *simd_name[] = {"scalar ", "AVX2   ", "AVX-512"};
+        const char *solver_name[] = {"direct", "Newton", "Halley"};
+        for (int level = SIMD_AVX2; level <= simd_level(); level++) {
+            for (int method = R3_DIRECT; method <= R3_HALLEY; method++) {
+                const Region3Solver solver = {(IF97R3SOLVER)method, 1.0e-9, 100};
+                double maxdiff = 0, chk = 0;
+                int failures = 0;
+                high_resolution_clock::time_point start = high_resolution_clock::now();
+                for (std::size_t i = 0; i < n; i++) {
+                    int iter;
+                    chk += rhomass_Tp(T3[i], p3[i], solver, iter);
+                }
+                const double ms_scalar = duration<double, std::milli>(high_resolution_clock::now() - start).count();
+                start = high_resolution_clock::now();
+                R3.rho_Tp(&T3[0], &p3[0], n, &rho[0], &status[0], solver, (IF97SIMD)level);
+                const double ms_simd = duration<double, std::milli>(high_resolution_clock::now() - start).count();
+                for (std::size_t i = 0; i < n; i++) {
+                    int iter;
+                    if (status[i] != STATUS_OK) failures++;
+                    const double ref = rhomass_Tp(T3[i], p3[i], solver, iter);
+                    maxdiff = std::max(maxdiff, std::abs(rho[i] - ref) / ref);
+                    chk -= rho[i];
+                }
+                horner_sink = chk;
+                printf("  %s rho, %s:  max rel. diff %8.2e   failures %d   scalar %7.2f ms   SIMD %7.2f ms\n", simd_name[level],
+                       solver_name[method], maxdiff, failures, ms_scalar, ms_simd);
+            }
+            const IF97parameters keys[] = {IF97_HMASS, IF97_SMASS, IF97_CPMASS, IF97_W, IF97_K};
+            double maxdiff = 0;
+            for (int k = 0; k < 5; k++) {
+                R3.output(keys[k], &T3[0], &p3[0], 20011, &out[0], 0, (IF97SIMD)level);
+                for (std::size_t i = 0; i < 20011; i++) {
+                    const double ref = R3.output(keys[k], T3[i], p3[i], NONE);
+                    maxdiff = std::max(maxdiff, std::abs(out[i] - ref) / std::abs(ref));
+                }
+            }
+            printf("  %s h, s, cp, w, k:  max rel. diff %8.2e\n", simd_name[level], maxdiff);
+        }
+    }
+    printf("  Relative differences above should be on the order of 1E-11 or lower, with no failures.\n");
+    printf("_______________________________________________________________________\n\n\n\n");
+    //
+    //  Region 3 rho(T,p) solvers, selected at run time.  Iterations and differences are against a
+    //  Halley solution converged to 1E-12 (about the round-off floor of p(T,rho)) over a (T,p) grid across Region 3.
+    //
+    printf("_______________________________________________________________________\n");
+    printf("   Region 3 density solvers (rho(T,p) over a Region 3 grid)\n");
+    printf("_______________________________________________________________________\n");
+    {
+        const Region3Solver exact = {R3_HALLEY, 1.0e-12, 100};
+        const Region3Solver solvers[] = {{R3_DIRECT, 1.0e-9, 100}, {R3_NEWTON, 1.0e-9, 100}, {R3_HALLEY, 1.0e-9, 100},
+                                         {R3_NEWTON, 1.0e-12, 100}};
+        const char *names[] = {"direct      ", "Newton 1E-9 ", "Halley 1E-9 ", "Newton 1E-12"};
+        for (int k = 0; k < 4; k++) {
+            double rdiff = 0, chk = 0;
+            int iters = 0, maxit = 0, it, points = 0;
+            high_resolution_clock::time_point start = high_resolution_clock::now();
+            for (int i = 0; i < 100; i++) {
+                for (int j = 0; j < 100; j++) {
+                    const double T = 623.15 + 239.0 * i / 99, p = 25.0 + 75.0 * j / 99;   // [IAPWS_UNITS]
+                    if (RegionDetermination_TP(T, p) != REGION_3) continue;
+                    chk += rhomass_Tp(T, p, solvers[k], it);
+                    iters += it; maxit = max(maxit, it); points++;
+                }
+            }
+            const double ms = duration<double, std::milli>(high_resolution_clock::now() - start).count();
+            for (int i = 0; i < 100; i++) {
+                for (int j = 0; j < 100; j++) {
+                    const double T = 623.15 + 239.0 * i / 99, p = 25.0 + 75.0 * j / 99;
+                    if (RegionDetermination_TP(T, p) != REGION_3) continue;
+                    const double r = rhomass_Tp(T, p, exact, it);
+                    rdiff = max(rdiff, abs(rhomass_Tp(T, p, solvers[k], it) - r) / r);
+                }
+            }
+            horner_sink = chk;
+            printf("  %s:  max rel. diff %8.2e   iterations avg %4.2f max %2d   %7.2f ms\n", names[k], rdiff,
+                   (double)iters / points, maxit, ms);
+        }
+    }
+    printf("  Direct differences should be on the order of 1E-6; iterated ones 1E-9 or lower.\n");
+    {
+        // The same solvers passed per call to props_Tp() and to scalar eval_Tp() on a ThreadPool, with
+        // the process-wide setting left alone; every density must match rhomass_Tp() with that solver.
+        vector<double> T, p;
+        for (int i = 0; i < 100; i++) {
+            for (int j = 0; j < 100; j++) {
+                T.push_back(623.15 + 239.0 * i / 99); p.push_back(25.0 + 75.0 * j / 99);
+                if (RegionDetermination_TP(T.back(), p.back()) != REGION_3) { T.pop_back(); p.pop_back(); }
+            }
+        }
+        const Region3Solver solvers[] = {{R3_DIRECT, 1.0e-9, 100}, {R3_NEWTON, 1.0e-9, 100}, {R3_HALLEY, 1.0e-9, 100},
+                                         {R3_NEWTON, 1.0e-12, 100}};
+        const std::size_t n = T.size();
+        int mismatch = 0;
+        batch::ThreadPool pool(2);
+        for (int k = 0; k < 4; k++) {
+            vector<double> rho(n);
+            vector<IF97STATUS> status(n);
+            double *outputs[batch::PROP_COUNT] = {&rho[0]};
+            batch::eval_Tp(&T[0], &p[0], n, PROP_DMASS, outputs, &status[0], pool, sizeof(double), sizeof(double),
+                           SIMD_SCALAR, solvers[k]);
+            for (std::size_t i = 0; i < n; i++) {
+                int it;
+                const double r = rhomass_Tp(T[i], p[i], solvers[k], it);
+                if (props_Tp(T[i], p[i], PROP_DMASS, solvers[k]).rhomass != r) mismatch++;
+                if (status[i] != STATUS_OK || rho[i] != r) mismatch++;
+            }
+        }
+        printf("  Per-call solvers in props_Tp() and eval_Tp(), %d points each:  %d mismatches (should be 0)\n",
+               (int)n, mismatch);
+    }
+    printf("_______________________________________________________________________\n\n\n\n");
+    //
+    //  Region 3 subregion classification, point by point and along precomputed isobars.  Both
+    //  classifiers read the band table Region3Backwards::Region3bands, so they are checked against
+    //  the published subregion of every SR5-05 Table 5 and 13 point (pv3, Tv3 above, which start at
+    //  the second 3a point) and, over the whole grid, against the if/else dividing-line reference.
+    //
+    printf("_______________________________________________________________________\n");
+    printf("   Region 3 subregion classification (1M (T,p) points, 1000 isobars)\n");
+    printf("_______________________________________________________________________\n");
+    {
+        int mismatch_point = 0, mismatch_isobar = 0, mismatch_table = 0;
+        double chk = 0;
+        high_resolution_clock::time_point start = high_resolution_clock::now();
+        for (int j = 0; j < 1000; j++)
+            for (int i = 0; i < 1000; i++)
+                chk += Region3Backwards::BackwardsRegion3RegionDetermination(640.0 + 30.0 * i / 1000, 20.0 + 5.0 * j / 1000);
+        const double ms_point = duration<double, std::milli>(high_resolution_clock::now() - start).count();
+        start = high_resolution_clock::now();
+        for (int j = 0; j < 1000; j++) {
+            const Region3Backwards::Region3Isobar iso(20.0 + 5.0 * j / 1000);
+            for (int i = 0; i < 1000; i++) chk -= iso.subregion(640.0 + 30.0 * i / 1000);
+        }
+        const double ms_isobar = duration<double, std::milli>(high_resolution_clock::now() - start).count();
+        horner_sink = chk;
+        for (int j = 0; j < 1000; j++) {
+            const double p = 20.0 + 5.0 * j / 1000;
+            const Region3Backwards::Region3Isobar iso(p);
+            for (int i = 0; i < 1000; i++) {
+                const double T = 640.0 + 30.0 * i / 1000;
+                const char ref = region3_subregion_reference(T, p);
+                if (Region3Backwards::BackwardsRegion3RegionDetermination(T, p) != ref) mismatch_point++;
+                if (iso.subregion(T) != ref) mismatch_isobar++;
+            }
+        }
+        const char published[] = "ABBCCDDEEFFGGHHIIJJKKLLMMNNOOPPQQRRSSTTUUVVWWXXYYZZ";   // Subregion of pv3[i], Tv3[i]
+        for (int i = 0; i < 51; i++) {
+            const char sub[] = {region3_subregion_reference(Tv3[i], pv3[i]), Region3Backwards::BackwardsRegion3RegionDetermination(Tv3[i], pv3[i]),
+                                Region3Backwards::Region3Isobar(pv3[i]).subregion(Tv3[i])};
+            for (int k = 0; k < 3; k++)
+                if (sub[k] != published[i]) {
+                    mismatch_table++;
+                    printf("  SR5-05 point T = %g K, p = %g MPa: expected %c, got %c\n", Tv3[i], pv3[i], published[i], sub[k]);
+                }
+        }
+        printf("  mismatches vs. reference: per point %d   per isobar %d   SR5-05 points %d\n",
+               mismatch_point, mismatch_isobar, mismatch_table);
+        printf("  per point %7.2f ms   per isobar %7.2f ms\n", ms_point, ms_isobar);
+    }
+    printf("  There should be no mismatches.\n");
+    printf("_______________________________________________________________________\n\n\n\n");
+    //
+    //  Fused transport evaluation: transport_Tp() vs. separate rho, cp, mu, k and Pr calls.
+    //
+    printf("_______________________________________________________________________\n");
+    printf("   Fused transport_Tp() vs. separate property calls (90k points)\n");
+    printf("_______________________________________________________________________\n");
+    {
+        double chk_separate = 0, chk_fused = 0, maxdiff = 0;
+        high_resolution_clock::time_point start = high_resolution_clock::now();
+        for (int j = 0; j < 300; j++) {
+            const double p = 0.1 + 89.9 * j / 300;
+            for (int i = 0; i < 300; i++) {
+                const double T = 280.0 + 790.0 * i / 300;
+                const double mu = visc_Tp(T, p), k = tcond_Tp(T, p), cp = cpmass_Tp(T, p);
+                chk_separate += rhomass_Tp(T, p) + cp + mu + k + mu * cp * (1000 / R_fact) / k;
+            }
+        }
+        const double ms_separate = duration<double, std::milli>(high_resolution_clock::now() - start).count();
+        start = high_resolution_clock::now();
+        for (int j = 0; j < 300; j++) {
+            const double p = 0.1 + 89.9 * j / 300;
+            for (int i = 0; i < 300; i++) {
+                const State st = transport_Tp(280.0 + 790.0 * i / 300, p);
+                chk_fused += st.rhomass + st.cpmass + st.visc + st.tcond + st.prandtl;
+            }
+        }
+        const double ms_fused = duration<double, std::milli>(high_resolution_clock::now() - start).count();
+        for (int j = 0; j < 300; j += 7) {
+            const double p = 0.1 + 89.9 * j / 300;
+            for (int i = 0; i < 300; i += 7) {
+                const double T = 280.0 + 790.0 * i / 300;
+                const State st = transport_Tp(T, p);
+                const double mu = visc_Tp(T, p), k = tcond_Tp(T, p), Pr = mu * cpmass_Tp(T, p) * (1000 / R_fact) / k;
+                maxdiff = std::max(maxdiff, abs(st.visc - mu) / mu);
+                maxdiff = std::max(maxdiff, abs(st.tcond - k) / k);
+                maxdiff = std::max(maxdiff, abs(st.prandtl - Pr) / Pr);
+            }
+        }
+        horner_sink = chk_separate - chk_fused;
+        printf("  max rel. diff %8.2e   separate %7.2f ms   fused %7.2f ms   speedup %4.2fx\n", maxdiff, ms_separate, ms_fused,
+               ms_separate / ms_fused);
+    }
+    printf("  The fused call reuses the same derivatives, so the difference should be zero.\n");
+    printf("_______________________________________________________________________\n\n\n\n");
+    //
+    //  Critical-enhancement short-circuit: every state for which critical_enhancement() is false
+    //  must give y < 1.2E-7 (Z = 0) from the full lambda2 formula of IAPWS R15-11.
+    //
+    printf("_______________________________________________________________________\n");
+    printf("   Conductivity critical-enhancement short-circuit (Regions 1, 2, 3 & 5)\n");
+    printf("_______________________________________________________________________\n");
+    {
+        int npoints = 0, nskipped = 0, mismatch = 0;
+        const double Tr = 1.5 * Tcrit;
+        for (int j = 0; j <= 400; j++) {
+            const double p = 0.001 + 99.999 * j / 400;
+            for (int i = 0; i <= 800; i++) {
+                const double T = 273.16 + 1999.0 * i / 800;
+                if (T > 1073.15 && p > 50.0) continue;
+                const State st = props_Tp(T, p, PROP_DMASS | PROP_DRHODP);
+                bool crit;
+                if (st.region == REGION_3)
+                    crit = Regions::R3.critical_enhancement(T, p, st.rhomass, Regions::R3.derivs(T, st.rhomass));
+                else {
+                    const BaseRegion &R = (st.region == REGION_1) ? (const BaseRegion &)Regions::R1
+                                        : (st.region == REGION_2) ? (const BaseRegion &)Regions::R2 : (const BaseRegion &)Regions::R5;
+                    crit = R.critical_enhancement(T, p, st.rhomass, R.derivs(T, p));
+                }
+                npoints++;
+                if (crit) continue;
+                nskipped++;
+                const double delChi = st.rhomass / Rhocrit * (Pcrit / Rhocrit * st.drhodp - Regions::TR.delTr(st.rhomass) * Tr / T);
+                if ((delChi > 0) && (2.5 * 0.13 * pow(delChi / 0.06, 0.630 / 1.239) >= 1.2E-7)) mismatch++;
+            }
+        }
+        high_resolution_clock::time_point start = high_resolution_clock::now();
+        double chk = 0;
+        for (int j = 0; j < 300; j++)
+            for (int i = 0; i < 300; i++)
+                chk += tcond_Tp(280.0 + 790.0 * i / 300, 0.1 + 89.9 * j / 300);
+        const double ms_tcond = duration<double, std::milli>(high_resolution_clock::now() - start).count();
+        horner_sink = chk;
+        printf("  %d states, lambda2 skipped for %d (%4.1f%%), mismatches %d   tcond_Tp (90k) %7.2f ms\n", npoints, nskipped,
+               100.0 * nskipped / npoints, mismatch, ms_tcond);
+    }
+    printf("  There should be no mismatches.\n");
+    printf("_______________________________________________________________________\n\n\n\n");
+    //
+    //  Batch evaluation: batch::eval_Tp() reading (T,p) in place from an array of records, with
+    //  out-of-range and saturated points mixed in, vs. props_Tp() point by point.  The scalar
+    //  kernels must match exactly; the SIMD ones to rounding.
+    //
+    printf("_______________________________________________________________________\n");
+    printf("   Batch eval_Tp() from strided records vs. props_Tp() (100k points)\n");
+    printf("_______________________________________________________________________\n");
+    {
+        struct Record { int tag; double T, p; };
+        const std::size_t n = 100000;
+        vector<Record> rec(n);
+        for (std::size_t i = 0; i < n; i++) {
+            rec[i].tag = (int)i;
+            rec[i].T = 273.16 + 1999.0 * (i % 1000) / 1000;
+            rec[i].p = 0.001 + 99.999 * (i / 1000) / 100;
+            if (i % 997 == 0) rec[i].T = 200.0;                              // below Tmin
+            if (i % 1999 == 0) rec[i].p = 150.0;                             // above Pmax
+        }
+        rec[1].T = 373.15; rec[1].p = psat97(373.15);                        // on the saturation line
+        const unsigned int mask = PROP_ALL;
+        vector<vector<double> > cols(batch::PROP_COUNT, vector<double>(n));
+        double *outputs[batch::PROP_COUNT];
+        for (int k = 0; k < batch::PROP_COUNT; k++) outputs[k] = &cols[k][0];
+        int count[5] = {0, 0, 0, 0, 0}, mismatch = 0;
+        vector<vector<double> > cols_simd(batch::PROP_COUNT, vector<double>(n));
+        double *outputs_simd[batch::PROP_COUNT];
+        for (int k = 0; k < batch::PROP_COUNT; k++) outputs_simd[k] = &cols_simd[k][0];
+        vector<IF97STATUS> status(n), status_simd(n);
+        high_resolution_clock::time_point start = high_resolution_clock::now();
+        batch::eval_Tp(&rec[0].T, &rec[0].p, n, mask, outputs, &status[0], sizeof(Record), sizeof(Record), SIMD_SCALAR);
+        const double ms_batch = duration<double, std::milli>(high_resolution_clock::now() - start).count();
+        start = high_resolution_clock::now();
+        batch::eval_Tp(&rec[0].T, &rec[0].p, n, mask, outputs_simd, &status_simd[0], sizeof(Record), sizeof(Record));
+        const double ms_simd = duration<double, std::milli>(high_resolution_clock::now() - start).count();
+        double simd_diff = 0;
+        for (std::size_t i = 0; i < n; i++) {
+            if (status_simd[i] != status[i]) mismatch++;
+            if (status[i] != STATUS_OK) continue;
+            for (int k = 0; k < batch::PROP_COUNT; k++)
+                simd_diff = std::max(simd_diff, std::abs(cols_simd[k][i] - cols[k][i]) / std::abs(cols[k][i]));
+        }
+        double chk = 0;
+        start = high_resolution_clock::now();
+        for (std::size_t i = 0; i < n; i++) {
+            try {
+                const State st = props_Tp(rec[i].T, rec[i].p, mask);
+                chk += st.rhomass;
+                if (status[i] != STATUS_OK || st.rhomass != cols[0][i] || st.hmass != cols[1][i] || st.speed_sound != cols[6][i]
+                    || st.tcond != cols[9][i] || st.prandtl != cols[10][i]) mismatch++;
+            }
+            catch (const std::out_of_range &) {
+                if (status[i] == STATUS_OK || !std::isnan(cols[0][i])) mismatch++;
+            }
+            count[status[i]]++;
+        }
+        const double ms_single = duration<double, std::milli>(high_resolution_clock::now() - start).count();
+        horner_sink = chk;
+        printf("  ok %d   T range %d   p range %d   saturated %d   no convergence %d   mismatches %d\n",
+               count[STATUS_OK], count[STATUS_T_RANGE], count[STATUS_P_RANGE], count[STATUS_SATURATED], count[STATUS_NO_CONVERGENCE],
+               mismatch);
+        printf("  batch scalar %7.2f ms   batch SIMD %7.2f ms   props_Tp with try/catch %7.2f ms\n", ms_batch, ms_simd, ms_single);
+        printf("  SIMD vs. scalar batch:  max rel. diff %8.2e\n", simd_diff);
+    }
+    printf("  There should be no mismatches; bad points return NaN and a status code.\n");
+    printf("  The SIMD batch should agree with the scalar one to the order of 1E-11 or lower.\n");
+    printf("_______________________________________________________________________\n\n\n\n");
+    //
+    //  Multi-threaded batch evaluation: batch::eval_Tp() on a work-stealing ThreadPool vs. the serial
+    //  call, on a (T,p) grid over all regions.  Outputs and status codes must match bit for bit.  The
+    //  grid spans three blocks of batch::BLOCK points, and a scalar-kernel run on the pool is checked
+    //  against props_Tp() at every 13th point, so each block's results must land in their own rows.
+    //
+    printf("_______________________________________________________________________\n");
+    printf("   Batch eval_Tp() on a ThreadPool vs. serial (2.2M points, 3 blocks)\n");
+    printf("_______________________________________________________________________\n");
+    {
+        const std::size_t n = 2 * batch::BLOCK + 100003;
+        vector<double> T(n), p(n);
+        for (std::size_t i = 0; i < n; i++) {                       // Scrambled order mixes the regions
+            T[i] = 273.16 + 1999.0 * ((i * 7919) % 100003) / 100003;
+            p[i] = 0.001 + 99.999 * ((i * 104729) % 99991) / 99991;
+        }
+        const unsigned int mask = PROP_ALL;
+        vector<vector<double> > ref(batch::PROP_COUNT, vector<double>(n)), cols(batch::PROP_COUNT, vector<double>(n));
+        double *ref_out[batch::PROP_COUNT], *outputs[batch::PROP_COUNT];
+        for (int k = 0; k < batch::PROP_COUNT; k++) { ref_out[k] = &ref[k][0]; outputs[k] = &cols[k][0]; }
+        vector<IF97STATUS> ref_status(n), status(n);
+        high_resolution_clock::time_point start = high_resolution_clock::now();
+        batch::eval_Tp(&T[0], &p[0], n, mask, ref_out, &ref_status[0]);
+        const double ms_serial = duration<double, std::milli>(high_resolution_clock::now() - start).count();
+        printf("  serial     %7.2f ms\n", ms_serial);
+        const unsigned threads[] = {1, 2, 4, 0};
+        for (int t = 0; t < 4; t++) {
+            batch::ThreadPool pool(threads[t]);
+            start = high_resolution_clock::now();
+            batch::eval_Tp(&T[0], &p[0], n, mask, outputs, &status[0], pool);
+            const double ms_pool = duration<double, std::milli>(high_resolution_clock::now() - start).count();
+            int mismatch = 0;
+            for (std::size_t i = 0; i < n; i++) {
+                if (status[i] != ref_status[i]) mismatch++;
+                for (int k = 0; k < batch::PROP_COUNT; k++)
+                    if (std::memcmp(&cols[k][i], &ref[k][i], sizeof(double)) != 0) { mismatch++; break; }
+            }
+            printf("  pool %2u threads:  mismatches %d   %7.2f ms%s\n", pool.size(), mismatch, ms_pool, threads[t] ? "" : "   (all cores)");
+        }
+        batch::ThreadPool pool(0);
+        batch::eval_Tp(&T[0], &p[0], n, mask, outputs, &status[0], pool, sizeof(double), sizeof(double), SIMD_SCALAR);
+        int mismatch = 0;
+        for (std::size_t i = 0; i < n; i += 13) {
+            try {
+                const State st = props_Tp(T[i], p[i], mask);
+                if (status[i] != STATUS_OK || st.rhomass != cols[0][i] || st.hmass != cols[1][i] || st.speed_sound != cols[6][i]
+                    || st.tcond != cols[9][i]) mismatch++;
+            }
+            catch (const std::out_of_range &) {
+                if (status[i] == STATUS_OK || !std::isnan(cols[0][i])) mismatch++;
+            }
+        }
+        printf("  scalar kernels on the pool vs. props_Tp() at every 13th point:  mismatches %d\n", mismatch);
+    }
+    printf("  There should be no mismatches; the pool times scale with the cores available.\n");
+    printf("_______________________________________________________________________\n\n\n\n");
+    //
+    //  (p,h) and (p,s) region classification from the precomputed boundary curves vs. the exact
+    //  boundary evaluation, on scattered points plus points placed within a few ulps (and within
+    //  1E-9 relative) of every boundary, where the curves must fall back to the exact values.  The
+    //  compiled-in BoundaryTables are first compared with a fresh tabulation of each curve: the nodes
+    //  should match exactly and no band should be narrower than the recomputed one.
+    //
+    printf("_______________________________________________________________________\n");
+    printf("   (p,X) region classification, boundary curves vs. exact (1M points each)\n");
+    printf("_______________________________________________________________________\n");
+    {
+        const int n = 1000000;
+        vector<double> P(n), X(n);
+        for (int key = 0; key < 2; key++) {
+            const IF97parameters k = key ? IF97_SMASS : IF97_HMASS;
+            double node_diff = 0;
+            int narrower = 0;
+            for (int id = key ? BC_SMIN : BC_HMIN; id < (key ? BC_COUNT : BC_SMIN); id++) {
+                const BoundarySpec b = boundary_spec(id);
+                double u0, du, y[BoundaryCurve::N + 1], band[BoundaryCurve::N];
+                BoundaryCurve::tabulate(b.exact, b.key, b.lo, b.hi, b.singular_hi, b.log_axis, u0, du, y, band);
+                node_diff = max(node_diff, max(abs(u0 - BoundaryTables<>::u0[id]), abs(du - BoundaryTables<>::du[id])));
+                for (int j = 0; j <= BoundaryCurve::N; j++) node_diff = max(node_diff, abs(y[j] - BoundaryTables<>::y[id][j]));
+                for (int j = 0; j < BoundaryCurve::N; j++) narrower += (BoundaryTables<>::band[id][j] < band[j]);
+            }
+            high_resolution_clock::time_point start;
+            for (int i = 0; i < n; i++) {
+                P[i] = (i % 3 == 0) ? Pmin * exp(log(Pmax / Pmin) * ((i * 31) % 10007) / 10007)
+                                    : 0.99 * Pmin + (1.01 * Pmax - 0.99 * Pmin) * ((i * 7919LL) % 100003) / 100003;
+                X[i] = key ? -0.2 + 12.0 * ((i * 104729LL) % 99991) / 99991 : -50.0 + 4300.0 * ((i * 104729LL) % 99991) / 99991;
+                if ((i % 4 != 0) || (P[i] < Pmin) || (P[i] > Pmax)) continue;
+                double b;                                           // Every 4th point: onto a boundary
+                switch ((i / 4) % 6) {
+                    case 0: b = PXBoundaries::Xmin(k, P[i]); break;
+                    case 1: b = PXBoundaries::Xmax(k, P[i]) + 1.0E-10; break;
+                    case 2: if (P[i] > Pcrit) continue; b = PXBoundaries::Xliq(k, P[i]); break;
+                    case 3: if (P[i] > Pcrit) continue; b = PXBoundaries::Xvap(k, P[i]); break;
+                    case 4: if (P[i] < P23min) continue; b = PXBoundaries::X13(k, P[i]); break;
+                    default: if (P[i] < P23min) continue; b = PXBoundaries::X23(k, P[i]); break;
+                }
+                const int d = (i / 24) % 5 - 2;                    // -2 .. +2 ulps, or 1E-9 relative
+                X[i] = b;
+                if (i % 7 == 0) X[i] = b * (1 + 1.0E-9 * d);
+                else for (int q = 0; q < abs(d); q++) X[i] = nextafter(X[i], d > 0 ? HUGE_VAL : -HUGE_VAL);
+            }
+            IF97REGIONS r_exact = REGION_1, r_fast = REGION_1;
+            double chk = 0;
+            start = high_resolution_clock::now();
+            for (int i = 0; i < n; i++) chk += RegionDetermination_pX_exact(P[i], X[i], k, r_exact) + r_exact;
+            const double ms_exact = duration<double, std::milli>(high_resolution_clock::now() - start).count();
+            start = high_resolution_clock::now();
+            for (int i = 0; i < n; i++) chk -= RegionDetermination_pX(P[i], X[i], k, r_fast) + r_fast;
+            const double ms_fast = duration<double, std::milli>(high_resolution_clock::now() - start).count();
+            horner_sink = chk;
+            int mismatch = 0;
+            for (int i = 0; i < n; i++) {
+                r_exact = r_fast = REGION_5;
+                if ((RegionDetermination_pX_exact(P[i], X[i], k, r_exact) != RegionDetermination_pX(P[i], X[i], k, r_fast))
+                    || (r_exact != r_fast)) mismatch++;
+            }
+            printf("  (p,%s):  tables: node diff %.1e, narrower bands %d\n", key ? "s" : "h", node_diff, narrower);
+            printf("  (p,%s):  mismatches %d   exact %7.2f ms   curves %7.2f ms   speedup %5.2fx\n", key ? "s" : "h",
+                   mismatch, ms_exact, ms_fast, ms_exact / ms_fast);
+        }
+    }
+    printf("  There should be no mismatches, node differences, or narrower bands.\n");
+    printf("_______________________________________________________________________\n\n\n\n");
+    //
+    //  Batch backward T(p,h) and T(p,s): subregion buckets summed by the lane kernels, vs. the scalar
+    //  T_phmass() and T_psmass() with try/catch, over (p,X) grids that include out-of-range points.
+    //
+    printf("_______________________________________________________________________\n");
+    printf("   Batch T(p,h) and T(p,s) vs. scalar (250k points each)\n");
+    printf("_______________________________________________________________________\n");
+    {
+        const std::size_t n = 250000;
+        vector<double> p(n), X(n), T(n), Tscalar(n);
+        vector<IF97STATUS> status(n);
+        for (int key = 0; key < 2; key++) {
+            const bool H = (key == 0);
+            for (std::size_t i = 0; i < n; i++) {                   // Scrambled order mixes the subregions
+                p[i] = 0.0005 + 100.0 * ((i * 7919) % 100003) / 100003;
+                X[i] = H ? -50.0 + 4300.0 * ((i * 104729) % 99991) / 99991 : -0.2 + 12.0 * ((i * 104729) % 99991) / 99991;
+            }
+            int bad = 0;
+            high_resolution_clock::time_point start = high_resolution_clock::now();
+            for (std::size_t i = 0; i < n; i++) {
+                try {
+                    Tscalar[i] = H ? T_phmass(p[i], X[i]) : T_psmass(p[i], X[i]);
+                }
+                catch (const std::out_of_range &) {
+                    Tscalar[i] = std::numeric_limits<double>::quiet_NaN();
+                    bad++;
+                }
+            }
+            const double ms_scalar = duration<double, std::milli>(high_resolution_clock::now() - start).count();
+            for (int level = SIMD_SCALAR; level <= simd_level(); level++) {
+                start = high_resolution_clock::now();
+                RegionOutputBackward(&p[0], &X[0], n, H ? IF97_HMASS : IF97_SMASS, true, &T[0], &status[0], (IF97SIMD)level);
+                const double ms_batch = duration<double, std::milli>(high_resolution_clock::now() - start).count();
+                int mismatch = 0;
+                double maxdiff = 0;
+                for (std::size_t i = 0; i < n; i++) {
+                    if ((status[i] == STATUS_OK) != !std::isnan(Tscalar[i])) { mismatch++; continue; }
+                    if (status[i] != STATUS_OK) continue;
+                    if ((level == SIMD_SCALAR) && (T[i] != Tscalar[i])) mismatch++;
+                    maxdiff = std::max(maxdiff, std::abs(T[i] - Tscalar[i]));
+                }
+                const char *simd_name[] = {"scalar ", "AVX2   ", "AVX-512"};
+                printf("  T(p,%s) %s:  out of range %6d   mismatches %d   max diff %8.2e K   scalar %7.2f ms   batch %7.2f ms\n",
+                       H ? "h" : "s", simd_name[level], bad, mismatch, maxdiff, ms_scalar, ms_batch);
+            }
+        }
+    }
+    printf("  There should be no mismatches; the scalar kernels must match exactly and the SIMD\n");
+    printf("  ones to about 1E-10 K.\n");
+    printf("_______________________________________________________________________\n\n\n\n");
+
+    printf("_______________________________________________________________________\n");
+    printf("   (p,h) and (p,s) flash vs. separate property calls (100k points each)\n");
+    printf("_______________________________________________________________________\n");
+    {
+        const std::size_t n = 100000;
+        const IF97parameters keys[6] = {IF97_T, IF97_DMASS, IF97_HMASS, IF97_UMASS, IF97_CPMASS, IF97_W};
+        vector<double> p(n), X(n), Y(6 * n);
+        vector<FlashState> fs(n);
+        for (int key = 0; key < 2; key++) {
+            const bool H = (key == 0);
+            const IF97parameters inkey = H ? IF97_HMASS : IF97_SMASS;
+            for (std::size_t i = 0; i < n; i++) {                   // Same scrambled grid as above
+                p[i] = 0.0005 + 100.0 * ((i * 7919) % 100003) / 100003;
+                X[i] = H ? -50.0 + 4300.0 * ((i * 104729) % 99991) / 99991 : -0.2 + 12.0 * ((i * 104729) % 99991) / 99991;
+            }
+            // Separate calls: T, rho and the other of h/s everywhere, plus u, cp and w off the vapor dome
+            int bad = 0, twophase = 0;
+            high_resolution_clock::time_point start = high_resolution_clock::now();
+            for (std::size_t i = 0; i < n; i++) {
+                for (int k = 0; k < 6; k++) Y[6*i + k] = std::numeric_limits<double>::quiet_NaN();
+                try {
+                    Y[6*i]     = H ? T_phmass(p[i], X[i]) : T_psmass(p[i], X[i]);
+                    Y[6*i + 1] = H ? rhomass_phmass(p[i], X[i]) : rhomass_psmass(p[i], X[i]);
+                    Y[6*i + 2] = H ? smass_phmass(p[i], X[i]) : hmass_psmass(p[i], X[i]);
+                    for (int k = 3; k < 6; k++) Y[6*i + k] = Y_pX(keys[k], p[i], X[i], inkey);
+                }
+                catch (const std::out_of_range &) { bad++; }
+                catch (const std::invalid_argument &) { twophase++; }   // u, cp and w under the dome
+            }
+            const double ms_separate = duration<double, std::milli>(high_resolution_clock::now() - start).count();
+            int mismatch = 0;
+            start = high_resolution_clock::now();
+            for (std::size_t i = 0; i < n; i++) {
+                try {
+                    fs[i] = H ? flash_ph(p[i], X[i]) : flash_ps(p[i], X[i]);
+                }
+                catch (const std::out_of_range &) { fs[i].T = std::numeric_limits<double>::quiet_NaN(); }
+            }
+            const double ms_flash = duration<double, std::milli>(high_resolution_clock::now() - start).count();
+            for (std::size_t i = 0; i < n; i++) {
+                const double got[6] = {fs[i].T, fs[i].rhomass, H ? fs[i].smass : fs[i].hmass,
+                                       fs[i].umass, fs[i].cpmass, fs[i].speed_sound};
+                if (std::isnan(Y[6*i]) != std::isnan(got[0])) { mismatch++; continue; }
+                for (int k = 0; k < 6; k++)
+                    if (!std::isnan(Y[6*i + k]) && (got[k] != Y[6*i + k])) { mismatch++; break; }
+            }
+            printf("  flash_p%s:  out of range %6d   two-phase %6d   mismatches %d   separate %7.2f ms   flash %7.2f ms\n",
+                   H ? "h" : "s", bad, twophase, mismatch, ms_separate, ms_flash);
+        }
+    }
+    printf("  There should be no mismatches; the flash must match the separate calls exactly.\n");
+    printf("_______________________________________________________________________\n\n\n\n");
+
+    printf("_______________________________________________________________________\n");
+    printf("   (h,s) domain check and flash_hs() vs. exact (200k points)\n");
+    printf("_______________________________________________________________________\n");
+    {
+        const std::size_t n = 200000;
+        vector<double> h(n), s(n), P(n), T(n), R(n);
+        for (std::size_t i = 0; i < n; i++) {
+            s[i] = Smax * ((i * 7919) % 100003) / 100003;
+            if (i % 4 == 0)                                         // Every 4th point right on Hmax(s) or Hmin(s)
+                h[i] = ((i % 8) ? Hmax(s[i]) : Hmin(s[i])) * (1 + 1.0E-14 * (int((i / 8) % 5) - 2));
+            else                                                    // Others across the domain, a few outside it
+                h[i] = Hmin(s[i]) + (Hmax(s[i]) - Hmin(s[i])) * (-0.05 + 1.1 * ((i * 104729) % 99991) / 99991);
+        }
+        double node_diff = 0;                                       // Compiled-in tables vs. a fresh tabulation
+        int narrower = 0;
+        for (int id = BC_HS_PMAX; id <= BC_HS_PMIN; id++) {
+            const BoundarySpec b = boundary_spec(id);
+            double u0, du, y[BoundaryCurve::N + 1], band[BoundaryCurve::N];
+            BoundaryCurve::tabulate(b.exact, b.key, b.lo, b.hi, b.singular_hi, b.log_axis, u0, du, y, band);
+            node_diff = max(node_diff, max(abs(u0 - BoundaryTables<>::u0[id]), abs(du - BoundaryTables<>::du[id])));
+            for (int j = 0; j <= BoundaryCurve::N; j++) node_diff = max(node_diff, abs(y[j] - BoundaryTables<>::y[id][j]));
+            for (int j = 0; j < BoundaryCurve::N; j++) narrower += (BoundaryTables<>::band[id][j] < band[j]);
+        }
+        int exact_in = 0, mismatch = 0;
+        high_resolution_clock::time_point start = high_resolution_clock::now();
+        for (std::size_t i = 0; i < n; i++) exact_in += (h[i] <= Hmax(s[i])) && (h[i] >= Hmin(s[i]));
+        const double ms_exact = duration<double, std::milli>(high_resolution_clock::now() - start).count();
+        for (std::size_t i = 0; i < n; i++) {                       // Separate p(h,s), T(h,s) and rho(p,h) calls
+            try {
+                P[i] = p_hsmass(h[i], s[i]);
+                T[i] = T_hsmass(h[i], s[i]);
+                R[i] = (Region_ph(P[i], h[i]) == 4) ? std::numeric_limits<double>::quiet_NaN() : rhomass_phmass(P[i], h[i]);
+            }
+            catch (const std::out_of_range &) { P[i] = T[i] = R[i] = std::numeric_limits<double>::quiet_NaN(); }
+        }
+        vector<std::size_t> ok;                                     // Points inside the range of p(h,s) and T(h,s)
+        for (std::size_t i = 0; i < n; i++) {
+            bool domain = true;                                     // Boundary curves vs. exact Hmax(s), Hmin(s)
+            try { RegionDetermination_HS(h[i], s[i]); }
+            catch (const std::out_of_range &) { domain = false; }
+            if (domain != ((h[i] <= Hmax(s[i])) && (h[i] >= Hmin(s[i])))) mismatch++;
+            bool inside = true;
+            FlashState fs = {0, 0, 0, 0, 0, 0, 0, 0, 0, REGION_1};
+            try { fs = flash_hs(h[i], s[i]); }
+            catch (const std::out_of_range &) { inside = false; }
+            if (inside != !std::isnan(P[i])) { mismatch++; continue; }
+            if (!inside) continue;
+            ok.push_back(i);
+            if ((fs.p != P[i]) || (fs.T != T[i]) || (!std::isnan(R[i]) && (fs.rhomass != R[i]))) mismatch++;
+        }
+        // Timing over the points in range, so that exception handling does not dominate
+        double sum = 0;
+        start = high_resolution_clock::now();
+        for (std::size_t j = 0; j < ok.size(); j++) {
+            const std::size_t i = ok[j];
+            const double p = p_hsmass(h[i], s[i]);
+            sum += p + T_hsmass(h[i], s[i]) + ((Region_ph(p, h[i]) == 4) ? 0 : rhomass_phmass(p, h[i]));
+        }
+        const double ms_separate = duration<double, std::milli>(high_resolution_clock::now() - start).count();
+        start = high_resolution_clock::now();
+        for (std::size_t j = 0; j < ok.size(); j++) {
+            const FlashState fs = flash_hs(h[ok[j]], s[ok[j]]);
+            sum -= fs.p + fs.T + ((fs.region == REGION_4) ? 0 : fs.rhomass);
+        }
+        const double ms_flash = duration<double, std::milli>(high_resolution_clock::now() - start).count();
+        printf("  tables: node diff %.1e, narrower bands %d\n", node_diff, narrower);
+        printf("  inside Hmin/Hmax %6d   in range of p(h,s) %6d   mismatches %d\n", exact_in, (int)ok.size(), mismatch);
+        printf("  exact Hmax/Hmin checks %7.2f ms   separate calls %7.2f ms   flash_hs %7.2f ms\n",
+               ms_exact, ms_separate, ms_flash);
+        volatile double sink = sum;                                 // Keeps the timed loops from being optimized out
+        (void)sink;
+    }
+    printf("  There should be no mismatches, node differences, or narrower bands; p and T must match p_hsmass() and\n");
+    printf("  T_hsmass() exactly.\n");
+    printf("_______________________________________________________________________\n\n\n\n");
+
+    printf("_______________________________________________________________________\n");
+    printf("   sat_p() and sat_T() vs. the single saturation property calls (20k points)\n");
+    printf("_______________________________________________________________________\n");
+    {
+        const std::size_t n = 20000;
+        double (*const liq[10])(double) = {rholiq_p, hliq_p, sliq_p, uliq_p, cpliq_p, cvliq_p, speed_soundliq_p,
+                                           viscliq_p, tcondliq_p, prandtlliq_p};
+        double (*const vap[10])(double) = {rhovap_p, hvap_p, svap_p, uvap_p, cpvap_p, cvvap_p, speed_soundvap_p,
+                                           viscvap_p, tcondvap_p, prandtlvap_p};
+        const IF97parameters keys[9] = {IF97_DMASS, IF97_HMASS, IF97_SMASS, IF97_UMASS, IF97_CPMASS, IF97_CVMASS,
+                                        IF97_W, IF97_MU, IF97_K};
+        vector<double> p(n), T(n), Y(20 * n);
+        for (std::size_t i = 0; i < n; i++) {                       // Ptrip to just below Pcrit, and Ttrip to Tcrit
+            p[i] = Ptrip + (0.9999 * Pcrit - Ptrip) * ((i * 7919) % 10007) / 10007;
+            T[i] = Ttrip + (0.9999 * Tcrit - Ttrip) * ((i * 104729) % 10009) / 10009;
+        }
+        high_resolution_clock::time_point start = high_resolution_clock::now();
+        for (std::size_t i = 0; i < n; i++)
+            for (int k = 0; k < 10; k++) {
+                Y[20*i + k] = liq[k](p[i]);
+                Y[20*i + 10 + k] = vap[k](p[i]);
+            }
+        const double ms_single = duration<double, std::milli>(high_resolution_clock::now() - start).count();
+        vector<SatState> sat(n);
+        start = high_resolution_clock::now();
+        for (std::size_t i = 0; i < n; i++) sat[i] = sat_p(p[i]);
+        const double ms_sat = duration<double, std::milli>(high_resolution_clock::now() - start).count();
+        int mismatch = 0;
+        for (std::size_t i = 0; i < n; i++) {
+            const State *ph[2] = {&sat[i].liq, &sat[i].vap};
+            for (int j = 0; j < 2; j++) {
+                const double got[10] = {ph[j]->rhomass, ph[j]->hmass, ph[j]->smass, ph[j]->umass, ph[j]->cpmass,
+                                        ph[j]->cvmass, ph[j]->speed_sound, ph[j]->visc, ph[j]->tcond, ph[j]->prandtl};
+                for (int k = 0; k < 10; k++)
+                    if (got[k] != Y[20*i + 10*j + k]) { mismatch++; break; }
+            }
+            if (sat[i].T != Tsat97(p[i])) mismatch++;
+            const SatState st = sat_T(T[i]);                        // sat_T() against RegionOutput() at psat(T)
+            const double ps = psat97(T[i]);
+            const double l[9] = {st.liq.rhomass, st.liq.hmass, st.liq.smass, st.liq.umass, st.liq.cpmass,
+                                 st.liq.cvmass, st.liq.speed_sound, st.liq.visc, st.liq.tcond};
+            const double v[9] = {st.vap.rhomass, st.vap.hmass, st.vap.smass, st.vap.umass, st.vap.cpmass,
+                                 st.vap.cvmass, st.vap.speed_sound, st.vap.visc, st.vap.tcond};
+            for (int k = 0; k < 9; k++) {
+                if ((l[k] != RegionOutput(keys[k], T[i], ps, LIQUID)) || (v[k] != RegionOutput(keys[k], T[i], ps, VAPOR))) {
+                    mismatch++;
+                    break;
+                }
+            }
+            if (st.p != ps) mismatch++;
+        }
+        printf("  mismatches %d   20 single calls %7.2f ms   sat_p %7.2f ms\n", mismatch, ms_single, ms_sat);
+    }
+    printf("  There should be no mismatches; sat_p() and sat_T() must match the single calls exactly.\n");
+    printf("_______________________________________________________________________\n\n\n\n");
+
+    printf("_______________________________________________________________________\n");
+    printf("   mixture_pQ() and mixture_TQ() vs. X_pQ() (1000 pressures x 101 qualities)\n");
+    printf("_______________________________________________________________________\n");
+    {
+        const std::size_t np = 1000, nq = 101, n = np * nq;
+        vector<double> p(n), T(n), Q(n), Y(5 * n);
+        for (std::size_t i = 0; i < np; i++)                        // Quality sweeps, a few p, T and Q out of range
+            for (std::size_t j = 0; j < nq; j++) {
+                const std::size_t k = i * nq + j;
+                p[k] = Ptrip + (1.001 * Pcrit - Ptrip) * ((i * 7919) % 1009) / 1009;
+                T[k] = Ttrip + (1.001 * Tcrit - Ttrip) * ((i * 104729) % 1013) / 1013;
+                Q[k] = -0.01 + 1.02 * j / (nq - 1);
+            }
+        high_resolution_clock::time_point start = high_resolution_clock::now();
+        for (std::size_t k = 0; k < n; k++) {
+            try {
+                Y[5*k]     = hmass_pQ(p[k], Q[k]);
+                Y[5*k + 1] = smass_pQ(p[k], Q[k]);
+                Y[5*k + 2] = umass_pQ(p[k], Q[k]);
+                Y[5*k + 3] = rhomass_pQ(p[k], Q[k]);
+                Y[5*k + 4] = v_pQ(p[k], Q[k]);
+            }
+            catch (const std::out_of_range &) { Y[5*k] = std::numeric_limits<double>::quiet_NaN(); }
+        }
+        const double ms_single = duration<double, std::milli>(high_resolution_clock::now() - start).count();
+        vector<MixtureState> mix(n), mixT(n);
+        vector<IF97STATUS> status(n), statusT(n);
+        start = high_resolution_clock::now();
+        mixture_pQ(&p[0], &Q[0], n, &mix[0], &status[0]);
+        const double ms_batch = duration<double, std::milli>(high_resolution_clock::now() - start).count();
+        start = high_resolution_clock::now();
+        mixture_pQ(&p[0], &Q[0], n, &mix[0], &status[0], PROP_DMASS);   // h, s, u and rho end points only
+        const double ms_lean = duration<double, std::milli>(high_resolution_clock::now() - start).count();
+        mixture_TQ(&T[0], &Q[0], n, &mixT[0], &statusT[0]);
+        int mismatch = 0, bad = 0;
+        for (std::size_t k = 0; k < n; k++) {
+            if ((status[k] == STATUS_OK) == std::isnan(Y[5*k])) { mismatch++; continue; }
+            if (status[k] != STATUS_OK) { bad++; continue; }
+            const MixtureState m = mixture_pQ(p[k], Q[k]);
+            if ((m.hmass != Y[5*k]) || (m.smass != Y[5*k + 1]) || (m.umass != Y[5*k + 2]) || (m.rhomass != Y[5*k + 3])
+                || (m.v != Y[5*k + 4]) || (mix[k].hmass != m.hmass) || (mix[k].v != m.v)) mismatch++;
+        }
+        for (std::size_t k = 0; k < n; k++) {                       // mixture_TQ() against sat_T() mixed by Q
+            bool inside = true;
+            SatState st;
+            try { st = sat_T(T[k]); }
+            catch (const std::out_of_range &) { inside = false; }
+            inside = inside && (T[k] >= Ttrip) && (Q[k] >= 0) && (Q[k] <= 1);
+            if (inside != (statusT[k] == STATUS_OK)) { mismatch++; continue; }
+            if (!inside) continue;
+            if ((mixT[k].p != st.p) || (mixT[k].vap.cpmass != st.vap.cpmass)
+                || (mixT[k].hmass != Q[k]*st.vap.hmass + (1-Q[k])*st.liq.hmass)) mismatch++;
+        }
+        printf("  out of range %6d   mismatches %d\n", bad, mismatch);
+        printf("  5 X_pQ() calls %7.2f ms   batch mixture_pQ %7.2f ms   with h, s, u, rho end points only %7.2f ms\n",
+               ms_single, ms_batch, ms_lean);
+    }
+    printf("  There should be no mismatches; the mixture values must match X_pQ() exactly.\n");
+    printf("_______________________________________________________________________\n\n\n\n");
 
 
 
@@ -7,6 +7,14 @@
 #include <iostream>
 #include <iomanip>      // std::setprecision
 #include <stdexcept>
+#include <limits>
+#include <functional>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <memory>
 #include <stdio.h>
 
 enum IF97parameters {IF97_DMASS, IF97_HMASS, IF97_T, IF97_P, IF97_SMASS, IF97_UMASS, IF97_CPMASS, IF97_CVMASS, IF97_W, IF97_DRHODP,
@@ -31,6 +39,10 @@ struct RegionResidualElement      // Structure for the double indexed state equa
     double n; ///< The leading numerical constant
 };
 
+#ifdef IF97_KERNELS
+#include "IF97_kernels.h"          // Generated straight-line kernels, see IF97_kernelgen.cpp
+#endif
+
 namespace IF97
 {
     // Modified power function below, powi(x,i), is for integer powers of doubles only.  It can be
@@ -52,6 +64,130 @@ namespace IF97
         return ans;
     }
 
+    // Integer power table, x^lo ... x^hi, of a single base for the region polynomials.  Each
+    // entry costs one multiplication, x^k = x^(k-h)*x^h with h the largest power of two below k,
+    // which is the same product powi() forms, so every entry is bit-identical to powi(x,k).  A
+    // region sum can then build one table per variable per call and replace every powi(x, I[i])
+    // term with a table load.  The table is always extended to include x^0.  The ladders only pay
+    // off when inlined into the sums, where the exponent spans of the constant region objects are
+    // known and the build loops unroll, so the constructor is forced inline; an out-of-line generic
+    // build (GCC's choice in large translation units) left the Region 3 sums slower than powi().
+#if defined(__GNUC__)
+#define IF97_LADDER_INLINE __attribute__((always_inline)) inline
+#elif defined(_MSC_VER)
+#define IF97_LADDER_INLINE __forceinline
+#else
+#define IF97_LADDER_INLINE inline
+#endif
+    constexpr int POWER_LADDER_MAX = 64;  // Widest exponent span needed by any IF97 coefficient table
+    // Gibbs tables with fewer terms than this keep a powi() per term: their ladders would hold two
+    // or three times as many powers as the sum reads, and building them costs more than it saves
+    // (Region 5, 6 terms, runs about 15% slower through ladders).
+    constexpr std::size_t LADDER_MIN_TERMS = 16;
+    class PowerLadder
+    {
+    public:
+        IF97_LADDER_INLINE PowerLadder(double x, int lo, int hi) : lo(std::min(lo, 0)){
+            hi = std::max(hi, 0);
+            if (hi - this->lo >= POWER_LADDER_MAX) throw std::logic_error("Power ladder span too wide");
+            const int zero = -this->lo;       // index of x^0
+            double *p = pw + zero;            // p[k] = x^k
+            p[0] = 1.0;
+            if (hi > 0){
+                double sq = p[1] = x;         // x^h for the top power of two, h, below k
+                for (int k = 2, h = 1; k <= hi; ++k){
+                    if (2*h < k) { h *= 2; sq *= sq; }
+                    p[k] = p[k - h]*sq;
+                }
+            }
+            if (zero > 0){
+                double sq = p[-1] = 1.0/x;
+                for (int k = 2, h = 1; k <= zero; ++k){
+                    if (2*h < k) { h *= 2; sq *= sq; }
+                    p[-k] = p[h - k]*sq;
+                }
+            }
+        }
+        double operator[](int k) const{ return pw[k - lo]; }
+    private:
+        int lo;
+        double pw[POWER_LADDER_MAX];
+    };
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && !defined(IF97_NO_SIMD)
+#define IF97_SIMD_X86      // AVX2/AVX-512 Gibbs lane kernels, chosen at run time; define IF97_NO_SIMD to drop them
+#endif
+
+#ifdef IF97_SIMD_X86
+    // GCC vectors of L doubles, one (T,p) point per lane
+    template<int L> struct Lanes;
+    template<> struct Lanes<4>{ typedef double V __attribute__((vector_size(4*sizeof(double)))); };
+    template<> struct Lanes<8>{ typedef double V __attribute__((vector_size(8*sizeof(double)))); };
+
+    // Power ladder across L lanes: pw[k - lo] = x^k for lo <= k <= hi, built with the same
+    // multiplication chain as PowerLadder so each lane matches the scalar ladder.  Only ever
+    // inlined into the target-specific lane kernels of BaseRegion.
+    template<int L> __attribute__((always_inline)) inline void lane_ladder(const typename Lanes<L>::V &x, int lo, int hi,
+                                                                          typename Lanes<L>::V *pw){
+        typedef typename Lanes<L>::V V;
+        lo = std::min(lo, 0); hi = std::max(hi, 0);
+        V *p = pw - lo;                   // p[k] = x^k
+        for (int l = 0; l < L; ++l) p[0][l] = 1.0;
+        if (hi > 0){
+            V sq = p[1] = x;
+            for (int k = 2, h = 1; k <= hi; ++k){
+                if (2*h < k) { h *= 2; sq *= sq; }
+                p[k] = p[k - h]*sq;
+            }
+        }
+        if (lo < 0){
+            V sq = p[-1] = 1.0/x;
+            for (int k = 2, h = 1; k <= -lo; ++k){
+                if (2*h < k) { h *= 2; sq *= sq; }
+                p[-k] = p[h - k]*sq;
+            }
+        }
+    }
+#endif
+
+    // Straight-line kernels.  IF97_kernelgen writes IF97_kernels.h, one unrolled function per
+    // coefficient table with the exponents fixed at compile time.  Each kernel adds its sums, at
+    // arguments (x, y), to out[].  When IF97_KERNELS is defined the generated header is included
+    // at the top of this file and each region constructor names its kernels with IF97_KERNEL(),
+    // which keeps the constructors constexpr; otherwise IF97_KERNEL() yields 0 and the regions
+    // walk their tables as usual.
+    typedef void (*SumKernel)(double x, double y, double out[]);
+    namespace kernels{
+        enum Region3Part { R3_PHI, R3_DPHI_DDELTA, R3_D2PHI_DDELTA2, R3_DELTA_DPHI_DDELTA, R3_TAU_DPHI_DTAU,
+                           R3_DELTA2_D2PHI_DDELTA2, R3_TAU2_D2PHI_DTAU2, R3_DELTATAU_D2PHI_DDELTA_DTAU, R3_PARTS };
+    }
+#ifdef IF97_KERNELS
+#define IF97_KERNEL(name) (&IF97::kernels::name)
+#else
+#define IF97_KERNEL(name) (static_cast<IF97::SumKernel>(0))
+#endif
+
+    // Compile-time helpers for the coefficient tables.  The tables are constexpr arrays and every
+    // region object is built by a constexpr constructor, so the function-local region statics are
+    // constant-initialized: no heap, no static-init order, and no guard check on each call.  These
+    // are single-return recursions to stay within C++11 constexpr.
+    template<class T, std::size_t N> constexpr std::size_t table_size(const T (&)[N]){ return N; }
+    constexpr int cmin(int a, int b){ return a < b ? a : b; }
+    constexpr int cmax(int a, int b){ return a > b ? a : b; }
+    /// Smallest/largest I or J exponent of table entries [i, N), always including 0 for the ladders.
+    template<class E> constexpr int Imin_of(const E *t, std::size_t i, std::size_t N){ return i < N ? cmin(t[i].I, Imin_of(t, i + 1, N)) : 0; }
+    template<class E> constexpr int Imax_of(const E *t, std::size_t i, std::size_t N){ return i < N ? cmax(t[i].I, Imax_of(t, i + 1, N)) : 0; }
+    template<class E> constexpr int Jmin_of(const E *t, std::size_t i, std::size_t N){ return i < N ? cmin(t[i].J, Jmin_of(t, i + 1, N)) : 0; }
+    template<class E> constexpr int Jmax_of(const E *t, std::size_t i, std::size_t N){ return i < N ? cmax(t[i].J, Jmax_of(t, i + 1, N)) : 0; }
+    /// True if every I and J exponent of table entries [i, N) is an integer.
+    template<class E> constexpr bool integral_of(const E *t, std::size_t i, std::size_t N){
+        return i < N ? (t[i].I == int(t[i].I) && t[i].J == int(t[i].J) && integral_of(t, i + 1, N)) : true;
+    }
+    /// Largest step in I between neighbouring entries [i, N) of a table sorted by I, or up from 0 to the first.
+    template<class E> constexpr int Igap_of(const E *t, std::size_t i, std::size_t N){
+        return i < N ? cmax(t[i].I - (i ? t[i-1].I : 0), Igap_of(t, i + 1, N)) : 0;
+    }
+
     // CoolProp-IF97 Version Number
     static const char IF97VERSION [] = "v2.2.1";
     // Setup Water Constants for Trivial Functions and use in Region Classes
@@ -66,55 +202,55 @@ namespace IF97
     //         against values printed in the IAPWS documents.  CoolProp will never use this definition.
     //         Converted constants below are commented with an *.
 #ifdef IAPWS_UNITS
-    const double p_fact  = 1.0;                 // Leaves Thermodynamic Properties in IAPWS units of MPa
-    const double R_fact  = 1.0;                 // Leaves Thermodynamic Properties in IAPWS units of kJ
+    constexpr double p_fact  = 1.0;                 // Leaves Thermodynamic Properties in IAPWS units of MPa
+    constexpr double R_fact  = 1.0;                 // Leaves Thermodynamic Properties in IAPWS units of kJ
 #else
-    const double p_fact  = 1e6;                 // Converts IAPWS MPa units to Pa
-    const double R_fact  = 1000;                // Converts IAPWS kJ units to J
+    constexpr double p_fact  = 1e6;                 // Converts IAPWS MPa units to Pa
+    constexpr double R_fact  = 1000;                // Converts IAPWS kJ units to J
 #endif
     // IF97 Constants
-    const double Tcrit   = 647.096;             // K
-    const double Pcrit   = 22.064*p_fact;       // MPa*
-    const double Rhocrit = 322.0;               // kg/m³
-    const double Scrit   = 4.41202148223476*R_fact; // kJ*/kg-K (needed for backward eqn. in Region 3(a)(b)
-    const double Ttrip   = 273.16;              // K
-    const double Ptrip   = 0.000611657*p_fact;  // MPa*   [Change per IAPWS R7-97(2012), p. 7, Eq. 9]
-    const double Tmin    = 273.15;              // K
-    const double Tmax    = 1073.15;             // K
-    const double Pmin    = 0.000611213*p_fact;  // MPa*
-    const double Pmax    = 100.0*p_fact;        // MPa*
-    const double Rgas    = 0.461526*R_fact;     // kJ*/kg-K : mass based!
-    const double MW      = 0.018015268;         // kg/mol
+    constexpr double Tcrit   = 647.096;             // K
+    constexpr double Pcrit   = 22.064*p_fact;       // MPa*
+    constexpr double Rhocrit = 322.0;               // kg/m³
+    constexpr double Scrit   = 4.41202148223476*R_fact; // kJ*/kg-K (needed for backward eqn. in Region 3(a)(b)
+    constexpr double Ttrip   = 273.16;              // K
+    constexpr double Ptrip   = 0.000611657*p_fact;  // MPa*   [Change per IAPWS R7-97(2012), p. 7, Eq. 9]
+    constexpr double Tmin    = 273.15;              // K
+    constexpr double Tmax    = 1073.15;             // K
+    constexpr double Pmin    = 0.000611213*p_fact;  // MPa*
+    constexpr double Pmax    = 100.0*p_fact;        // MPa*
+    constexpr double Rgas    = 0.461526*R_fact;     // kJ*/kg-K : mass based!
+    constexpr double MW      = 0.018015268;         // kg/mol
     // Bounds for Region Determination
-    const double Text    = 2273.15;             // Extended (Region 5) Temperature Limit (Region 5) [K]
-    const double Pext    = 50.0*p_fact;         // Extended (Region 5) Pressure Limit (Region 5) [MPa*]
-    const double P23min  = 16.529164252605*p_fact; // Min Pressure [MPa*] on Region23 boundary curve; Max is Pmax
-    const double T23min  = 623.15;              // Min Temperature on Region23 boundary curve
-    const double T23max  = 863.15;              // Max Temperature on Region23 boundary curve
-    const double P2amax  = 4.0*p_fact;          // Max Pressure [MPa*] on upper H2a2b boundary (straight line)
-    const double P2bcmin = 6.54670*p_fact;      // Min Pressure [MPa*] on H2b2c boundary curve; Max is Pmax
-    const double S2bc    = 5.85*R_fact;         // Min Pressure [MPa*] on H2b2c boundary curve; Max is Pmax
+    constexpr double Text    = 2273.15;             // Extended (Region 5) Temperature Limit (Region 5) [K]
+    constexpr double Pext    = 50.0*p_fact;         // Extended (Region 5) Pressure Limit (Region 5) [MPa*]
+    constexpr double P23min  = 16.529164252605*p_fact; // Min Pressure [MPa*] on Region23 boundary curve; Max is Pmax
+    constexpr double T23min  = 623.15;              // Min Temperature on Region23 boundary curve
+    constexpr double T23max  = 863.15;              // Max Temperature on Region23 boundary curve
+    constexpr double P2amax  = 4.0*p_fact;          // Max Pressure [MPa*] on upper H2a2b boundary (straight line)
+    constexpr double P2bcmin = 6.54670*p_fact;      // Min Pressure [MPa*] on H2b2c boundary curve; Max is Pmax
+    constexpr double S2bc    = 5.85*R_fact;         // Min Pressure [MPa*] on H2b2c boundary curve; Max is Pmax
     // Bounds for Backward p(h,s), t(h,s) Determination
-    const double Smin    = 0.0;                         // Min Entropy [kJ*/kg-K] for Backward p(h,s)
-    const double Smax    = 11.921054825051103*R_fact;   // Max Entropy [kJ*/kg-K] for Backward p(h,s)
-    const double STPmax  = 6.04048367171238*R_fact;     // S(Tmax,Pmax) [kJ*/kg-K]
-    const double Sgtrip  = 9.155492076509681*R_fact;    // Sat. Vapor  Entropy [kJ*/kg-K] at Triple Point
-    const double Sftrip  = -4.09187776773977E-7*R_fact; // Sat. Liquid Entropy [kJ*/kg-K] at Triple Point
-    const double Hgtrip  = 2500.9109532932*R_fact;      // Sat. Vapor  Enthalpy [kJ*/kg] at Triple Point
-    const double Hftrip  = 5.16837786577998E-4*R_fact;  // Sat. Liquid Enthalpy [kJ*/kg] at Triple Point
-    const double SfT23   = 3.778281340*R_fact;          // Sat. Liquid Entropy [KJ*/kg-K] at T23min
-    const double SgT23   = 5.210887825*R_fact;          // Sat. Vapor  Entropy [KJ*/kg-K] at T23min
-    const double S13min  = 3.397782955*R_fact;          // Entropy at (T13,Pmax) [kJ*/kg-K]
-    const double S23min  = 5.048096828*R_fact;          // B23 Bounding Box [kJ*/kg-K]
-    const double S23max  = 5.260578707*R_fact;          // B23 Bounding Box [kJ*/kg-K]
-    const double H23min  = 2.563592004E3*R_fact;        // B23 Bounding Box [kJ*/kg-K]
-    const double H23max  = 2.812942061E3*R_fact;        // B23 Bounding Box [kJ*/kg-K]
+    constexpr double Smin    = 0.0;                         // Min Entropy [kJ*/kg-K] for Backward p(h,s)
+    constexpr double Smax    = 11.921054825051103*R_fact;   // Max Entropy [kJ*/kg-K] for Backward p(h,s)
+    constexpr double STPmax  = 6.04048367171238*R_fact;     // S(Tmax,Pmax) [kJ*/kg-K]
+    constexpr double Sgtrip  = 9.155492076509681*R_fact;    // Sat. Vapor  Entropy [kJ*/kg-K] at Triple Point
+    constexpr double Sftrip  = -4.09187776773977E-7*R_fact; // Sat. Liquid Entropy [kJ*/kg-K] at Triple Point
+    constexpr double Hgtrip  = 2500.9109532932*R_fact;      // Sat. Vapor  Enthalpy [kJ*/kg] at Triple Point
+    constexpr double Hftrip  = 5.16837786577998E-4*R_fact;  // Sat. Liquid Enthalpy [kJ*/kg] at Triple Point
+    constexpr double SfT23   = 3.778281340*R_fact;          // Sat. Liquid Entropy [KJ*/kg-K] at T23min
+    constexpr double SgT23   = 5.210887825*R_fact;          // Sat. Vapor  Entropy [KJ*/kg-K] at T23min
+    constexpr double S13min  = 3.397782955*R_fact;          // Entropy at (T13,Pmax) [kJ*/kg-K]
+    constexpr double S23min  = 5.048096828*R_fact;          // B23 Bounding Box [kJ*/kg-K]
+    constexpr double S23max  = 5.260578707*R_fact;          // B23 Bounding Box [kJ*/kg-K]
+    constexpr double H23min  = 2.563592004E3*R_fact;        // B23 Bounding Box [kJ*/kg-K]
+    constexpr double H23max  = 2.812942061E3*R_fact;        // B23 Bounding Box [kJ*/kg-K]
     //
     double Tsat97(double p);  // Forward declaration of Tsat97 required for calls below.
     double psat97(double T);  // Forward declaration of psat97 required for calls below.
     //
 
-    static const RegionResidualElement Hresiddata[] = {       // Residual H for viscosity
+    alignas(64) static constexpr RegionResidualElement Hresiddata[] = {       // Residual H for viscosity
         {0, 0,  5.20094e-1},
         {1, 0,  8.50895e-2},
         {2, 0, -1.08374   },
@@ -138,14 +274,14 @@ namespace IF97
         {5, 6, -5.93264e-4}
     };
 
-    static const RegionIdealElement Hidealdata[] = {          // Ideal H for viscosity
+    alignas(64) static constexpr RegionIdealElement Hidealdata[] = {          // Ideal H for viscosity
         {0,  1.67752   },
         {1,  2.20462   },
         {2,  0.6366564 },
         {3, -0.241605  }
     };
 
-    static const RegionResidualElement Lresiddata[] = {       // Residual L for Thermal Conductivity
+    alignas(64) static constexpr RegionResidualElement Lresiddata[] = {       // Residual L for Thermal Conductivity
         { 0, 0,  1.60397357000 },
         { 1, 0,  2.33771842000 },
         { 2, 0,  2.19650529000 },
@@ -178,7 +314,7 @@ namespace IF97
         { 4, 5,  0.01291384200 }
     };
 
-    static const RegionIdealElement Lidealdata[] = {          // Ideal L for thermal conductivity
+    alignas(64) static constexpr RegionIdealElement Lidealdata[] = {          // Ideal L for thermal conductivity
         {0,  2.443221E-3},
         {1,  1.323095E-2},
         {2,  6.770357E-3},
@@ -186,7 +322,7 @@ namespace IF97
         {4,  4.096266E-4}
     };
 
-    static const double A[6][5] = {
+    alignas(64) static constexpr double A[6][5] = {
         {  6.53786807199516,  6.52717759281799,   5.35500529896124,   1.55225959906681,   1.11999926419994  },
         { -5.61149954923348, -6.30816983387575,  -3.96415689925446,   0.464621290821181,  0.595748562571649 },
         {  3.39624167361325,  8.08379285492595,   8.91990208918795,   8.93237374861479,   9.88952565078920  },
@@ -195,104 +331,387 @@ namespace IF97
         {  1.97815050331519, -5.54349664571295,  -2.16866274479712,  -0.965458722086812, -0.503243546373828 },
     };
 
-    static const std::vector<RegionResidualElement> Hrdata(Hresiddata, Hresiddata + sizeof(Hresiddata)/sizeof(RegionResidualElement));
-    static const std::vector<RegionIdealElement> H0data(Hidealdata, Hidealdata + sizeof(Hidealdata)/sizeof(RegionIdealElement));
-    static const std::vector<RegionResidualElement> Lrdata(Lresiddata, Lresiddata + sizeof(Lresiddata)/sizeof(RegionResidualElement));
-    static const std::vector<RegionIdealElement> L0data(Lidealdata, Lidealdata + sizeof(Lidealdata)/sizeof(RegionIdealElement));
-
-    class BaseRegion
+    /// IAPWS transport property correlations shared by every region: the viscosity, IAPWS R12-08,
+    /// and the background thermal conductivity, IAPWS R15-11, are functions of (T, rho) only, and
+    /// read the single Hresiddata/Hidealdata and Lresiddata/Lidealdata tables above.  The regions
+    /// derive from this class and add their own critical enhancement, lambda2.
+    class Transport
     {
     public:
-        BaseRegion(std::vector<RegionResidualElement> resid, std::vector<RegionIdealElement> ideal) : R(Rgas){
-            for (std::size_t i = 0; i < resid.size(); ++i){
-                nr.push_back(resid[i].n);
-                Ir.push_back(resid[i].I);
-                Jr.push_back(resid[i].J);
+        double visc(double T, double rho) const{
+            /// Valid for all IF97 regions since it is a function of density, not pressure.
+            const double mu_star = 1.0E-6; // Reference viscosity [Pa-s]
+            const double mu2 = 1.0;        // For Industrial Formulation (IF97), mu2 = 1.0
+            return mu_star * mu0(T) * mu1(T,rho) * mu2;
+        }
+        double delTr(double rho) const{
+            /// This is the IF97 correlation for drhodp at the reducing temperature, Tr
+            const double rhobar = rho/Rhocrit;
+            double summer = 0;
+            int j;
+            //
+            if      (rhobar <= 0.310559006) j = 0;
+            else if (rhobar <= 0.776397516) j = 1;
+            else if (rhobar <= 1.242236025) j = 2;
+            else if (rhobar <= 1.863354037) j = 3;
+            else                            j = 4;
+            //
+            for (int i=0; i < 6; i++)
+                summer += A[i][j]*powi(rhobar,i);
+            return 1.0/summer;
+        }
+        bool negligible_enhancement(double rho) const{
+            /// Cheap (T,rho) pre-classification of the critical enhancement.  Compressed liquid
+            /// denser than 915 kg/m³ has delChi < 0 throughout Region 1 (the densest state with a
+            /// non-zero lambda2 is 910.8 kg/m³, near 455 K and 42.5 MPa), and no other region
+            /// reaches that density, so lambda2 = 0 there without forming any derivatives.
+            return rho > 915.0;
+        }
+    protected:
+        /// lambda2 sets Z = 0 once y = qD*xi0*(delChi/GAMMA0)^(nu/gam) < 1.2E-7, i.e. for
+        /// delChi < 1.34E-14.  Below DELCHI_MIN the cp, cv, mu, pow and atan terms are skipped.
+        static constexpr double DELCHI_MIN = 1.0E-14;
+        double mu0(double T) const{
+            const double T_bar = T/Tcrit;
+            double summer = 0.0;
+            for (std::size_t i = 0; i < table_size(Hidealdata); ++i){
+                summer += Hidealdata[i].n/powi(T_bar, Hidealdata[i].J);
+            }
+            return 100.0*sqrt(T_bar)/summer;
+        }
+        double mu1(double T, double rho) const{
+            const double rho_bar = rho/Rhocrit;
+            double summer = 0.0;
+            for (std::size_t i = 0; i < table_size(Hresiddata); ++i){
+                summer += rho_bar * powi(Trterm(T),Hresiddata[i].I) * Hresiddata[i].n*powi(Rhorterm(rho),Hresiddata[i].J);
+            }
+            return exp(summer);
+        }
+        double lambda0(double T) const{
+            const double T_bar = T/Tcrit;
+            double summer = 0.0;
+            for (std::size_t i = 0; i < table_size(Lidealdata); ++i){
+                summer += Lidealdata[i].n/powi(T_bar, Lidealdata[i].J);
             }
-            for (std::size_t i = 0; i < ideal.size(); ++i){
-                n0.push_back(ideal[i].n);
-                J0.push_back(ideal[i].J);
+            return sqrt(T_bar)/summer;
+        }
+        double lambda1(double T, double rho) const{
+            const double rho_bar = rho/Rhocrit;
+            double summer = 0.0;
+            for (std::size_t i = 0; i < table_size(Lresiddata); ++i){
+                summer += rho_bar * powi(Trterm(T),Lresiddata[i].I) * Lresiddata[i].n*powi(Rhorterm(rho),Lresiddata[i].J);
             }
-            for (std::size_t i = 0; i < Hrdata.size(); ++i){
-                munr.push_back(Hrdata[i].n);
-                muIr.push_back(Hrdata[i].I);
-                muJr.push_back(Hrdata[i].J);
+            return exp(summer);
+        }
+        double Trterm(double T) const{
+            return Tcrit/T - 1.0;
+        }
+        double Rhorterm(double rho) const{
+            return rho/Rhocrit - 1.0;
+        }
+    };
+
+    struct GibbsDerivatives       // Dimensionless Gibbs free energy and its derivatives at a single (T,p) state point
+    {
+        double gammar, dgammar_dPI, d2gammar_dPI2, dgammar_dTAU, d2gammar_dTAU2, d2gammar_dPIdTAU;  ///< Residual part
+        double gamma0, dgamma0_dPI, d2gamma0_dPI2, dgamma0_dTAU, d2gamma0_dTAU2;                  ///< Ideal-gas part
+    };
+
+    struct HelmholtzDerivatives   // Dimensionless Region 3 Helmholtz free energy and its derivatives at a single (T,rho) state point
+    {
+        double phi, delta_dphi_ddelta, delta2_d2phi_ddelta2;                  ///< phi and its reduced delta derivatives
+        double tau_dphi_dtau, tau2_d2phi_dtau2, deltatau_d2phi_ddelta_dtau;   ///< Reduced tau and mixed derivatives
+    };
+
+    enum IF97REGIONS {REGION_1, REGION_2, REGION_3, REGION_4, REGION_5};
+
+    // Property selection bits for the single-call state function, props_Tp()
+    enum IF97PROPMASK {PROP_DMASS  = 0x001, PROP_HMASS  = 0x002, PROP_SMASS = 0x004, PROP_UMASS  = 0x008,
+                       PROP_CPMASS = 0x010, PROP_CVMASS = 0x020, PROP_W     = 0x040, PROP_DRHODP = 0x080,
+                       // Transport Properties
+                       PROP_MU     = 0x100, PROP_K      = 0x200, PROP_PR    = 0x400,
+                       PROP_ALL    = 0x7FF};
+
+    // Per-point result codes of the batch functions, which report errors instead of throwing
+    enum IF97STATUS {STATUS_OK,               // Point evaluated
+                     STATUS_T_RANGE,          // Temperature outside the IF97 limits at this pressure
+                     STATUS_P_RANGE,          // Pressure outside the IF97 limits at this temperature
+                     STATUS_SATURATED,        // (T,p) lies exactly on the saturation line (Region 4)
+                     STATUS_NO_CONVERGENCE,   // Region 3 density iteration did not converge
+                     STATUS_X_RANGE,          // Enthalpy or entropy outside the IF97 limits at this pressure
+                     STATUS_Q_RANGE};         // Vapor quality outside [0,1]
+
+    struct State                  // Full thermodynamic and transport state; properties not selected are NaN
+    {
+        double T, p;              ///< Input temperature [K] and pressure [Pa*]
+        double rhomass, hmass, smass, umass, cpmass, cvmass, speed_sound, drhodp;
+        double visc, tcond;       ///< Transport properties [Pa-s], [W/m-K]
+        double prandtl;           ///< Prandtl number [dimensionless]
+        IF97REGIONS region;       ///< IF97 region used to evaluate the state
+    };
+
+    struct SatState               // Saturated liquid and vapor at one point of the saturation line
+    {
+        double T, p;              ///< Saturation temperature [K] and pressure [Pa*]
+        State liq, vap;           ///< Saturated liquid and vapor, every property filled
+    };
+
+    struct MixtureState           // Two-phase mixture of vapor quality Q and its saturated end points
+    {
+        double T, p, Q;           ///< Saturation temperature [K], pressure [Pa*] and vapor quality
+        double rhomass, v, hmass, smass, umass;
+        State liq, vap;           ///< Saturated liquid and vapor; only the properties selected are filled
+    };
+
+    struct FlashState             // Result of a (p,h) or (p,s) flash; cpmass and speed_sound are NaN under the vapor dome
+    {
+        double p, T;              ///< Input pressure [Pa*] and temperature [K] (Tsat in Region 4)
+        double rhomass, hmass, smass, umass, cpmass, speed_sound;
+        double Q;                 ///< Vapor quality; 0 in Regions 1 and 3a, 1 in Regions 2 and 3b
+        IF97REGIONS region;       ///< IF97 region of the (p,X) point
+    };
+
+    // Region 3 density solvers for rho(T,p), see set_region3_solver()
+    enum IF97R3SOLVER {R3_DIRECT,     // Backward equations of IAPWS SR5-05 only (error up to ~1E-6)
+                       R3_NEWTON,     // SR5-05 start, then Newton iteration of p(T,rho) = p
+                       R3_HALLEY};    // SR5-05 start, then Halley iteration of p(T,rho) = p
+
+    struct Region3Solver          // Region 3 density solver settings
+    {
+        IF97R3SOLVER method;      ///< Solution strategy
+        double tol;               ///< Iteration stops once |p(T,rho)/p - 1| <= tol
+        int max_iter;             ///< Iterations allowed before std::logic_error is thrown
+    };
+
+    inline Region3Solver &region3_solver(){
+        // Process-wide settings used by every Region 3 (T,p) property call.  Constant-initialized,
+        // so there is no guard on access.  REGION3_ITERATE only selects the initial method.
+#ifdef REGION3_ITERATE
+        static Region3Solver solver = {R3_NEWTON, 1.0e-9, 100};
+#else
+        static Region3Solver solver = {R3_DIRECT, 1.0e-9, 100};
+#endif
+        return solver;
+    }
+
+    // Lane-parallel kernel sets for BaseRegion::derivs(T[], p[], n, d[]), widest last
+    enum IF97SIMD {SIMD_SCALAR,       // One point at a time through derivs(T,p)
+                   SIMD_AVX2,         // 4 points per instruction (AVX2 + FMA)
+                   SIMD_AVX512};      // 8 points per instruction (AVX-512F)
+
+    inline IF97SIMD simd_detect(){
+        // Widest kernel set the running CPU supports; always SIMD_SCALAR without IF97_SIMD_X86.
+#ifdef IF97_SIMD_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) return SIMD_AVX512;
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) return SIMD_AVX2;
+#endif
+        return SIMD_SCALAR;
+    }
+
+    inline IF97SIMD simd_level(){
+        static const IF97SIMD level = simd_detect();   // Probed once per process
+        return level;
+    }
+
+    class BaseRegion : public Transport
+    {
+    public:
+        constexpr BaseRegion(const RegionResidualElement *resid, std::size_t Nr, const RegionIdealElement *ideal, std::size_t N0,
+                             double T_star, double p_star, SumKernel resid_kernel, SumKernel ideal_kernel)
+            : resid(resid), Nr(Nr), ideal(ideal), N0(N0),
+              Imin(Imin_of(resid, 0, Nr)), Imax(Imax_of(resid, 0, Nr)), Jmin(Jmin_of(resid, 0, Nr)), Jmax(Jmax_of(resid, 0, Nr)),
+              J0min(Jmin_of(ideal, 0, N0)), J0max(Jmax_of(ideal, 0, N0)), Igapmax(Igap_of(resid, 0, Nr)),
+              ladders(Nr >= LADDER_MIN_TERMS),
+              resid_kernel(resid_kernel), ideal_kernel(ideal_kernel), T_star(T_star), p_star(p_star), R(Rgas) {}
+        /// Evaluates gamma and all of its first and second PI/TAU derivatives, residual and ideal-gas
+        /// parts, in a single sweep over the coefficient tables.  Every property below is built from
+        /// this bundle, so callers needing several properties at the same (T,p) should evaluate it once
+        /// and pass it to the (T, p, GibbsDerivatives) overloads.  The residual part comes from the
+        /// generated kernel when IF97_KERNELS is defined, else it is summed term by term from power
+        /// ladders unless IF97_HORNER is defined, in which case the nested Horner form is used.  Tables
+        /// below LADDER_MIN_TERMS (Region 5) take a powi() per term either way.
+        GibbsDerivatives derivs(double T, double p) const{
+            if (resid_kernel) return derivs_kernel(T, p);
+#ifdef IF97_HORNER
+            if (ladders) return derivs_horner(T, p);
+#else
+            if (ladders) return derivs_termwise(T, p);
+#endif
+            return derivs_powi(T, p);
+        }
+        /// Evaluates the derivative bundles d[0..n) at n (T,p) points.  Full groups of 8 or 4 points go
+        /// through the AVX-512 or AVX2 lane kernels, up to the given level (by default the widest the
+        /// CPU supports), and the rest through derivs(T,p).  Each lane runs the sums of derivs_termwise(),
+        /// so results agree with the scalar path to rounding (FMA contraction may differ in the last bits).
+        void derivs(const double *T, const double *p, std::size_t n, GibbsDerivatives *d, IF97SIMD level = simd_level()) const{
+            std::size_t i = 0;
+#ifdef IF97_SIMD_X86
+            if (level >= SIMD_AVX512) for (; i + 8 <= n; i += 8) derivs_avx512(T + i, p + i, d + i);
+            if (level >= SIMD_AVX2)   for (; i + 4 <= n; i += 4) derivs_avx2(T + i, p + i, d + i);
+#else
+            (void)level;
+#endif
+            for (; i < n; ++i) d[i] = derivs(T[i], p[i]);
+        }
+        /// Reference evaluator: every residual term n*PI^I*TAU^J is summed on its own from power ladders.
+        GibbsDerivatives derivs_termwise(double T, double p) const{
+            GibbsDerivatives d;
+            const double _PI = PIrterm(p), _TAU = TAUrterm(T);
+            const PowerLadder PIpow(_PI, Imin-2, Imax), TAUpow(_TAU, Jmin-2, Jmax);
+            double g = 0, g_p = 0, g_pp = 0, g_t = 0, g_tt = 0, g_pt = 0;
+            for (std::size_t i = 0; i < Nr; ++i){
+                const int I = resid[i].I, J = resid[i].J;
+                const double nPI = resid[i].n*PIpow[I], nIPIm1 = resid[i].n*I*PIpow[I-1];
+                g    += nPI*TAUpow[J];
+                g_p  += nIPIm1*TAUpow[J];
+                g_pp += resid[i].n*I*(I-1)*PIpow[I-2]*TAUpow[J];
+                g_t  += nPI*J*TAUpow[J-1];
+                g_tt += nPI*J*(J-1)*TAUpow[J-2];
+                g_pt += nIPIm1*J*TAUpow[J-1];
             }
-            for (std::size_t i = 0; i < H0data.size(); ++i){
-                mun0.push_back(H0data[i].n);
-                muJ0.push_back(H0data[i].J);
+            d.gammar = g; d.dgammar_dPI = g_p; d.d2gammar_dPI2 = g_pp;
+            d.dgammar_dTAU = g_t; d.d2gammar_dTAU2 = g_tt; d.d2gammar_dPIdTAU = g_pt;
+            ideal_derivs(T, p, d);
+            return d;
+        }
+        /// Evaluator with a fresh powi() per term for PI and TAU, as the sums were formed before the power
+        /// ladders.  derivs() uses it for the small tables; the verification program times the ladders
+        /// against it.
+        GibbsDerivatives derivs_powi(double T, double p) const{
+            GibbsDerivatives d;
+            const double _PI = PIrterm(p), _TAU = TAUrterm(T);
+            double g = 0, g_p = 0, g_pp = 0, g_t = 0, g_tt = 0, g_pt = 0;
+            for (std::size_t i = 0; i < Nr; ++i){
+                const int I = resid[i].I, J = resid[i].J;
+                const double PIm2 = powi(_PI, I-2), PIm1 = PIm2*_PI, TAUm2 = powi(_TAU, J-2), TAUm1 = TAUm2*_TAU;
+                const double nPI = resid[i].n*PIm1*_PI, nIPIm1 = resid[i].n*I*PIm1;
+                g    += nPI*TAUm1*_TAU;
+                g_p  += nIPIm1*TAUm1*_TAU;
+                g_pp += resid[i].n*I*(I-1)*PIm2*TAUm1*_TAU;
+                g_t  += nPI*J*TAUm1;
+                g_tt += nPI*J*(J-1)*TAUm2;
+                g_pt += nIPIm1*J*TAUm1;
             }
-            for (std::size_t i = 0; i < Lrdata.size(); ++i){
-                lamnr.push_back(Lrdata[i].n);
-                lamIr.push_back(Lrdata[i].I);
-                lamJr.push_back(Lrdata[i].J);
+            d.gammar = g; d.dgammar_dPI = g_p; d.d2gammar_dPI2 = g_pp;
+            d.dgammar_dTAU = g_t; d.d2gammar_dTAU2 = g_tt; d.d2gammar_dPIdTAU = g_pt;
+            d.gamma0 = d.dgamma0_dPI = d.d2gamma0_dPI2 = d.dgamma0_dTAU = d.d2gamma0_dTAU2 = 0;
+            if (N0 == 0){ return d; }
+            const double PI = p/p_star, _TAU0 = TAU0term(T);
+            double g0 = log(PI), g0_t = 0, g0_tt = 0;
+            for (std::size_t i = 0; i < N0; ++i){
+                const int J = ideal[i].J;
+                const double nTAUm2 = ideal[i].n*powi(_TAU0, J-2), nTAUm1 = nTAUm2*_TAU0;
+                g0    += nTAUm1*_TAU0;
+                g0_t  += nTAUm1*J;
+                g0_tt += nTAUm2*J*(J-1);
             }
-            for (std::size_t i = 0; i < L0data.size(); ++i){
-                lamn0.push_back(L0data[i].n);
-                lamJ0.push_back(L0data[i].J);
+            d.gamma0 = g0; d.dgamma0_dPI = 1.0/PI; d.d2gamma0_dPI2 = -1.0/(PI*PI);
+            d.dgamma0_dTAU = g0_t; d.d2gamma0_dTAU2 = g0_tt;
+            return d;
+        }
+        /// Generated straight-line kernel evaluator; same sums and rounding as derivs_termwise(), or as
+        /// derivs_powi() for tables below LADDER_MIN_TERMS.
+        GibbsDerivatives derivs_kernel(double T, double p) const{
+            GibbsDerivatives d;
+            double g[6] = {0, 0, 0, 0, 0, 0};
+            resid_kernel(PIrterm(p), TAUrterm(T), g);
+            d.gammar = g[0]; d.dgammar_dPI = g[1]; d.d2gammar_dPI2 = g[2];
+            d.dgammar_dTAU = g[3]; d.d2gammar_dTAU2 = g[4]; d.d2gammar_dPIdTAU = g[5];
+            ideal_derivs(T, p, d);
+            return d;
+        }
+        /// Horner evaluator: the residual sum is factored as gammar = sum_I PI^I * t_I(TAU), where each
+        /// row polynomial t_I and its TAU derivatives are summed from a TAU power ladder, and the outer
+        /// sparse polynomial in PI is run from the highest row down with the gap recurrences
+        ///     q = PI^g*q + c,  q' = g*PI^(g-1)*q + PI^g*q',  q'' = g*(g-1)*PI^(g-2)*q + 2*g*PI^(g-1)*q' + PI^g*q''
+        /// which carry the PI derivatives along.  The rows are found on the fly, which relies on the
+        /// residual table being sorted by I, as all of the IF97 tables are.  Results agree with
+        /// derivs_termwise() to rounding.
+        GibbsDerivatives derivs_horner(double T, double p) const{
+            GibbsDerivatives d;
+            const double _PI = PIrterm(p), _TAU = TAUrterm(T);
+            const PowerLadder PIgap(_PI, 0, Igapmax), TAUpow(_TAU, Jmin-2, Jmax);
+            // A: t_I polynomial and its first two PI derivatives, B: dt_I/dTAU and its PI derivative, C: d2t_I/dTAU2
+            double A = 0, A_p = 0, A_pp = 0, B = 0, B_p = 0, C = 0;
+            int Iabove = 0;
+            for (std::size_t end = Nr; end > 0; ){
+                const int I = resid[end-1].I;
+                std::size_t begin = end - 1;
+                while (begin > 0 && resid[begin-1].I == I) --begin;
+                double t = 0, t_t = 0, t_tt = 0;
+                for (std::size_t i = begin; i < end; ++i){
+                    const int J = resid[i].J;
+                    const double n = resid[i].n;
+                    t    += n*TAUpow[J];
+                    t_t  += (n*J)*TAUpow[J-1];
+                    t_tt += (n*J*(J - 1))*TAUpow[J-2];
+                }
+                horner_step(PIgap, (end < Nr) ? Iabove - I : 0, t, t_t, t_tt, A, A_p, A_pp, B, B_p, C);
+                Iabove = I;
+                end = begin;
             }
+            if (Nr > 0) horner_step(PIgap, resid[0].I, 0, 0, 0, A, A_p, A_pp, B, B_p, C);
+            d.gammar = A; d.dgammar_dPI = A_p; d.d2gammar_dPI2 = A_pp;
+            d.dgammar_dTAU = B; d.d2gammar_dTAU2 = C; d.d2gammar_dPIdTAU = B_p;
+            ideal_derivs(T, p, d);
+            return d;
         }
-        double rhomass(double T, double p) const{
-            return p_star/(R*T)/(p_fact/1000.0/R_fact)/(dgamma0_dPI(T,p) + dgammar_dPI(T,p));
+        double rhomass(double T, double p) const{ return rhomass(T, p, derivs(T, p)); }
+        double hmass(double T, double p) const{ return hmass(T, p, derivs(T, p)); }
+        double smass(double T, double p) const{ return smass(T, p, derivs(T, p)); }
+        double umass(double T, double p) const{ return umass(T, p, derivs(T, p)); }
+        double cpmass(double T, double p) const{ return cpmass(T, p, derivs(T, p)); }
+        double cvmass(double T, double p) const{ return cvmass(T, p, derivs(T, p)); }
+        double speed_sound(double T, double p) const{ return speed_sound(T, p, derivs(T, p)); }
+        double drhodp(double T, double p) const{ return drhodp(T, p, derivs(T, p)); }
+        double rhomass(double T, double /*p*/, const GibbsDerivatives &d) const{
+            return p_star/(R*T)/(p_fact/1000.0/R_fact)/(d.dgamma0_dPI + d.dgammar_dPI);
         }
-        double hmass(double T, double p) const{
-            return R*T_star*(dgamma0_dTAU(T, p) + dgammar_dTAU(T, p));
+        double hmass(double /*T*/, double /*p*/, const GibbsDerivatives &d) const{
+            return R*T_star*(d.dgamma0_dTAU + d.dgammar_dTAU);
         }
-        double smass(double T, double p) const{
+        double smass(double T, double /*p*/, const GibbsDerivatives &d) const{
             const double tau = T_star/T;
-            return R*(tau*(dgamma0_dTAU(T, p) + dgammar_dTAU(T, p)) - (gammar(T, p) + gamma0(T, p)));
+            return R*(tau*(d.dgamma0_dTAU + d.dgammar_dTAU) - (d.gammar + d.gamma0));
         }
-        double umass(double T, double p) const{
+        double umass(double T, double p, const GibbsDerivatives &d) const{
             const double tau = T_star/T, PI = p/p_star;
-            return R*T*(tau*(dgamma0_dTAU(T, p) + dgammar_dTAU(T, p)) - PI*(dgamma0_dPI(T, p) + dgammar_dPI(T, p)));
+            return R*T*(tau*(d.dgamma0_dTAU + d.dgammar_dTAU) - PI*(d.dgamma0_dPI + d.dgammar_dPI));
         }
-        double cpmass(double T, double p) const{
+        double cpmass(double T, double /*p*/, const GibbsDerivatives &d) const{
             const double tau = T_star/T;
-            return -R*tau*tau*(d2gammar_dTAU2(T, p) + d2gamma0_dTAU2(T, p));
+            return -R*tau*tau*(d.d2gammar_dTAU2 + d.d2gamma0_dTAU2);
         }
-        virtual double cvmass(double T, double p) const{
+        virtual double cvmass(double T, double p, const GibbsDerivatives &d) const{
             const double tau = T_star/T, PI = p/p_star;
-            return cpmass(T,p)-R*powi(1 + PI*dgammar_dPI(T,p) - tau*PI*d2gammar_dPIdTAU(T,p),2)/(1-PI*PI*d2gammar_dPI2(T, p));
+            return cpmass(T,p,d)-R*powi(1 + PI*d.dgammar_dPI - tau*PI*d.d2gammar_dPIdTAU,2)/(1-PI*PI*d.d2gammar_dPI2);
         }
-        virtual double speed_sound(double T, double p) const{
+        virtual double speed_sound(double T, double p, const GibbsDerivatives &d) const{
             const double tau = T_star/T, PI = p/p_star;
-            const double RHS = (1 + 2*PI*dgammar_dPI(T,p) + PI*PI*powi(dgammar_dPI(T,p),2))/((1-PI*PI*d2gammar_dPI2(T,p)) +powi(1 + PI*dgammar_dPI(T,p) - tau*PI*d2gammar_dPIdTAU(T,p), 2)/(tau*tau*(d2gamma0_dTAU2(T,p) + d2gammar_dTAU2(T,p))));
+            const double RHS = (1 + 2*PI*d.dgammar_dPI + PI*PI*powi(d.dgammar_dPI,2))/((1-PI*PI*d.d2gammar_dPI2) +powi(1 + PI*d.dgammar_dPI - tau*PI*d.d2gammar_dPIdTAU, 2)/(tau*tau*(d.d2gamma0_dTAU2 + d.d2gammar_dTAU2)));
             return sqrt(R*(1000/R_fact)*T*RHS);
         }
-        double visc(double T, double rho) const{
-            /// This base region function is valid for all IF97 regions since it is a function
-            /// of density, not pressure, and can be called from any region instance.
-            const double mu_star = 1.0E-6; // Reference viscosity [Pa-s]
-            const double mu2 = 1.0;        // For Industrial Formulation (IF97), mu2 = 1.0
-            return mu_star * mu0(T) * mu1(T,rho) * mu2;
-        }
         double tcond(double T, double p, double rho) const{
-            /// This base region function is valid for all IF97 regions 
+            if (negligible_enhancement(rho)) return tcond(T, p, rho, GibbsDerivatives(), 0.0);  // No derivatives needed
+            return tcond(T, p, rho, derivs(T, p));
+        }
+        double tcond(double T, double p, double rho, const GibbsDerivatives &d) const{
+            /// Viscosity only enters through lambda2, so it is skipped where that vanishes
+            return tcond(T, p, rho, d, critical_enhancement(T, p, rho, d) ? visc(T, rho) : 0.0);
+        }
+        double tcond(double T, double p, double rho, const GibbsDerivatives &d, double mu) const{
+            /// This base region function is valid for all IF97 regions.  mu = visc(T,rho) is
+            /// passed in so that callers already holding the viscosity don't evaluate it twice.
             const double lambda_star = 0.001;  // Reference conductivity [W/m-K]
-            const double lambda_bar = lambda0(T)*lambda1(T,rho) + lambda2(T,p,rho);
+            const double lambda_bar = lambda0(T)*lambda1(T,rho) + lambda2(T,p,rho,d,mu);
             return lambda_star * lambda_bar;
         }
-        virtual double drhodp(double T, double p) const{
+        virtual double drhodp(double T, double p, const GibbsDerivatives &d) const{
             /// Only valid for regions 2 and 5.  Will be overridden in Regions 1 and 3.
             /// Derived from IAPWS Revised Advisory Note No. 3 (See Table 2, Section 4.1 & 4.3)
             const double PI = p/p_star;
-            return (rhomass(T,p)/p) * ( (1.0 - PI*PI*d2gammar_dPI2(T,p)) / (1.0 + PI*dgammar_dPI(T,p)) );
-        }
-        double delTr(double rho) const{
-            /// This is the IF97 correlation for drhodp at the reducing temperature, Tr
-            const double rhobar = rho/Rhocrit;
-            double summer = 0;
-            int j;
-            //
-            if      (rhobar <= 0.310559006) j = 0;
-            else if (rhobar <= 0.776397516) j = 1;
-            else if (rhobar <= 1.242236025) j = 2;
-            else if (rhobar <= 1.863354037) j = 3;
-            else                            j = 4;
-            //
-            for (int i=0; i < 6; i++)
-                summer += A[i][j]*powi(rhobar,i);
-            return 1.0/summer;
+            return (rhomass(T,p,d)/p) * ( (1.0 - PI*PI*d.d2gammar_dPI2) / (1.0 + PI*d.dgammar_dPI) );
         }
         virtual double PIrterm(double) const = 0;
         virtual double TAUrterm(double) const = 0;
@@ -309,186 +728,215 @@ namespace IF97
             case IF97_CVMASS: return cvmass(T, p);
             case IF97_W: return speed_sound(T, p);
             case IF97_MU: return visc(T,rhomass(T,p));   // Viscosity is a function of rho.
-            case IF97_K: return tcond(T,p,rhomass(T,p)); // Conductivity needs p and rho.
+            case IF97_K: {                               // Conductivity needs p and rho.
+                const GibbsDerivatives d = derivs(T, p);
+                return tcond(T, p, rhomass(T, p, d), d);
+            }
             case IF97_DRHODP: return drhodp(T, p);       // For verification testing.
             case IF97_Q: throw std::invalid_argument("Can't determine Q from T & P");  // just in case
             }
             throw std::out_of_range("Unable to match input parameters");
         }
-
-    protected:
-        std::vector<int> Ir, Jr;
-        std::vector<double> nr;
-        std::vector<int> J0;
-        std::vector<double> n0;
-        double T_star, p_star;
-        const double R;
-        /// For Viscosity Calculations
-        std::vector<int> muJ0;
-        std::vector<double> mun0;
-        std::vector<int> muIr, muJr;
-        std::vector<double> munr;
-        /// For Thermal Conductivity Calculations
-        std::vector<int> lamJ0;
-        std::vector<double> lamn0;
-        std::vector<int> lamIr, lamJr;
-        std::vector<double> lamnr;
-   
-        double gammar(double T, double p) const{
-            const double _PI = PIrterm(p), _TAU = TAUrterm(T);
-            double summer = 0;
-            for (std::size_t i = 0; i < Jr.size(); ++i){
-                summer += nr[i]*powi(_PI, Ir[i])*powi(_TAU, Jr[i]);
+        double output(IF97parameters key, double T, double p, const GibbsDerivatives &d) const{
+            /// As output(key, T, p), from an already evaluated derivative bundle.
+            switch(key){
+            case IF97_T: return T;
+            case IF97_P: return p;
+            case IF97_DMASS: return rhomass(T, p, d);
+            case IF97_HMASS: return hmass(T, p, d);
+            case IF97_SMASS: return smass(T, p, d);
+            case IF97_UMASS: return umass(T, p, d);
+            case IF97_CPMASS: return cpmass(T, p, d);
+            case IF97_CVMASS: return cvmass(T, p, d);
+            case IF97_W: return speed_sound(T, p, d);
+            case IF97_MU: return visc(T, rhomass(T, p, d));
+            case IF97_K: return tcond(T, p, rhomass(T, p, d), d);
+            case IF97_DRHODP: return drhodp(T, p, d);
+            case IF97_Q: throw std::invalid_argument("Can't determine Q from T & P");
             }
-            return summer;
+            throw std::out_of_range("Unable to match input parameters");
         }
-        double dgammar_dPI(double T, double p) const{
-            const double _PI = PIrterm(p), _TAU = TAUrterm(T);
-            double summer = 0;
-            for (std::size_t i = 0; i < Jr.size(); ++i){
-                summer += nr[i]*Ir[i]*powi(_PI, Ir[i]-1)*powi(_TAU, Jr[i]);
+        void output(IF97parameters key, const double *T, const double *p, std::size_t n, double *out,
+                    IF97SIMD level = simd_level()) const{
+            /// out[i] = output(key, T[i], p[i]) for n points, with the derivatives from the lane kernels.
+            const std::size_t chunk = 64;
+            GibbsDerivatives d[chunk];
+            for (std::size_t i = 0; i < n; i += chunk){
+                const std::size_t m = std::min(chunk, n - i);
+                derivs(T + i, p + i, m, d, level);
+                for (std::size_t k = 0; k < m; ++k) out[i + k] = output(key, T[i + k], p[i + k], d[k]);
             }
-            return summer;
         }
-        double d2gammar_dPI2(double T, double p) const{
-            const double _PI = PIrterm(p), _TAU = TAUrterm(T);
-            double summer = 0;
-            for (std::size_t i = 0; i < Jr.size(); ++i){
-                summer += nr[i]*Ir[i]*(Ir[i]-1)*powi(_PI, Ir[i]-2)*powi(_TAU, Jr[i]);
-            }
-            return summer;
+        void fill(double T, double p, unsigned int mask, State &st) const{
+            /// Fills all properties selected in mask from a single Gibbs derivative sweep.
+            fill(T, p, mask, derivs(T, p), st);
         }
-        double dgammar_dTAU(double T, double p) const{
-            const double _PI = PIrterm(p), _TAU = TAUrterm(T);
-            double summer = 0;
-            for (std::size_t i = 0; i < Jr.size(); ++i){
-                summer += nr[i]*Jr[i]*powi(_PI, Ir[i])*powi(_TAU, Jr[i]-1);
-            }
-            return summer;
+        void fill(double T, double p, unsigned int mask, const GibbsDerivatives &d, State &st) const{
+            /// As fill(T, p, mask, st), from an already evaluated derivative bundle.
+            const double rho = rhomass(T, p, d);
+            if (mask & PROP_DMASS)  st.rhomass = rho;
+            if (mask & PROP_HMASS)  st.hmass = hmass(T, p, d);
+            if (mask & PROP_SMASS)  st.smass = smass(T, p, d);
+            if (mask & PROP_UMASS)  st.umass = umass(T, p, d);
+            if (mask & PROP_CPMASS) st.cpmass = cpmass(T, p, d);
+            if (mask & PROP_CVMASS) st.cvmass = cvmass(T, p, d);
+            if (mask & PROP_W)      st.speed_sound = speed_sound(T, p, d);
+            if (mask & PROP_DRHODP) st.drhodp = drhodp(T, p, d);
+            if (!(mask & (PROP_MU | PROP_K | PROP_PR))) return;
+            if (!(mask & (PROP_MU | PROP_PR))){ st.tcond = tcond(T, p, rho, d); return; }  // mu only if lambda2 needs it
+            // Transport properties share one viscosity evaluation
+            const double mu = visc(T, rho);
+            if (mask & PROP_MU)     st.visc = mu;
+            if (!(mask & (PROP_K | PROP_PR))) return;
+            const double k = tcond(T, p, rho, d, mu);
+            if (mask & PROP_K)      st.tcond = k;
+            if (mask & PROP_PR)     st.prandtl = mu*cpmass(T, p, d)*(1000/R_fact)/k;
         }
-        double d2gammar_dPIdTAU(double T, double p) const{
-            const double _PI = PIrterm(p), _TAU = TAUrterm(T);
-            double summer = 0;
-            for (std::size_t i = 0; i < Jr.size(); ++i){
-                summer += nr[i]*Jr[i]*Ir[i]*powi(_PI, Ir[i]-1)*powi(_TAU, Jr[i]-1);
-            }
-            return summer;
+        bool critical_enhancement(double T, double p, double rho, const GibbsDerivatives &d) const{
+            /// False where lambda2 is known to be zero, so that cp, cv and mu need not be formed.
+            return !negligible_enhancement(rho) && delChi(T, p, rho, d) >= DELCHI_MIN;
         }
-        double d2gammar_dTAU2(double T, double p) const {
-            const double _PI = PIrterm(p), _TAU = TAUrterm(T);
-            double summer = 0;
-            for (std::size_t i = 0; i < Jr.size(); ++i){
-                summer += nr[i]*Jr[i]*(Jr[i]-1)*powi(_PI, Ir[i])*powi(_TAU, Jr[i]-2);
-            }
-            return summer;
+
+    protected:
+        const RegionResidualElement *resid;         // Residual coefficient table, Nr terms
+        std::size_t Nr;
+        const RegionIdealElement *ideal;            // Ideal-gas coefficient table, N0 terms (none in Region 1)
+        std::size_t N0;
+        int Imin, Imax, Jmin, Jmax, J0min, J0max;   // Exponent spans for the power ladders
+        int Igapmax;                                // Largest PI exponent step between rows (or to the lowest row)
+        bool ladders;                               // Table is large enough for the power ladders (LADDER_MIN_TERMS)
+        SumKernel resid_kernel, ideal_kernel;       // Generated kernels (IF97_KERNELS), else 0
+        /// One outer Horner step over a PI gap g, folding in the next row's t, dt/dTAU and d2t/dTAU2.
+        static void horner_step(const PowerLadder &PIgap, int g, double t, double t_t, double t_tt,
+                                double &A, double &A_p, double &A_pp, double &B, double &B_p, double &C){
+            const double xg = PIgap[g], dxg = (g > 0) ? g*PIgap[g-1] : 0, d2xg = (g > 1) ? g*(g-1)*PIgap[g-2] : 0;
+            A_pp = d2xg*A + 2*dxg*A_p + xg*A_pp;
+            A_p  = dxg*A + xg*A_p;
+            A    = xg*A + t;
+            B_p  = dxg*B + xg*B_p;
+            B    = xg*B + t_t;
+            C    = xg*C + t_tt;
         }
-        double gamma0(double T, double p) const{
-            if (J0.size() == 0){ return 0; } // Region 1 has no term
-            const double PI = p/p_star, _TAU = TAU0term(T);
-            double summer = log(PI);
-            for (std::size_t i = 0; i < n0.size(); ++i){
-                summer += n0[i]*powi(_TAU, J0[i]);
+        /// Fills in the ideal-gas part of the Gibbs bundle (zero for Region 1, which has none).
+        void ideal_derivs(double T, double p, GibbsDerivatives &d) const{
+            d.gamma0 = d.dgamma0_dPI = d.d2gamma0_dPI2 = d.dgamma0_dTAU = d.d2gamma0_dTAU2 = 0;
+            if (N0 == 0){ return; }
+            const double PI = p/p_star, _TAU0 = TAU0term(T);
+            double g0[3] = {log(PI), 0, 0};
+            if (ideal_kernel) ideal_kernel(_TAU0, 0, g0);
+            else{
+                const PowerLadder TAU0pow(_TAU0, J0min-2, J0max);
+                for (std::size_t i = 0; i < N0; ++i){
+                    const int J = ideal[i].J;
+                    const double n = ideal[i].n;
+                    g0[0] += n*TAU0pow[J];
+                    g0[1] += n*J*TAU0pow[J-1];
+                    g0[2] += n*J*(J-1)*TAU0pow[J-2];
+                }
             }
-            return summer;
-        }
-        double dgamma0_dPI(double /*T*/, double p) const{
-            if (J0.size() == 0){ return 0; } // Region 1 has no term
-            const double PI = p/p_star;
-            return 1.0/PI;
-        }
-        double d2gamma0_dPI2(double /*T*/, double p) const{
-            if (J0.size() == 0){ return 0; } // Region 1 has no term
-            const double PI = p/p_star;
-            return -1.0/(PI*PI);
+            d.gamma0 = g0[0]; d.dgamma0_dPI = 1.0/PI; d.d2gamma0_dPI2 = -1.0/(PI*PI);
+            d.dgamma0_dTAU = g0[1]; d.d2gamma0_dTAU2 = g0[2];
         }
-        double dgamma0_dTAU(double T, double /*p*/) const{
-            const double _TAU = TAU0term(T);
-            double summer = 0;
-            for (std::size_t i = 0; i < J0.size(); ++i){
-                summer += n0[i]*J0[i]*powi(_TAU, J0[i]-1);
+#ifdef IF97_SIMD_X86
+        /// Lane kernel: derivs_termwise() and ideal_derivs() for L points at once, one point per lane
+        /// of a GCC vector.  The reduced variables and log(PI) are formed per lane; the ladders and all
+        /// table sums run across lanes, sharing each coefficient.  Compiled only inside the target
+        /// wrappers below, so the vector width matches the instruction set.
+        template<int L> __attribute__((always_inline)) inline void derivs_lanes(const double *T, const double *p, GibbsDerivatives *d) const{
+            typedef typename Lanes<L>::V V;
+            V x, y, y0, lnPI, zero;
+            for (int l = 0; l < L; ++l){
+                x[l] = PIrterm(p[l]); y[l] = TAUrterm(T[l]); zero[l] = 0.0;
+                y0[l] = (N0 > 0) ? TAU0term(T[l]) : 1.0; lnPI[l] = (N0 > 0) ? log(p[l]/p_star) : 0.0;
             }
-            return summer;
-        }
-        double d2gamma0_dTAU2(double T, double /*p*/) const{
-            const double _TAU = TAU0term(T);
-            double summer = 0;
-            for (std::size_t i = 0; i < J0.size(); ++i){
-                summer += n0[i]*J0[i]*(J0[i]-1)*powi(_TAU, J0[i]-2);
+            V PIpow[POWER_LADDER_MAX], TAUpow[POWER_LADDER_MAX];
+            const int Plo = std::min(Imin - 2, 0), Tlo = std::min(Jmin - 2, 0);
+            lane_ladder<L>(x, Plo, Imax, PIpow);
+            lane_ladder<L>(y, Tlo, Jmax, TAUpow);
+            V g = zero, g_p = zero, g_pp = zero, g_t = zero, g_tt = zero, g_pt = zero;
+            for (std::size_t i = 0; i < Nr; ++i){
+                const int I = resid[i].I - Plo, J = resid[i].J - Tlo;
+                const double n = resid[i].n, nI = n*resid[i].I;
+                const V nPI = n*PIpow[I], nIPIm1 = nI*PIpow[I-1];
+                g    += nPI*TAUpow[J];
+                g_p  += nIPIm1*TAUpow[J];
+                g_pp += nI*(resid[i].I - 1)*PIpow[I-2]*TAUpow[J];
+                g_t  += nPI*double(resid[i].J)*TAUpow[J-1];
+                g_tt += nPI*double(resid[i].J)*double(resid[i].J - 1)*TAUpow[J-2];
+                g_pt += nIPIm1*double(resid[i].J)*TAUpow[J-1];
             }
-            return summer;
-        }
-        double mu0(double T) const{
-            const double T_bar = T/Tcrit;
-            double summer = 0.0;
-            for (std::size_t i = 0; i < muJ0.size(); ++i){
-                summer += mun0[i]/powi(T_bar, muJ0[i]);
+            V g0 = lnPI, g0_t = zero, g0_tt = zero;
+            if (N0 > 0){
+                const int T0lo = std::min(J0min - 2, 0);
+                V TAU0pow[POWER_LADDER_MAX];
+                lane_ladder<L>(y0, T0lo, J0max, TAU0pow);
+                for (std::size_t i = 0; i < N0; ++i){
+                    const int J = ideal[i].J - T0lo;
+                    const double n = ideal[i].n;
+                    g0    += n*TAU0pow[J];
+                    g0_t  += n*ideal[i].J*TAU0pow[J-1];
+                    g0_tt += n*ideal[i].J*(ideal[i].J - 1)*TAU0pow[J-2];
+                }
             }
-            return 100.0*sqrt(T_bar)/summer;
-        }
-        double mu1(double T, double rho) const{
-            const double rho_bar = rho/Rhocrit;
-            double summer = 0.0;
-            for (std::size_t i = 0; i < muJr.size(); ++i){
-                summer += rho_bar * powi(Trterm(T),muIr[i]) * munr[i]*powi(Rhorterm(rho),muJr[i]);
+            for (int l = 0; l < L; ++l){
+                GibbsDerivatives &dl = d[l];
+                dl.gammar = g[l]; dl.dgammar_dPI = g_p[l]; dl.d2gammar_dPI2 = g_pp[l];
+                dl.dgammar_dTAU = g_t[l]; dl.d2gammar_dTAU2 = g_tt[l]; dl.d2gammar_dPIdTAU = g_pt[l];
+                if (N0 == 0){
+                    dl.gamma0 = dl.dgamma0_dPI = dl.d2gamma0_dPI2 = dl.dgamma0_dTAU = dl.d2gamma0_dTAU2 = 0;
+                    continue;
+                }
+                const double PI = p[l]/p_star;
+                dl.gamma0 = g0[l]; dl.dgamma0_dPI = 1.0/PI; dl.d2gamma0_dPI2 = -1.0/(PI*PI);
+                dl.dgamma0_dTAU = g0_t[l]; dl.d2gamma0_dTAU2 = g0_tt[l];
             }
-            return exp(summer);
         }
-        double lambda0(double T) const{
-            const double T_bar = T/Tcrit;
-            double summer = 0.0;
-            for (std::size_t i = 0; i < lamJ0.size(); ++i){
-                summer += lamn0[i]/powi(T_bar, lamJ0[i]);
-            }
-            return sqrt(T_bar)/summer;
+        __attribute__((target("avx2,fma"))) void derivs_avx2(const double *T, const double *p, GibbsDerivatives *d) const{
+            derivs_lanes<4>(T, p, d);
         }
-        double lambda1(double T, double rho) const{
-            const double rho_bar = rho/Rhocrit;
-            double summer = 0.0;
-            for (std::size_t i = 0; i < lamJr.size(); ++i){
-                summer += rho_bar * powi(Trterm(T),lamIr[i]) * lamnr[i]*powi(Rhorterm(rho),lamJr[i]);
-            }
-            return exp(summer);
+        __attribute__((target("avx512f,avx2,fma"))) void derivs_avx512(const double *T, const double *p, GibbsDerivatives *d) const{
+            derivs_lanes<8>(T, p, d);
         }
-        double lambda2(double T, double p, double rho) const{
-            double y, Cpbar, mubar, k, Z, delChi;
+#endif
+        double T_star, p_star;
+        const double R;
+
+        double delChi(double T, double p, double rho, const GibbsDerivatives &d) const{
+            const double Tr = 1.5*Tcrit;
+            return rho/Rhocrit*(Pcrit/Rhocrit*drhodp(T,p,d) - delTr(rho)*Tr/T);
+        }
+        double lambda2(double T, double p, double rho, const GibbsDerivatives &d, double mu) const{
+            double y, Cpbar, mubar, k, Z;
+            if (negligible_enhancement(rho)) return 0.0;
+            const double dchi = delChi(T, p, rho, d);
+            if (dchi < DELCHI_MIN) return 0.0;        /// Z = 0 here (see DELCHI_MIN); also covers delChi <= 0
             const double rhobar = rho/Rhocrit;
             const double LAMBDA = 177.8514;
             const double qD     = 1.0/0.40;
-            const double Tr     = 1.5*Tcrit;
             const double xi0    = 0.13;
             const double nu     = 0.630;
             const double gam    = 1.239;
             const double GAMMA0 = 0.06;
             const double PI     = 3.141592654;
             const double Cpstar = 0.46151805*R_fact;  /// Note: Slightly lower than IF97 Rgas
-            Cpbar = cpmass(T,p)/Cpstar;
-            if ((Cpbar < 0) || (Cpbar > 1.0E13)) Cpbar = 1.0E13;     /// Unit-less
-            k = cpmass(T,p)/cvmass(T,p);
-            mubar = visc(T,rho)/1.0E-6;
-            delChi = rhobar*(Pcrit/Rhocrit*drhodp(T,p) - delTr(rho)*Tr/T);
-            if (delChi > 0)                            /// At low (T,p), delChi can go negative, causing
-                y = qD*xi0*std::pow(delChi/GAMMA0,nu/gam);  ///   y to be imaginary from this nth-root equation.
-            else                                       ///   
-                y = 0.0;                               ///   Limit delChi to > 0, values.
+            y = qD*xi0*std::pow(dchi/GAMMA0,nu/gam);
             if (y < 1.2E-7)                            /// Z is not calculated if y < 1.2E-7 since the
-                Z = 0.0;                               ///   critical enhancement becomes insignificant.
-            else
-                Z = 2.0/PI/y*(((1.0-1.0/k)*atan(y)+y/k) - (1.0 - exp(-1.0/(1.0/y + y*y/(3.0*rhobar*rhobar)))));
+                return 0.0;                            ///   critical enhancement becomes insignificant.
+            const double Cpcalc = cpmass(T,p,d);
+            Cpbar = Cpcalc/Cpstar;
+            if ((Cpbar < 0) || (Cpbar > 1.0E13)) Cpbar = 1.0E13;     /// Unit-less
+            k = Cpcalc/cvmass(T,p,d);
+            mubar = mu/1.0E-6;
+            Z = 2.0/PI/y*(((1.0-1.0/k)*atan(y)+y/k) - (1.0 - exp(-1.0/(1.0/y + y*y/(3.0*rhobar*rhobar)))));
             return LAMBDA*rhobar*Cpbar*T/(Tcrit*mubar)*Z;
         }
-        double Trterm(double T) const{
-            return Tcrit/T - 1.0;
-        }
-        double Rhorterm(double rho) const{
-            return rho/Rhocrit - 1.0;
-        }
     };
     
 
     /********************************************************************************/
     /**************************       Region #1       *******************************/
     /********************************************************************************/
-    static const RegionResidualElement Region1residdata[] = {
+    alignas(64) static constexpr RegionResidualElement Region1residdata[] = {
         // Note: the coefficients of n_i have been multiplied by -1**I_i such that all Gibbs terms are of the form (PI-7.1)**(I_i) rather than (7.1-PI)**(I_i)
         {0, -2, 0.14632971213167},
         {0, -1, -0.84548187169114},
@@ -525,32 +973,31 @@ namespace IF97
         {31, -40, -1.8228094581404E-24},
         {32, -41, -9.3537087292458E-26}
     };
-    static const std::vector<RegionResidualElement> reg1rdata(Region1residdata, Region1residdata + sizeof(Region1residdata)/sizeof(RegionResidualElement));
-    static const std::vector<RegionIdealElement> reg10data;
     class Region1 : public BaseRegion
     {
     public:
-        Region1() : BaseRegion(reg1rdata, reg10data)  {
-            T_star = 1386; p_star = 16.53*p_fact; 
-        };    
-        double speed_sound(double T, double p) const{
+        constexpr Region1() : BaseRegion(Region1residdata, table_size(Region1residdata), 0, 0, 1386, 16.53*p_fact,
+                                         IF97_KERNEL(Region1residdata), 0) {}    
+        using BaseRegion::speed_sound;
+        using BaseRegion::cvmass;
+        using BaseRegion::drhodp;
+        double speed_sound(double T, double /*p*/, const GibbsDerivatives &d) const{
             // Evidently this formulation is special for some reason, and cannot be implemented using the base class formulation
 			// see Table 3
             const double tau = T_star/T;
-            const double RHS = powi(dgammar_dPI(T,p), 2)/(powi(dgammar_dPI(T,p)-tau*d2gammar_dPIdTAU(T,p), 2)/(tau*tau*d2gammar_dTAU2(T,p)) - d2gammar_dPI2(T, p));
+            const double RHS = powi(d.dgammar_dPI, 2)/(powi(d.dgammar_dPI-tau*d.d2gammar_dPIdTAU, 2)/(tau*tau*d.d2gammar_dTAU2) - d.d2gammar_dPI2);
             return sqrt(R*(1000/R_fact)*T*RHS);
         }
-        double cvmass(double T, double p) const{
+        double cvmass(double T, double /*p*/, const GibbsDerivatives &d) const{
             // Evidently this formulation is special for some reason, and cannot be implemented using the base class formulation
             // see Table 3
             const double tau = T_star / T;
-            return R*(-tau*tau*d2gammar_dTAU2(T,p) + powi(dgammar_dPI(T, p) - tau*d2gammar_dPIdTAU(T, p), 2) / d2gammar_dPI2(T, p));
+            return R*(-tau*tau*d.d2gammar_dTAU2 + powi(d.dgammar_dPI - tau*d.d2gammar_dPIdTAU, 2) / d.d2gammar_dPI2);
         }
-        double drhodp(double T, double p) const{
-            //double PI = p/p_star;
+        double drhodp(double T, double /*p*/, const GibbsDerivatives &d) const{
             /// This one is different as well...
             /// Derived from IAPWS Revised Advisory Note No. 3 (See Table 2, Section 4.1 & 4.2)
-            return -d2gammar_dPI2(T,p)/(powi(dgammar_dPI(T,p),2)*R*T)*(1000*R_fact/p_fact);
+            return -d.d2gammar_dPI2/(powi(d.dgammar_dPI,2)*R*T)*(1000*R_fact/p_fact);
         }
         double TAUrterm(double T) const{
             return T_star/T - 1.222;
@@ -567,7 +1014,7 @@ namespace IF97
     /********************************************************************************/
     /**************************       Region #2       *******************************/
     /********************************************************************************/
-    static const RegionResidualElement Region2residdata[] = {
+    alignas(64) static constexpr RegionResidualElement Region2residdata[] = {
         {1,0,-0.0017731742473213},
         {1,1,-0.017834862292358},
         {1,2,-0.045996013696365},
@@ -613,7 +1060,7 @@ namespace IF97
         {24,58,-9.436970724121E-07}
     };
 
-    static const RegionIdealElement Region2idealdata[] = {
+    alignas(64) static constexpr RegionIdealElement Region2idealdata[] = {
     {0, -0.96927686500217e1},
     {1, 0.10086655968018e2},
     {-5, -0.56087911283020e-2 },
@@ -624,14 +1071,11 @@ namespace IF97
     {2, -0.28408632460772},
     {3, 0.21268463753307e-1},
     };
-    static const std::vector<RegionResidualElement> reg2rdata(Region2residdata, Region2residdata + sizeof(Region2residdata)/sizeof(RegionResidualElement));
-    static const std::vector<RegionIdealElement> reg20data(Region2idealdata, Region2idealdata + sizeof(Region2idealdata)/sizeof(RegionIdealElement));
     class Region2 : public BaseRegion
     {
     public:
-        Region2() : BaseRegion(reg2rdata, reg20data)  {
-            T_star = 540; p_star = 1*p_fact; 
-        };
+        constexpr Region2() : BaseRegion(Region2residdata, table_size(Region2residdata), Region2idealdata, table_size(Region2idealdata),
+                                         540, 1*p_fact, IF97_KERNEL(Region2residdata), IF97_KERNEL(Region2idealdata)) {}
         double TAUrterm(double T) const{
             return T_star/T - 0.5;
         }
@@ -643,7 +1087,7 @@ namespace IF97
         }
     };
 
-    static const double Region23data[] = {
+    alignas(64) static constexpr double Region23data[] = {
     0.34805185628969e3,
     -0.11671859879975e1, 
     0.10192970039326e-2,
@@ -651,16 +1095,14 @@ namespace IF97
     0.13918839778870e2
     };
 
-    static const std::vector<double> region23_n(Region23data, Region23data + sizeof(Region23data)/sizeof(double));
-
     inline double Region23_T(double T){
         const double p_star = 1*p_fact, T_star = 1, theta = T/T_star;
-        const double PI = region23_n[0] + region23_n[1]*theta + region23_n[2]*theta*theta;
+        const double PI = Region23data[0] + Region23data[1]*theta + Region23data[2]*theta*theta;
         return PI*p_star;
     }
     inline double Region23_p(double p){
         const double p_star = 1*p_fact, T_star = 1, PI = p/p_star;
-        const double THETA = region23_n[3] + sqrt((PI - region23_n[4])/region23_n[2]);
+        const double THETA = Region23data[3] + sqrt((PI - Region23data[4])/Region23data[2]);
         return THETA*T_star;
     }
 
@@ -670,7 +1112,7 @@ namespace IF97
     /********************************************************************************/
 
     namespace Region3Backwards{
-        static const RegionResidualElement Region3Adata[] = {
+        alignas(64) static constexpr RegionResidualElement Region3Adata[] = {
         {-12, 5, 0.110879558823853e-2},
         {-12, 10, 0.572616740810616e3},
         {-12, 12, -0.767051948380852e5},
@@ -703,7 +1145,7 @@ namespace IF97
         {2, 2, 0.797441793901017e-1},
         };
 
-        static const RegionResidualElement Region3Bdata[] = {
+        alignas(64) static constexpr RegionResidualElement Region3Bdata[] = {
         {-12, 10, -0.827670470003621e-1},
         {-12, 12, 0.416887126010565e2},
         {-10, 8, 0.483651982197059e-1},
@@ -738,7 +1180,7 @@ namespace IF97
         {4, 1, 0.128369435967012},
         };
 
-        static const RegionResidualElement Region3Cdata[] = {
+        alignas(64) static constexpr RegionResidualElement Region3Cdata[] = {
         {-12, 6, 3.11967788763030},
         {-12, 8, 2.76713458847564e+04},
         {-12, 10, 3.22583103403269e+07},
@@ -776,7 +1218,7 @@ namespace IF97
         {8, 1, 4.38319858566475e-02},
         };
 
-        static const RegionResidualElement Region3Ddata[] = {
+        alignas(64) static constexpr RegionResidualElement Region3Ddata[] = {
         {-12, 4, -4.52484847171645e-10},
         {-12, 6, 3.15210389538801e-05},
         {-12, 7, -2.14991352047545e-03},
@@ -817,7 +1259,7 @@ namespace IF97
         {3, 0, 5.51478022765087e-03},
         };
 
-        static const RegionResidualElement Region3Edata[] = {
+        alignas(64) static constexpr RegionResidualElement Region3Edata[] = {
         {-12, 14, 7.15815808404721e+08},
         {-12, 16, -1.14328360753449e+11},
         {-10, 3, 3.76531002015720e-12},
@@ -849,7 +1291,7 @@ namespace IF97
         {2, 2, -3.41931835910405e+01},
         };
 
-        static const RegionResidualElement Region3Fdata[] = {
+        alignas(64) static constexpr RegionResidualElement Region3Fdata[] = {
         {0, -3, -2.51756547792325e-08},
         {0, -2, 6.01307193668763e-06},
         {0, -1, -1.00615977450049e-03},
@@ -894,7 +1336,7 @@ namespace IF97
         {32, -12, -4.86632965074563e-10},
         };
 
-        static const RegionResidualElement Region3Gdata[] = {
+        alignas(64) static constexpr RegionResidualElement Region3Gdata[] = {
         {-12, 7, 4.12209020652996e-05},
         {-12, 12, -1.14987238280587e+06},
         {-12, 14, 9.48180885032080e+09},
@@ -935,7 +1377,7 @@ namespace IF97
         {10, 6, -8.37513931798655e+15},
         };
 
-        static const RegionResidualElement Region3Hdata[] = {
+        alignas(64) static constexpr RegionResidualElement Region3Hdata[] = {
         {-12, 8, 5.61379678887577e-02},
         {-12, 12, 7.74135421587083e+09},
         {-10, 4, 1.11482975877938e-09},
@@ -967,7 +1409,7 @@ namespace IF97
         {1, 2, 2.49971752957491e+01},
         };
 
-        static const RegionResidualElement Region3Idata[] = {
+        alignas(64) static constexpr RegionResidualElement Region3Idata[] = {
         {0, 0, 1.06905684359136},
         {0, 1, -1.48620857922333},
         {0, 10, 2.59862256980408e+14},
@@ -1012,7 +1454,7 @@ namespace IF97
         {36, -8, 6.58110546759474e+01},
         };
 
-        static const RegionResidualElement Region3Jdata[] = {
+        alignas(64) static constexpr RegionResidualElement Region3Jdata[] = {
         {0, -1, -1.11371317395540e-04},
         {0, 0, 1.00342892423685},
         {0, 1, 5.30615581928979},
@@ -1044,7 +1486,7 @@ namespace IF97
         {28, -5, 2.70929002720228},
         };
 
-        static const RegionResidualElement Region3Kdata[] = {
+        alignas(64) static constexpr RegionResidualElement Region3Kdata[] = {
         {-2, 10, -4.01215699576099e+08},
         {-2, 12, 4.84501478318406e+10},
         {-1, -5, 3.94721471363678e-15},
@@ -1081,7 +1523,7 @@ namespace IF97
         {12, -10, 5.41449377329581e-09},
         };
 
-        static const RegionResidualElement Region3Ldata[] = {
+        alignas(64) static constexpr RegionResidualElement Region3Ldata[] = {
         {-12, 14, 2.60702058647537e+09},
         {-12, 16, -1.88277213604704e+14},
         {-12, 18, 5.54923870289667e+18},
@@ -1127,7 +1569,7 @@ namespace IF97
         {14, 10, 6.42794932373694e+32},
         };
 
-        static const RegionResidualElement Region3Mdata[] = {
+        alignas(64) static constexpr RegionResidualElement Region3Mdata[] = {
         {0, 0, 8.11384363481847e-01},
         {3, 0, -5.68199310990094e+03},
         {8, 0, -1.78657198172556e+10},
@@ -1170,7 +1612,7 @@ namespace IF97
         {24, 36, 4.79817895699239e+64},
         };
 
-        static const RegionResidualElement Region3Ndata[] = {
+        alignas(64) static constexpr RegionResidualElement Region3Ndata[] = {
         {0, -12, 2.80967799943151e-39},
         {3, -12, 6.14869006573609e-31},
         {4, -12, 5.82238667048942e-28},
@@ -1212,7 +1654,7 @@ namespace IF97
         {1, 6, 4.00849240129329e+14},
         };
 
-        static const RegionResidualElement Region3Odata[] = {
+        alignas(64) static constexpr RegionResidualElement Region3Odata[] = {
         {0, -12, 1.28746023979718e-35},
         {0, -4, -7.35234770382342e-12},
         {0, -1, 2.89078692149150e-03},
@@ -1239,7 +1681,7 @@ namespace IF97
         {24, -12, -5.16720236575302e-11},
         };
 
-        static const RegionResidualElement Region3Pdata[] = {
+        alignas(64) static constexpr RegionResidualElement Region3Pdata[] = {
         {0, -1, -9.82825342010366e-05},
         {0, 0, 1.05145700850612},
         {0, 1, 1.16033094095084e+02},
@@ -1269,7 +1711,7 @@ namespace IF97
         {36, -12, -3.45042834640005e-04},
         };
 
-        static const RegionResidualElement Region3Qdata[] = {
+        alignas(64) static constexpr RegionResidualElement Region3Qdata[] = {
         {-12, 10, -8.20433843259950e+04},
         {-12, 12, 4.73271518461586e+10},
         {-10, 6, -8.05950021005413e-02},
@@ -1296,7 +1738,7 @@ namespace IF97
         {1, 3, -3.19114969006533e+03},
         };
 
-        static const RegionResidualElement Region3Rdata[] = {
+        alignas(64) static constexpr RegionResidualElement Region3Rdata[] = {
         {-8, 6, 1.44165955660863e-03},
         {-8, 14, -7.01438599628258e+12},
         {-3, -3, -8.30946716459219e-17},
@@ -1326,7 +1768,7 @@ namespace IF97
         {14, -12, 3.77501980025469e-09},
         };
 
-        static const RegionResidualElement Region3Sdata[] = {
+        alignas(64) static constexpr RegionResidualElement Region3Sdata[] = {
         {-12, 20, -5.32466612140254e+22},
         {-12, 24, 1.00415480000824e+31},
         {-10, 22, -1.91540001821367e+29},
@@ -1358,7 +1800,7 @@ namespace IF97
         {14, 24, 9.50898170425042e+53},
         };
 
-        static const RegionResidualElement Region3Tdata[] = {
+        alignas(64) static constexpr RegionResidualElement Region3Tdata[] = {
         {0, 0, 1.55287249586268},
         {0, 1, 6.64235115009031},
         {0, 4, -2.89366236727210e+03},
@@ -1394,7 +1836,7 @@ namespace IF97
         {36, 36, -2.81396013562745e+76},
         };
 
-        static const RegionResidualElement Region3Udata[] = {
+        alignas(64) static constexpr RegionResidualElement Region3Udata[] = {
         {-12, 14, 1.22088349258355e+17},
         {-10, 10, 1.04216468608488e+09},
         {-10, 12, -8.82666931564652e+15},
@@ -1435,7 +1877,7 @@ namespace IF97
         {14, 6, -7.81754507698846e+27},
         };
 
-        static const RegionResidualElement Region3Vdata[] = {
+        alignas(64) static constexpr RegionResidualElement Region3Vdata[] = {
         {-10, -8, -4.15652812061591e-55},
         {-8, -12, 1.77441742924043e-61},
         {-6, -12, -3.57078668203377e-55},
@@ -1477,7 +1919,7 @@ namespace IF97
         {14, 1, 2.47761392329058e+26},
         };
 
-        static const RegionResidualElement Region3Wdata[] = {
+        alignas(64) static constexpr RegionResidualElement Region3Wdata[] = {
         {-12, 8, -5.86219133817016e-08},
         {-12, 14, -8.94460355005526e+10},
         {-10, -1, 5.31168037519774e-31},
@@ -1515,7 +1957,7 @@ namespace IF97
         {10, -8, 8.58133791857099e-06},
         };
 
-        static const RegionResidualElement Region3Xdata[] = {
+        alignas(64) static constexpr RegionResidualElement Region3Xdata[] = {
         {-8, 14, 3.77373741298151e+18},
         {-6, 10, -5.07100883722913e+12},
         {-5, 10, -1.03363225598860e+15},
@@ -1554,7 +1996,7 @@ namespace IF97
         {14, -6, 4.30867658061468e+06},
         };
 
-        static const RegionResidualElement Region3Ydata[] = {
+        alignas(64) static constexpr RegionResidualElement Region3Ydata[] = {
         {0, -3, -5.25597995024633e-10},
         {0, 1, 5.83441305228407e+03},
         {0, 5, -1.34778968457925e+16},
@@ -1577,7 +2019,7 @@ namespace IF97
         {12, -8, -8.28198594040141e+04},
         };
 
-        static const RegionResidualElement Region3Zdata[] = {
+        alignas(64) static constexpr RegionResidualElement Region3Zdata[] = {
         {-8, 3, 2.4400789229065e-11},
         {-6, 6, -4.6305743033124e+06},
         {-5, 6, 7.2880327477771e+09},
@@ -1605,268 +2047,269 @@ namespace IF97
 
         class Region3BackwardsRegion{
         protected:
-            double v_star, p_star, T_star, X_star, Y_star;
+            const RegionResidualElement *data;
             std::size_t N;
-            double a, b, c, d, e, f;
-            std::vector<int> I, J;
-            std::vector<double> n;
-        public:
-    
-            Region3BackwardsRegion(const RegionResidualElement data[], std::size_t N){
-                this->N = N;
+            double v_star, p_star, T_star;
+            double a, b;
+            int Imin, Imax, Jmin, Jmax;   // Exponent spans for the power ladders
+            SumKernel kernel;             // Generated kernel for this table (IF97_KERNELS), else 0
+            // Sum of n*x^I*y^J over the table
+            double sum(double x, double y) const{
+                double summer = 0;
+                if (kernel){ kernel(x, y, &summer); return summer; }
+                const PowerLadder Xpow(x, Imin, Imax), Ypow(y, Jmin, Jmax);
                 for (std::size_t i = 0; i < N; ++i){
-                    n.push_back(data[i].n);
-                    I.push_back(data[i].I);
-                    J.push_back(data[i].J);
+                    summer += data[i].n*Xpow[data[i].I]*Ypow[data[i].J];
                 }
+                return summer;
             }
-            virtual double v(double T, double p) const{
-                const double pi = p/p_star, theta = T/T_star;
+            // sum() with a fresh powi() per term, as it was formed before the power ladders
+            double sum_powi(double x, double y) const{
                 double summer = 0;
                 for (std::size_t i = 0; i < N; ++i){
-                    summer += n[i]*powi(std::pow(pi-a, c), I[i])*powi(std::pow(theta-b, d), J[i]);
+                    summer += data[i].n*powi(x, data[i].I)*powi(y, data[i].J);
                 }
-                return std::pow(summer, e)*v_star;
-            };
-
-            // This function piggybacks off of the Backwards structure already written
-            // for v(T,p) in Region 3. However, it can be used for the functions T(p,h) [Y=T, X=h] or
-            // T(p,s) [Y=T, X=s] in Regions 1, 2, or 3.  Additionally, it can be called for
-            // v(p,h) [Y=v, X=h] or v(p,s) [Y=v, X=s] in Region 3
-            virtual double Y(double p, double X) const{
-                const double pi = p/p_star, eta = X/X_star;
-                double summer = 0;
+                return summer;
+            }
+#ifdef IF97_SIMD_X86
+            // sum() for L points at once, one per lane; every lane shares each table coefficient
+            template<int L> __attribute__((always_inline)) inline void sum_lanes(const typename Lanes<L>::V &x, const typename Lanes<L>::V &y,
+                                                                              typename Lanes<L>::V &summer) const{
+                typedef typename Lanes<L>::V V;
+                V Xpow[POWER_LADDER_MAX], Ypow[POWER_LADDER_MAX];
+                for (int l = 0; l < L; ++l) summer[l] = 0.0;
+                const int Xlo = std::min(Imin, 0), Ylo = std::min(Jmin, 0);
+                lane_ladder<L>(x, Xlo, Imax, Xpow);
+                lane_ladder<L>(y, Ylo, Jmax, Ypow);
                 for (std::size_t i = 0; i < N; ++i){
-                    summer += n[i]*powi(std::pow(pi-a, c), I[i])*powi(std::pow(eta-b, d), J[i])*powi(f, J[i]);
+                    summer += data[i].n*Xpow[data[i].I - Xlo]*Ypow[data[i].J - Ylo];
                 }
-                return std::pow(summer, e)*Y_star;
-            };
-
-        };
-
-        class Region3a : public Region3BackwardsRegion{
-        public:
-            Region3a() : Region3BackwardsRegion(Region3Adata, 30){ 
-                v_star = 0.0024; p_star = 100*p_fact; T_star = 760; a = 0.085; b = 0.817; c = 1; d = 1; e = 1;
+            }
+#endif
+        public:
+    
+            template<std::size_t Nt>
+            constexpr Region3BackwardsRegion(const RegionResidualElement (&data)[Nt], SumKernel kernel,
+                                             double v_star, double p_star, double T_star, double a, double b)
+                : data(data), N(Nt), v_star(v_star), p_star(p_star), T_star(T_star), a(a), b(b),
+                  Imin(Imin_of(data, 0, Nt)), Imax(Imax_of(data, 0, Nt)), Jmin(Jmin_of(data, 0, Nt)), Jmax(Jmax_of(data, 0, Nt)),
+                  kernel(kernel) {}
+        };
+
+        // The exponents c, d and e of the v(T,p) equations, [IAPWS SR5-05(2016)] Tables 4 and 11, are
+        // template arguments, c = 1/Q and d = 1/R with Q, R = 1, 2 or 4, so that the roots reduce to
+        // nothing or to sqrt() and the outer power e = E to a multiplication.
+        template<int Q> inline double root(double x){
+            return (Q == 1) ? x : (Q == 2) ? std::sqrt(x) : (Q == 4) ? std::sqrt(std::sqrt(x)) : std::pow(x, 1.0/Q);
+        }
+        template<int E> inline double power(double x){
+            return (E == 1) ? x : (E == 4) ? (x*x)*(x*x) : powi(x, E);
+        }
+
+        template<int Q, int R, int E>
+        class Region3BackwardsSubregion : public Region3BackwardsRegion{
+        public:
+            template<std::size_t Nt>
+            constexpr Region3BackwardsSubregion(const RegionResidualElement (&data)[Nt], SumKernel kernel,
+                                                double v_star, double p_star, double T_star, double a, double b)
+                : Region3BackwardsRegion(data, kernel, v_star, p_star, T_star, a, b) {}
+            double v(double T, double p) const{
+                const double pi = p/p_star, theta = T/T_star;
+                return power<E>(sum(root<Q>(pi-a), root<R>(theta-b)))*v_star;
             };
+            /// Reference form of v() through sum_powi(); kept for verification and for timing the ladders against.
+            double v_powi(double T, double p) const{
+                const double pi = p/p_star, theta = T/T_star;
+                return power<E>(sum_powi(root<Q>(pi-a), root<R>(theta-b)))*v_star;
+            }
+#ifdef IF97_SIMD_X86
+            template<int L> __attribute__((always_inline)) inline void v_lanes(const double *T, const double *p, double *v) const{
+                typename Lanes<L>::V x, y, s;
+                for (int l = 0; l < L; ++l){ x[l] = root<Q>(p[l]/p_star-a); y[l] = root<R>(T[l]/T_star-b); }
+                this->template sum_lanes<L>(x, y, s);
+                for (int l = 0; l < L; ++l) v[l] = power<E>(s[l])*v_star;
+            }
+#endif
         };
-        class Region3b : public Region3BackwardsRegion{
+
+        class Region3a : public Region3BackwardsSubregion<1,1,1>{
         public:
-            Region3b() : Region3BackwardsRegion(Region3Bdata, 32){
-                v_star = 0.0041; p_star = 100*p_fact; T_star = 860; a = 0.280; b = 0.779; c = 1; d = 1; e = 1;
-            };
+            constexpr Region3a() : Region3BackwardsSubregion<1,1,1>(Region3Adata, IF97_KERNEL(Region3Adata), 0.0024, 100*p_fact, 760, 0.085, 0.817) {}
         };
-        class Region3c : public Region3BackwardsRegion{
+        class Region3b : public Region3BackwardsSubregion<1,1,1>{
         public:
-            Region3c() : Region3BackwardsRegion(Region3Cdata, 35){
-                v_star = 0.0022; p_star = 40*p_fact; T_star = 690; a = 0.259; b = 0.903; c = 1; d = 1; e = 1;
-            };
+            constexpr Region3b() : Region3BackwardsSubregion<1,1,1>(Region3Bdata, IF97_KERNEL(Region3Bdata), 0.0041, 100*p_fact, 860, 0.280, 0.779) {}
         };
-        class Region3d : public Region3BackwardsRegion{
+        class Region3c : public Region3BackwardsSubregion<1,1,1>{
         public:
-            Region3d() : Region3BackwardsRegion(Region3Ddata, 38){
-                v_star = 0.0029; p_star = 40*p_fact; T_star = 690; a = 0.559; b = 0.939; c = 1; d = 1; e = 4;
-            };
+            constexpr Region3c() : Region3BackwardsSubregion<1,1,1>(Region3Cdata, IF97_KERNEL(Region3Cdata), 0.0022, 40*p_fact, 690, 0.259, 0.903) {}
         };
-        class Region3e : public Region3BackwardsRegion{
+        class Region3d : public Region3BackwardsSubregion<1,1,4>{
         public:
-            Region3e() : Region3BackwardsRegion(Region3Edata, 29){
-                v_star = 0.0032; p_star = 40*p_fact; T_star = 710; a = 0.587; b = 0.918; c = 1; d = 1; e = 1;
-            };
+            constexpr Region3d() : Region3BackwardsSubregion<1,1,4>(Region3Ddata, IF97_KERNEL(Region3Ddata), 0.0029, 40*p_fact, 690, 0.559, 0.939) {}
         };
-        class Region3f : public Region3BackwardsRegion{
+        class Region3e : public Region3BackwardsSubregion<1,1,1>{
         public:
-            Region3f() : Region3BackwardsRegion(Region3Fdata, 42){
-                v_star = 0.0064; p_star = 40*p_fact; T_star = 730; a = 0.587; b = 0.891; c = 0.5; d = 1; e = 4;
-            };
+            constexpr Region3e() : Region3BackwardsSubregion<1,1,1>(Region3Edata, IF97_KERNEL(Region3Edata), 0.0032, 40*p_fact, 710, 0.587, 0.918) {}
         };
-        class Region3g : public Region3BackwardsRegion{
+        class Region3f : public Region3BackwardsSubregion<2,1,4>{
         public:
-            Region3g() : Region3BackwardsRegion(Region3Gdata, 38){
-                v_star = 0.0027; p_star = 25*p_fact; T_star = 660; a = 0.872; b = 0.971; c = 1; d = 1; e = 4;
-            };
+            constexpr Region3f() : Region3BackwardsSubregion<2,1,4>(Region3Fdata, IF97_KERNEL(Region3Fdata), 0.0064, 40*p_fact, 730, 0.587, 0.891) {}
         };
-        class Region3h : public Region3BackwardsRegion{
+        class Region3g : public Region3BackwardsSubregion<1,1,4>{
         public:
-            Region3h() : Region3BackwardsRegion(Region3Hdata, 29){
-                v_star = 0.0032; p_star = 25*p_fact; T_star = 660; a = 0.898; b = 0.983; c = 1; d = 1; e = 4;
-            };
+            constexpr Region3g() : Region3BackwardsSubregion<1,1,4>(Region3Gdata, IF97_KERNEL(Region3Gdata), 0.0027, 25*p_fact, 660, 0.872, 0.971) {}
         };
-        class Region3i : public Region3BackwardsRegion{
+        class Region3h : public Region3BackwardsSubregion<1,1,4>{
         public:
-            Region3i() : Region3BackwardsRegion(Region3Idata, 42){
-                v_star = 0.0041; p_star = 25*p_fact; T_star = 660; a = 0.910; b = 0.984; c = 0.5; d = 1; e = 4;
-            };
+            constexpr Region3h() : Region3BackwardsSubregion<1,1,4>(Region3Hdata, IF97_KERNEL(Region3Hdata), 0.0032, 25*p_fact, 660, 0.898, 0.983) {}
         };
-        class Region3j : public Region3BackwardsRegion{
+        class Region3i : public Region3BackwardsSubregion<2,1,4>{
         public:
-            Region3j() : Region3BackwardsRegion(Region3Jdata, 29){
-                v_star = 0.0054; p_star = 25*p_fact; T_star = 670; a = 0.875; b = 0.964; c = 0.5; d = 1; e = 4;
-            };
+            constexpr Region3i() : Region3BackwardsSubregion<2,1,4>(Region3Idata, IF97_KERNEL(Region3Idata), 0.0041, 25*p_fact, 660, 0.910, 0.984) {}
         };
-        class Region3k : public Region3BackwardsRegion{
+        class Region3j : public Region3BackwardsSubregion<2,1,4>{
         public:
-            Region3k() : Region3BackwardsRegion(Region3Kdata, 34){
-                v_star = 0.0077; p_star = 25*p_fact; T_star = 680; a = 0.802; b = 0.935; c = 1; d = 1; e = 1;
-            };
+            constexpr Region3j() : Region3BackwardsSubregion<2,1,4>(Region3Jdata, IF97_KERNEL(Region3Jdata), 0.0054, 25*p_fact, 670, 0.875, 0.964) {}
         };
-        class Region3l : public Region3BackwardsRegion{
+        class Region3k : public Region3BackwardsSubregion<1,1,1>{
         public:
-            Region3l() : Region3BackwardsRegion(Region3Ldata, 43){
-                v_star = 0.0026; p_star = 24*p_fact; T_star = 650; a = 0.908; b = 0.989; c = 1; d = 1; e = 4;
-            };
+            constexpr Region3k() : Region3BackwardsSubregion<1,1,1>(Region3Kdata, IF97_KERNEL(Region3Kdata), 0.0077, 25*p_fact, 680, 0.802, 0.935) {}
         };
-        class Region3m : public Region3BackwardsRegion{
+        class Region3l : public Region3BackwardsSubregion<1,1,4>{
         public:
-            Region3m() : Region3BackwardsRegion(Region3Mdata, 40){
-                v_star = 0.0028; p_star = 23*p_fact; T_star = 650; a = 1.0; b = 0.997; c = 1; d = 0.25; e = 1;
-            };
+            constexpr Region3l() : Region3BackwardsSubregion<1,1,4>(Region3Ldata, IF97_KERNEL(Region3Ldata), 0.0026, 24*p_fact, 650, 0.908, 0.989) {}
         };
-        class Region3n : public Region3BackwardsRegion{
+        class Region3m : public Region3BackwardsSubregion<1,4,1>{
         public:
-            Region3n() : Region3BackwardsRegion(Region3Ndata, 39){
-                v_star = 0.0031; p_star = 23*p_fact; T_star = 650; a = 0.976; b = 0.997;
-            };
+            constexpr Region3m() : Region3BackwardsSubregion<1,4,1>(Region3Mdata, IF97_KERNEL(Region3Mdata), 0.0028, 23*p_fact, 650, 1.0, 0.997) {}
+        };
+        class Region3n : public Region3BackwardsRegion{   // v/v* = exp(sum) in subregion 3n
+        public:
+            constexpr Region3n() : Region3BackwardsRegion(Region3Ndata, IF97_KERNEL(Region3Ndata), 0.0031, 23*p_fact, 650, 0.976, 0.997) {}
             double v(double T, double p) const{
                 const double pi = p/p_star, theta = T/T_star;
-                double summer = 0;
-                for (std::size_t i = 0; i < N; ++i){
-                    summer += n[i]*powi(pi-a, I[i])*powi(theta-b, J[i]);
-                }
-                return exp(summer)*v_star;
+                return exp(sum(pi-a, theta-b))*v_star;
             };
+#ifdef IF97_SIMD_X86
+            template<int L> __attribute__((always_inline)) inline void v_lanes(const double *T, const double *p, double *v) const{
+                typename Lanes<L>::V x, y, s;
+                for (int l = 0; l < L; ++l){ x[l] = p[l]/p_star-a; y[l] = T[l]/T_star-b; }
+                sum_lanes<L>(x, y, s);
+                for (int l = 0; l < L; ++l) v[l] = exp(s[l])*v_star;
+            }
+#endif
         };
-        class Region3o : public Region3BackwardsRegion{
+        class Region3o : public Region3BackwardsSubregion<2,1,1>{
         public:
-            Region3o() : Region3BackwardsRegion(Region3Odata, 24){
-                v_star = 0.0034; p_star = 23*p_fact; T_star = 650; a = 0.974; b = 0.996; c = 0.5; d = 1; e = 1;
-            };
+            constexpr Region3o() : Region3BackwardsSubregion<2,1,1>(Region3Odata, IF97_KERNEL(Region3Odata), 0.0034, 23*p_fact, 650, 0.974, 0.996) {}
         };
-        class Region3p : public Region3BackwardsRegion{
+        class Region3p : public Region3BackwardsSubregion<2,1,1>{
         public:
-            Region3p() : Region3BackwardsRegion(Region3Pdata, 27){
-                v_star = 0.0041; p_star = 23*p_fact; T_star = 650; a = 0.972; b = 0.997; c = 0.5; d = 1; e = 1;
-            };
+            constexpr Region3p() : Region3BackwardsSubregion<2,1,1>(Region3Pdata, IF97_KERNEL(Region3Pdata), 0.0041, 23*p_fact, 650, 0.972, 0.997) {}
         };
-        class Region3q : public Region3BackwardsRegion{
+        class Region3q : public Region3BackwardsSubregion<1,1,4>{
         public:
-            Region3q() : Region3BackwardsRegion(Region3Qdata, 24){
-                v_star = 0.0022; p_star = 23*p_fact; T_star = 650; a = 0.848; b = 0.983; c = 1; d = 1; e = 4;
-            };
+            constexpr Region3q() : Region3BackwardsSubregion<1,1,4>(Region3Qdata, IF97_KERNEL(Region3Qdata), 0.0022, 23*p_fact, 650, 0.848, 0.983) {}
         };
-        class Region3r : public Region3BackwardsRegion{
+        class Region3r : public Region3BackwardsSubregion<1,1,1>{
         public:
-            Region3r() : Region3BackwardsRegion(Region3Rdata, 27){
-                v_star = 0.0054; p_star = 23*p_fact; T_star = 650; a = 0.874; b = 0.982; c = 1; d = 1; e = 1;
-            };
+            constexpr Region3r() : Region3BackwardsSubregion<1,1,1>(Region3Rdata, IF97_KERNEL(Region3Rdata), 0.0054, 23*p_fact, 650, 0.874, 0.982) {}
         };
-        class Region3s : public Region3BackwardsRegion{
+        class Region3s : public Region3BackwardsSubregion<1,1,4>{
         public:
-            Region3s() : Region3BackwardsRegion(Region3Sdata, 29){
-                v_star = 0.0022; p_star = 21*p_fact; T_star = 640; a = 0.886; b = 0.990; c = 1; d = 1; e = 4;
-            };
+            constexpr Region3s() : Region3BackwardsSubregion<1,1,4>(Region3Sdata, IF97_KERNEL(Region3Sdata), 0.0022, 21*p_fact, 640, 0.886, 0.990) {}
         };
-        class Region3t : public Region3BackwardsRegion{
+        class Region3t : public Region3BackwardsSubregion<1,1,1>{
         public:
-            Region3t() : Region3BackwardsRegion(Region3Tdata, 33){
-                v_star = 0.0088; p_star = 20*p_fact; T_star = 650; a = 0.803; b = 1.02; c = 1; d = 1; e = 1;
-            };
+            constexpr Region3t() : Region3BackwardsSubregion<1,1,1>(Region3Tdata, IF97_KERNEL(Region3Tdata), 0.0088, 20*p_fact, 650, 0.803, 1.02) {}
         };
-        class Region3u : public Region3BackwardsRegion{
+        class Region3u : public Region3BackwardsSubregion<1,1,1>{
         public:
-            Region3u() : Region3BackwardsRegion(Region3Udata, 38){
-                v_star = 0.0026; p_star = 23*p_fact; T_star = 650; a = 0.902; b = 0.988; c = 1; d = 1; e = 1;
-            };
+            constexpr Region3u() : Region3BackwardsSubregion<1,1,1>(Region3Udata, IF97_KERNEL(Region3Udata), 0.0026, 23*p_fact, 650, 0.902, 0.988) {}
         };
-        class Region3v : public Region3BackwardsRegion{
+        class Region3v : public Region3BackwardsSubregion<1,1,1>{
         public:
-            Region3v() : Region3BackwardsRegion(Region3Vdata, 39){
-                v_star = 0.0031; p_star = 23*p_fact; T_star = 650; a = 0.960; b = 0.995; c = 1; d = 1; e = 1;
-            };
+            constexpr Region3v() : Region3BackwardsSubregion<1,1,1>(Region3Vdata, IF97_KERNEL(Region3Vdata), 0.0031, 23*p_fact, 650, 0.960, 0.995) {}
         };
-        class Region3w : public Region3BackwardsRegion{
+        class Region3w : public Region3BackwardsSubregion<1,1,4>{
         public:
-            Region3w() : Region3BackwardsRegion(Region3Wdata, 35){
-                v_star = 0.0039; p_star = 23*p_fact; T_star = 650; a = 0.959; b = 0.995; c = 1; d = 1; e = 4;
-            };
+            constexpr Region3w() : Region3BackwardsSubregion<1,1,4>(Region3Wdata, IF97_KERNEL(Region3Wdata), 0.0039, 23*p_fact, 650, 0.959, 0.995) {}
         };
-        class Region3x : public Region3BackwardsRegion{
+        class Region3x : public Region3BackwardsSubregion<1,1,1>{
         public:
-            Region3x() : Region3BackwardsRegion(Region3Xdata, 36){
-                v_star = 0.0049; p_star = 23*p_fact; T_star = 650; a = 0.910; b = 0.988; c = 1; d = 1; e = 1;
-            };
+            constexpr Region3x() : Region3BackwardsSubregion<1,1,1>(Region3Xdata, IF97_KERNEL(Region3Xdata), 0.0049, 23*p_fact, 650, 0.910, 0.988) {}
         };
-        class Region3y : public Region3BackwardsRegion{
+        class Region3y : public Region3BackwardsSubregion<1,1,4>{
         public:
-            Region3y() : Region3BackwardsRegion(Region3Ydata, 20){
-                v_star = 0.0031; p_star = 22*p_fact; T_star = 650; a = 0.996; b = 0.994; c = 1; d = 1; e = 4;
-            };
+            constexpr Region3y() : Region3BackwardsSubregion<1,1,4>(Region3Ydata, IF97_KERNEL(Region3Ydata), 0.0031, 22*p_fact, 650, 0.996, 0.994) {}
         };
-        class Region3z : public Region3BackwardsRegion{
+        class Region3z : public Region3BackwardsSubregion<1,1,4>{
         public:
-            Region3z() : Region3BackwardsRegion(Region3Zdata, 23){
-                v_star = 0.0038; p_star = 22*p_fact; T_star = 650; a = 0.993; b = 0.994; c = 1; d = 1; e = 4;
-            };
+            constexpr Region3z() : Region3BackwardsSubregion<1,1,4>(Region3Zdata, IF97_KERNEL(Region3Zdata), 0.0038, 22*p_fact, 650, 0.993, 0.994) {}
         };
 
+        template<class SubRegion> inline double Region3_v(double T, double p){
+            static constexpr SubRegion R{};
+            return R.v(T, p);
+        }
+        typedef double (*Region3vFunction)(double T, double p);
+
         inline double Region3_v_TP(char region, double T, double p){
-            static const Region3a R3a;
-            static const Region3b R3b;
-            static const Region3c R3c;
-            static const Region3d R3d;
-            static const Region3e R3e;
-            static const Region3f R3f;
-            static const Region3g R3g;
-            static const Region3h R3h;
-            static const Region3i R3i;
-            static const Region3j R3j;
-            static const Region3k R3k;
-            static const Region3l R3l;
-            static const Region3m R3m;
-            static const Region3n R3n;
-            static const Region3o R3o;
-            static const Region3p R3p;
-            static const Region3q R3q;
-            static const Region3r R3r;
-            static const Region3s R3s;
-            static const Region3t R3t;
-            static const Region3u R3u;
-            static const Region3v R3v;
-            static const Region3w R3w;
-            static const Region3x R3x;
-            static const Region3y R3y;
-            static const Region3z R3z;
+            // Dispatch on the subregion letter through a table, 'A'..'Z'
+            static constexpr Region3vFunction v[] = {
+                &Region3_v<Region3a>, &Region3_v<Region3b>, &Region3_v<Region3c>, &Region3_v<Region3d>, &Region3_v<Region3e>,
+                &Region3_v<Region3f>, &Region3_v<Region3g>, &Region3_v<Region3h>, &Region3_v<Region3i>, &Region3_v<Region3j>,
+                &Region3_v<Region3k>, &Region3_v<Region3l>, &Region3_v<Region3m>, &Region3_v<Region3n>, &Region3_v<Region3o>,
+                &Region3_v<Region3p>, &Region3_v<Region3q>, &Region3_v<Region3r>, &Region3_v<Region3s>, &Region3_v<Region3t>,
+                &Region3_v<Region3u>, &Region3_v<Region3v>, &Region3_v<Region3w>, &Region3_v<Region3x>, &Region3_v<Region3y>,
+                &Region3_v<Region3z>};
+            if (region < 'A' || region > 'Z') throw std::out_of_range("Unable to match region");
+            return v[region - 'A'](T, p);
+        }
 
-            switch(region){
-                case 'A': return R3a.v(T, p);
-                case 'B': return R3b.v(T, p);
-                case 'C': return R3c.v(T, p);
-                case 'D': return R3d.v(T, p);
-                case 'E': return R3e.v(T, p);
-                case 'F': return R3f.v(T, p);
-                case 'G': return R3g.v(T, p);
-                case 'H': return R3h.v(T, p);
-                case 'I': return R3i.v(T, p);
-                case 'J': return R3j.v(T, p);
-                case 'K': return R3k.v(T, p);
-                case 'L': return R3l.v(T, p);
-                case 'M': return R3m.v(T, p);
-                case 'N': return R3n.v(T, p);
-                case 'O': return R3o.v(T, p);
-                case 'P': return R3p.v(T, p);
-                case 'Q': return R3q.v(T, p);
-                case 'R': return R3r.v(T, p);
-                case 'S': return R3s.v(T, p);
-                case 'T': return R3t.v(T, p);
-                case 'U': return R3u.v(T, p);
-                case 'V': return R3v.v(T, p);
-                case 'W': return R3w.v(T, p);
-                case 'X': return R3x.v(T, p);
-                case 'Y': return R3y.v(T, p);
-                case 'Z': return R3z.v(T, p);
-                default:
-                    throw std::out_of_range("Unable to match region");
-            }
+#ifdef IF97_SIMD_X86
+        template<class SubRegion, int L> __attribute__((always_inline)) inline void Region3_v_lanes(const double *T, const double *p, double *v){
+            static constexpr SubRegion R{};
+            R.template v_lanes<L>(T, p, v);
+        }
+        template<class SubRegion> __attribute__((target("avx2,fma"))) void Region3_v_avx2(const double *T, const double *p, double *v){
+            Region3_v_lanes<SubRegion, 4>(T, p, v);
+        }
+        template<class SubRegion> __attribute__((target("avx512f,avx2,fma"))) void Region3_v_avx512(const double *T, const double *p, double *v){
+            Region3_v_lanes<SubRegion, 8>(T, p, v);
+        }
+        typedef void (*Region3vLanes)(const double *T, const double *p, double *v);
+#endif
+
+        inline void Region3_v_TP(char region, const double *T, const double *p, std::size_t n, double *v, IF97SIMD level = simd_level()){
+            // v(T,p) at n points that all lie in one subregion, so that the SIMD lanes share its
+            // coefficients; full groups of 8 or 4 points use the lane kernels, the rest Region3_v_TP().
+            if (region < 'A' || region > 'Z') throw std::out_of_range("Unable to match region");
+            std::size_t i = 0;
+#ifdef IF97_SIMD_X86
+            static constexpr Region3vLanes v4[] = {
+                &Region3_v_avx2<Region3a>, &Region3_v_avx2<Region3b>, &Region3_v_avx2<Region3c>, &Region3_v_avx2<Region3d>,
+                &Region3_v_avx2<Region3e>, &Region3_v_avx2<Region3f>, &Region3_v_avx2<Region3g>, &Region3_v_avx2<Region3h>,
+                &Region3_v_avx2<Region3i>, &Region3_v_avx2<Region3j>, &Region3_v_avx2<Region3k>, &Region3_v_avx2<Region3l>,
+                &Region3_v_avx2<Region3m>, &Region3_v_avx2<Region3n>, &Region3_v_avx2<Region3o>, &Region3_v_avx2<Region3p>,
+                &Region3_v_avx2<Region3q>, &Region3_v_avx2<Region3r>, &Region3_v_avx2<Region3s>, &Region3_v_avx2<Region3t>,
+                &Region3_v_avx2<Region3u>, &Region3_v_avx2<Region3v>, &Region3_v_avx2<Region3w>, &Region3_v_avx2<Region3x>,
+                &Region3_v_avx2<Region3y>, &Region3_v_avx2<Region3z>};
+            static constexpr Region3vLanes v8[] = {
+                &Region3_v_avx512<Region3a>, &Region3_v_avx512<Region3b>, &Region3_v_avx512<Region3c>, &Region3_v_avx512<Region3d>,
+                &Region3_v_avx512<Region3e>, &Region3_v_avx512<Region3f>, &Region3_v_avx512<Region3g>, &Region3_v_avx512<Region3h>,
+                &Region3_v_avx512<Region3i>, &Region3_v_avx512<Region3j>, &Region3_v_avx512<Region3k>, &Region3_v_avx512<Region3l>,
+                &Region3_v_avx512<Region3m>, &Region3_v_avx512<Region3n>, &Region3_v_avx512<Region3o>, &Region3_v_avx512<Region3p>,
+                &Region3_v_avx512<Region3q>, &Region3_v_avx512<Region3r>, &Region3_v_avx512<Region3s>, &Region3_v_avx512<Region3t>,
+                &Region3_v_avx512<Region3u>, &Region3_v_avx512<Region3v>, &Region3_v_avx512<Region3w>, &Region3_v_avx512<Region3x>,
+                &Region3_v_avx512<Region3y>, &Region3_v_avx512<Region3z>};
+            if (level >= SIMD_AVX512) for (; i + 8 <= n; i += 8) v8[region - 'A'](T + i, p + i, v + i);
+            if (level >= SIMD_AVX2)   for (; i + 4 <= n; i += 4) v4[region - 'A'](T + i, p + i, v + i);
+#else
+            (void)level;
+#endif
+            for (; i < n; ++i) v[i] = Region3_v_TP(region, T[i], p[i]);
         }
 
         struct DivisionElement{
@@ -1874,7 +2317,7 @@ namespace IF97
             double n;
         };
 
-        static const DivisionElement ABdata[] = {
+        alignas(64) static constexpr DivisionElement ABdata[] = {
         {0, 0.154793642129415e4},
         {1, -0.187661219490113e3},
         {2, 0.213144632222113e2},
@@ -1882,14 +2325,14 @@ namespace IF97
         {-2, 0.918419702359447e3},
         };
 
-        static const DivisionElement CDdata[] = {
+        alignas(64) static constexpr DivisionElement CDdata[] = {
         {0, 0.585276966696349e3},
         {1, 0.278233532206915e1},
         {2, -0.127283549295878e-1},
         {3, 0.159090746562729e-3}
         };
 
-        static const DivisionElement GHdata[] = {
+        alignas(64) static constexpr DivisionElement GHdata[] = {
         {0, -0.249284240900418e5},
         {1, 0.428143584791546e4},
         {2, -0.269029173140130e3},
@@ -1897,7 +2340,7 @@ namespace IF97
         {4, -0.787105249910383e-1},
         };
 
-        static const DivisionElement IJdata[] = {
+        alignas(64) static constexpr DivisionElement IJdata[] = {
         {0, 0.584814781649163e3},
         {1, -0.616179320924617},
         {2, 0.260763050899562},
@@ -1905,7 +2348,7 @@ namespace IF97
         {4, 0.515308185433082e-4},
         };
 
-        static const DivisionElement JKdata[] = {
+        alignas(64) static constexpr DivisionElement JKdata[] = {
         {0, 0.617229772068439e3},
         {1, -0.770600270141675e1},
         {2, 0.697072596851896},
@@ -1913,14 +2356,14 @@ namespace IF97
         {4, 0.137897492684194e-3},
         };
 
-        static const DivisionElement MNdata[] = {
+        alignas(64) static constexpr DivisionElement MNdata[] = {
         {0, 0.535339483742384e3},
         {1, 0.761978122720128e1},
         {2, -0.158365725441648},
         {3, 0.192871054508108e-2},
         };
 
-        static const DivisionElement OPdata[] = {
+        alignas(64) static constexpr DivisionElement OPdata[] = {
         {0, 0.969461372400213e3},
         {1, -0.332500170441278e3},
         {2, 0.642859598466067e2},
@@ -1928,28 +2371,28 @@ namespace IF97
         {-2, -0.152313732937084e4},
         };
 
-        static const DivisionElement QUdata[] = {
+        alignas(64) static constexpr DivisionElement QUdata[] = {
         {0, 0.565603648239126e3},
         {1, 0.529062258221222e1},
         {2, -0.102020639611016},
         {3, 0.122240301070145e-2},
         };
 
-        static const DivisionElement RXdata[] = {
+        alignas(64) static constexpr DivisionElement RXdata[] = {
         {0, 0.584561202520006e3},
         {1, -0.102961025163669e1},
         {2, 0.243293362700452},
         {3, -0.294905044740799e-2},
         };
 
-        static const DivisionElement UVdata[] = {
+        alignas(64) static constexpr DivisionElement UVdata[] = {
         {0, 0.528199646263062e3},
         {1, 0.890579602135307e1},
         {2, -0.222814134903755},
         {3, 0.286791682263697e-2},
         };
 
-        static const DivisionElement WXdata[] = {
+        alignas(64) static constexpr DivisionElement WXdata[] = {
         {0, 0.728052609145380e1},
         {1, 0.973505869861952e2},
         {2, 0.147370491183191e2},
@@ -1959,40 +2402,33 @@ namespace IF97
 
         class Region3RegionDivision{
         protected:
+            const DivisionElement *data;
             std::size_t N;
-            std::vector<int> I;
-            std::vector<double> n;
         public:
     
-            Region3RegionDivision(const DivisionElement data[], std::size_t N){
-                this->N = N;
-                for (std::size_t i = 0; i < N; ++i){
-                    n.push_back(data[i].n);
-                    I.push_back(data[i].I);
-                }
-            }
+            template<std::size_t Nt> constexpr Region3RegionDivision(const DivisionElement (&data)[Nt]) : data(data), N(Nt) {}
             virtual double T_p(double p) const{
                 const double pi = p/(1.0*p_fact);
                 double summer = 0;
                 for (std::size_t i = 0; i < N; ++i){
-                    summer += n[i]*powi(pi, I[i]);
+                    summer += data[i].n*powi(pi, data[i].I);
                 }
                 return summer*1.0;  // sum is multiplied by T* = 1.0 [K]
             };
         };
 
         class ABline : public Region3RegionDivision{ 
-            public: ABline() : Region3RegionDivision(ABdata, 5){ }; 
+            public: constexpr ABline() : Region3RegionDivision(ABdata) {} 
             virtual double T_p(double p) const{
                 const double pi = p/(1.0*p_fact), ln_pi = log(pi);
                 double summer = 0;
                 for (std::size_t i = 0; i < N; ++i){
-                    summer += n[i]*powi(ln_pi, I[i]);
+                    summer += data[i].n*powi(ln_pi, data[i].I);
                 }
                 return summer*1.0;  // sum is multiplied by T* = 1.0 [K]
             };
         };
-        class CDline : public Region3RegionDivision{ public: CDline() : Region3RegionDivision(CDdata, 4){ }; };
+        class CDline : public Region3RegionDivision{ public: constexpr CDline() : Region3RegionDivision(CDdata) {} };
         class EFline { 
         public:
             double T_p(double p) const{ 
@@ -2000,52 +2436,53 @@ namespace IF97
                 return 3.727888004*(pi - 22.064) + 647.096; 
             }; 
         };
-        class GHline : public Region3RegionDivision{ public: GHline() : Region3RegionDivision(GHdata, 5){ }; };
-        class IJline : public Region3RegionDivision{ public: IJline() : Region3RegionDivision(IJdata, 5){ }; };
-        class JKline : public Region3RegionDivision{ public: JKline() : Region3RegionDivision(JKdata, 5){ }; };
-        class MNline : public Region3RegionDivision{ public: MNline() : Region3RegionDivision(MNdata, 4){ }; };
+        class GHline : public Region3RegionDivision{ public: constexpr GHline() : Region3RegionDivision(GHdata) {} };
+        class IJline : public Region3RegionDivision{ public: constexpr IJline() : Region3RegionDivision(IJdata) {} };
+        class JKline : public Region3RegionDivision{ public: constexpr JKline() : Region3RegionDivision(JKdata) {} };
+        class MNline : public Region3RegionDivision{ public: constexpr MNline() : Region3RegionDivision(MNdata) {} };
         class OPline : public Region3RegionDivision{ 
         public: 
-            OPline() : Region3RegionDivision(OPdata, 5){ }; 
+            constexpr OPline() : Region3RegionDivision(OPdata) {} 
             virtual double T_p(double p) const{
                 const double pi = p/(1.0*p_fact), ln_pi = log(pi);
                 double summer = 0;
                 for (std::size_t i = 0; i < N; ++i){
-                    summer += n[i]*powi(ln_pi, I[i]);
+                    summer += data[i].n*powi(ln_pi, data[i].I);
                 }
                 return summer*1.0;  // sum is multiplied by T* = 1.0 [K]
             };
         };
-        class QUline : public Region3RegionDivision{ public: QUline() : Region3RegionDivision(QUdata, 4){ }; };
-        class RXline : public Region3RegionDivision{ public: RXline() : Region3RegionDivision(RXdata, 4){ }; };
-        class UVline : public Region3RegionDivision{ public: UVline() : Region3RegionDivision(UVdata, 4){ }; };
+        class QUline : public Region3RegionDivision{ public: constexpr QUline() : Region3RegionDivision(QUdata) {} };
+        class RXline : public Region3RegionDivision{ public: constexpr RXline() : Region3RegionDivision(RXdata) {} };
+        class UVline : public Region3RegionDivision{ public: constexpr UVline() : Region3RegionDivision(UVdata) {} };
         class WXline : public Region3RegionDivision{ 
-            public: WXline() : Region3RegionDivision(WXdata, 5){ }; 
+            public: constexpr WXline() : Region3RegionDivision(WXdata) {} 
             virtual double T_p(double p) const{
                 const double pi = p/(1.0*p_fact), ln_pi = log(pi);
                 double summer = 0;
                 for (std::size_t i = 0; i < N; ++i){
-                    summer += n[i]*powi(ln_pi, I[i]);
+                    summer += data[i].n*powi(ln_pi, data[i].I);
                 }
                 return summer*1.0;  // sum is multiplied by T* = 1.0 [K]
             };
         };
 
-        enum DividingLineEnum {LINE_AB, LINE_CD, LINE_EF, LINE_GH, LINE_IJ, LINE_JK, LINE_MN, LINE_OP, LINE_QU, LINE_RX, LINE_UV, LINE_WX};
+        enum DividingLineEnum {LINE_AB, LINE_CD, LINE_EF, LINE_GH, LINE_IJ, LINE_JK, LINE_MN, LINE_OP, LINE_QU, LINE_RX, LINE_UV, LINE_WX,
+                               LINE_SAT};   // LINE_SAT is the saturation line, Tsat97(p)
 
         inline double DividingLine(DividingLineEnum region, double p){
-            static const ABline AB;
-            static const CDline CD;
-            static const EFline EF;
-            static const GHline GH;
-            static const IJline IJ;
-            static const JKline JK;
-            static const MNline MN;
-            static const OPline OP;
-            static const QUline QU;
-            static const RXline RX;
-            static const UVline UV;
-            static const WXline WX;
+            static constexpr ABline AB{};
+            static constexpr CDline CD{};
+            static constexpr EFline EF{};
+            static constexpr GHline GH{};
+            static constexpr IJline IJ{};
+            static constexpr JKline JK{};
+            static constexpr MNline MN{};
+            static constexpr OPline OP{};
+            static constexpr QUline QU{};
+            static constexpr RXline RX{};
+            static constexpr UVline UV{};
+            static constexpr WXline WX{};
 
             switch(region){
                 case LINE_AB: return AB.T_p(p);
@@ -2060,130 +2497,81 @@ namespace IF97
                 case LINE_RX: return RX.T_p(p);
                 case LINE_UV: return UV.T_p(p);
                 case LINE_WX: return WX.T_p(p);
+                case LINE_SAT: return Tsat97(p);
                 default:
                     throw std::out_of_range("Unable to match dividing line");
             }
         }
-        // In the very near critical region, its messy
-        inline char BackwardsRegion3SubRegionDetermination(double T, double p){
-
-            if (p > 22.5*p_fact){
-               throw std::out_of_range("Out of range");
-            }
-            else if (22.11*p_fact < p && p <= 22.5*p_fact){
-                // Supercritical
-                if (DividingLine(LINE_QU, p) < T && T <= DividingLine(LINE_UV, p)){ return 'U';}
-                else if (DividingLine(LINE_UV, p) < T && T <= DividingLine(LINE_EF, p)){ return 'V';}
-                else if (DividingLine(LINE_EF, p) < T && T <= DividingLine(LINE_WX, p)){ return 'W';}
-                else if (DividingLine(LINE_WX, p) < T && T <= DividingLine(LINE_RX, p)){ return 'X';}
-                else {return '?';}
-            }
-            else if (22.064*p_fact < p && p <= 22.11*p_fact){
-                // Supercritical
-                if (DividingLine(LINE_QU, p) < T && T <= DividingLine(LINE_UV, p)){ return 'U';}
-                else if (DividingLine(LINE_UV, p) < T && T <= DividingLine(LINE_EF, p)){ return 'Y';}
-                else if (DividingLine(LINE_EF, p) < T && T <= DividingLine(LINE_WX, p)){ return 'Z';}
-                else if (DividingLine(LINE_WX, p) < T && T <= DividingLine(LINE_RX, p)){ return 'X';}
-                else {return '?';}
-            }
-            else if (T <= Tsat97(p)){
-                if (21.93161551*p_fact < p && p <= 22.064*p_fact){
-                    // Sub-critical
-                    if (DividingLine(LINE_QU, p) < T && T <= DividingLine(LINE_UV, p)){ return 'U';}
-                    else if (DividingLine(LINE_UV, p) < T ){ return 'Y';}
-                    else {return '?';}
-                }
-                else{
-                    return 'U';
-                }
-            }
-            else{
-                if (21.90096265*p_fact < p && p <= 22.064*p_fact){
-                    // Sub-critical
-                    if (T <= DividingLine(LINE_WX, p)){ return 'Z';}
-                    else if (DividingLine(LINE_WX, p) < T && T <= DividingLine(LINE_RX, p)){ return 'X';}
-                    else {return '?';}
-                }
-                else{
-                    return 'X';
-                }
-            }
+        // Pressure bands of the subregion map, [IAPWS SR5-05(2016)] Tables 2 and 10.  A band covers
+        // p_lo < p <= the p_lo of the band above it.  Its dividing lines are listed in increasing order
+        // of temperature, so the subregion is sub[k] for the first line k with T <= T_line[k], or
+        // sub[nlines] above the last line.  In the very near critical region, its messy.
+        struct Region3Band{
+            double p_lo;
+            int nlines;
+            DividingLineEnum line[7];
+            char sub[9];
+        };
+        alignas(64) static constexpr Region3Band Region3bands[] = {
+            {40*p_fact,                 1, {LINE_AB},                                                          "AB"},
+            {25*p_fact,                 3, {LINE_CD, LINE_AB, LINE_EF},                                        "CDEF"},
+            {23.5*p_fact,               5, {LINE_CD, LINE_GH, LINE_EF, LINE_IJ, LINE_JK},                      "CGHIJK"},
+            {23*p_fact,                 5, {LINE_CD, LINE_GH, LINE_EF, LINE_IJ, LINE_JK},                      "CLHIJK"},
+            {22.5*p_fact,               7, {LINE_CD, LINE_GH, LINE_MN, LINE_EF, LINE_OP, LINE_IJ, LINE_JK},    "CLMNOPJK"},
+            {22.11*p_fact,              7, {LINE_CD, LINE_QU, LINE_UV, LINE_EF, LINE_WX, LINE_RX, LINE_JK},    "CQUVWXRK"},   // Supercritical
+            {22.064*p_fact,             7, {LINE_CD, LINE_QU, LINE_UV, LINE_EF, LINE_WX, LINE_RX, LINE_JK},    "CQUYZXRK"},   // Supercritical
+            {21.93161551*p_fact,        7, {LINE_CD, LINE_QU, LINE_UV, LINE_SAT, LINE_WX, LINE_RX, LINE_JK},   "CQUYZXRK"},   // Sub-critical
+            {21.90096265*p_fact,        6, {LINE_CD, LINE_QU, LINE_SAT, LINE_WX, LINE_RX, LINE_JK},            "CQUZXRK"},
+            {21.04336732*p_fact,        5, {LINE_CD, LINE_QU, LINE_SAT, LINE_RX, LINE_JK},                     "CQUXRK"},
+            {20.5*p_fact,               3, {LINE_CD, LINE_SAT, LINE_JK},                                       "CSRK"},
+            {19.00881189173929*p_fact,  2, {LINE_CD, LINE_SAT},                                                "CST"},
+            {16.529164252604481*p_fact, 1, {LINE_SAT},                                                         "CT"},
+        };
+
+        inline const Region3Band *Region3BandOf(double p){
+            // Returns the band containing p, or 0 below the lowest band
+            if (p > 100*p_fact) throw std::out_of_range("pressure out of range");
+            for (std::size_t i = 0; i < table_size(Region3bands); ++i)
+                if (p > Region3bands[i].p_lo) return &Region3bands[i];
+            return 0;
         }
 
         inline char BackwardsRegion3RegionDetermination(double T, double p){
-            if (p > 100*p_fact){
-                throw std::out_of_range("pressure out of range");
-            }
-            else if (p > 40*p_fact && p <= 100*p_fact){
-                if (T <= DividingLine(LINE_AB, p)){ return 'A';}
-                else {return 'B';}
-            }
-            else if (p > 25*p_fact && p <= 40*p_fact){
-                if (T <= DividingLine(LINE_CD, p)){ return 'C';}
-                else if (DividingLine(LINE_CD, p) < T && T <= DividingLine(LINE_AB, p)){ return 'D';}
-                else if (DividingLine(LINE_AB, p) < T && T <= DividingLine(LINE_EF, p)){ return 'E';}
-                else {return 'F';}
-            }
-            else if (p > 23.5*p_fact && p <= 25*p_fact){
-                if (T <= DividingLine(LINE_CD, p)){ return 'C';}
-                else if (DividingLine(LINE_CD, p) < T && T <= DividingLine(LINE_GH, p)){ return 'G';}
-                else if (DividingLine(LINE_GH, p) < T && T <= DividingLine(LINE_EF, p)){ return 'H';}
-                else if (DividingLine(LINE_EF, p) < T && T <= DividingLine(LINE_IJ, p)){ return 'I';}
-                else if (DividingLine(LINE_IJ, p) < T && T <= DividingLine(LINE_JK, p)){ return 'J';}
-                else {return 'K';}
-            }
-            else if (p > 23*p_fact && p <= 23.5*p_fact){
-                if (T <= DividingLine(LINE_CD, p)){ return 'C';}
-                else if (DividingLine(LINE_CD, p) < T && T <= DividingLine(LINE_GH, p)){ return 'L';}
-                else if (DividingLine(LINE_GH, p) < T && T <= DividingLine(LINE_EF, p)){ return 'H';}
-                else if (DividingLine(LINE_EF, p) < T && T <= DividingLine(LINE_IJ, p)){ return 'I';}
-                else if (DividingLine(LINE_IJ, p) < T && T <= DividingLine(LINE_JK, p)){ return 'J';}
-                else {return 'K';}
-            }
-            else if (p > 22.5*p_fact && p <= 23*p_fact){
-                if (T <= DividingLine(LINE_CD, p)){ return 'C';}
-                else if (DividingLine(LINE_CD, p) < T && T <= DividingLine(LINE_GH, p)){ return 'L';}
-                else if (DividingLine(LINE_GH, p) < T && T <= DividingLine(LINE_MN, p)){ return 'M';}
-                else if (DividingLine(LINE_MN, p) < T && T <= DividingLine(LINE_EF, p)){ return 'N';}
-                else if (DividingLine(LINE_EF, p) < T && T <= DividingLine(LINE_OP, p)){ return 'O';}
-                else if (DividingLine(LINE_OP, p) < T && T <= DividingLine(LINE_IJ, p)){ return 'P';}
-                else if (DividingLine(LINE_IJ, p) < T && T <= DividingLine(LINE_JK, p)){ return 'J';}
-                else {return 'K';}
-            }
-            else if (p > 21.04336732*p_fact && p <= 22.5*p_fact){
-                if (T <= DividingLine(LINE_CD, p)){ return 'C';}
-                else if (DividingLine(LINE_CD, p) < T && T <= DividingLine(LINE_QU, p)){ return 'Q';}
-                else if (DividingLine(LINE_RX, p) < T && T <= DividingLine(LINE_JK, p)){ return 'R';}
-                else if (T > DividingLine(LINE_JK, p)){ return 'K';}
-                else{ return BackwardsRegion3SubRegionDetermination(T, p);}
-            }
-            else if (p > 20.5*p_fact && p <= 21.04336732*p_fact){
-                if (T <= DividingLine(LINE_CD, p)){ return 'C';}
-                else if (DividingLine(LINE_CD, p) < T && T <= Tsat97(p)){ return 'S';}
-                else if (Tsat97(p) < T && T <= DividingLine(LINE_JK, p)){ return 'R';}
-                else if (T > DividingLine(LINE_JK, p)){ return 'K';}
-                else{ return '?';}
-            }
-            else if (p > 19.00881189173929*p_fact && p <= 20.5*p_fact){
-                if (T <= DividingLine(LINE_CD, p)){ return 'C';}
-                else if (DividingLine(LINE_CD, p) < T && T <= Tsat97(p)){ return 'S';}
-                else if (Tsat97(p) < T){ return 'T';}
-                else{ return '?';}
-            }
-            else if (p > 16.529164252604481*p_fact && p <= 19.00881189173929*p_fact){
-                if (T <= Tsat97(p)){ return 'C';}
-                else{ return 'T';}
+            // Each dividing line of the band is evaluated at most once, and only up to the first
+            // one at or above T.
+            const Region3Band *band = Region3BandOf(p);
+            if (!band) return '?';
+            int k = 0;
+            while (k < band->nlines && T > DividingLine(band->line[k], p)) ++k;
+            return band->sub[k];
+        }
+
+        class Region3Isobar{
+            /// The subregion map along one isobar.  All dividing-line temperatures of the band are
+            /// evaluated once, on construction, so that many temperatures at the same pressure can be
+            /// classified, or their backward v(T,p) evaluated, without re-evaluating any line.
+        public:
+            explicit Region3Isobar(double p) : p(p), band(Region3BandOf(p)), T_line(){
+                if (band) for (int k = 0; k < band->nlines; ++k) T_line[k] = DividingLine(band->line[k], p);
             }
-            else{
-                return '?';
+            char subregion(double T) const{
+                if (!band) return '?';
+                int k = 0;
+                while (k < band->nlines && T > T_line[k]) ++k;
+                return band->sub[k];
             }
-        }
+            double v(double T) const{ return Region3_v_TP(subregion(T), T, p); }
+        private:
+            double p;
+            const Region3Band *band;
+            double T_line[7];
+        };
     } /* BackwardsRegion3 */
 
     /********************************************************************************/
     /**************************       Region #3       *******************************/
     /********************************************************************************/
-    static const RegionResidualElement Region3residdata[] = {
+    alignas(64) static constexpr RegionResidualElement Region3residdata[] = {
     {0, 0,    0.10658070028513e1},
     {0, 0,   -0.15732845290239e2},
     {0, 1,    0.20944396974307e2},
@@ -2226,281 +2614,433 @@ namespace IF97
     {11, 26, -0.44923899061815e-4},
     };
 
-    static const std::vector<RegionResidualElement> reg3rdata(Region3residdata, Region3residdata + sizeof(Region3residdata)/sizeof(RegionResidualElement));
-
-    class Region3
+    class Region3 : public Transport
     {
     protected:
-        std::vector<int> Ir, Jr;
-        std::vector<double> nr;
-        /// For Viscosity Calculations
-        std::vector<int> muJ0;
-        std::vector<double> mun0;
-        std::vector<int> muIr, muJr;
-        std::vector<double> munr;
-        /// For Thermal Conductivity Calculations
-        std::vector<int> lamJ0;
-        std::vector<double> lamn0;
-        std::vector<int> lamIr, lamJr;
-        std::vector<double> lamnr;
+        const RegionResidualElement *resid;   // Term 0 is the ln(delta) term, terms 1..39 the polynomial
+        int Imin, Imax, Jmin, Jmax;   // Exponent spans of terms 1..39 for the power ladders
+        SumKernel phi_kernel[kernels::R3_PARTS];   // Generated kernels for the phi sums (IF97_KERNELS), else 0
+        SumKernel derivs_kernel;                   // Generated kernel for the derivs() bundle (IF97_KERNELS), else 0
+        SumKernel ddelta_kernel;                   // Generated kernel for ddelta_derivs() (IF97_KERNELS), else 0
         double T_star, p_star, R;
     public:
-        Region3() : T_star(1000), p_star(1*p_fact) {
-            for (std::size_t i = 0; i < reg3rdata.size(); ++i){
-                nr.push_back(reg3rdata[i].n);
-                Ir.push_back(reg3rdata[i].I);
-                Jr.push_back(reg3rdata[i].J);
-            }
-            for (std::size_t i = 0; i < Hrdata.size(); ++i){
-                munr.push_back(Hrdata[i].n);
-                muIr.push_back(Hrdata[i].I);
-                muJr.push_back(Hrdata[i].J);
-            }
-            for (std::size_t i = 0; i < H0data.size(); ++i){
-                mun0.push_back(H0data[i].n);
-                muJ0.push_back(H0data[i].J);
-            }
-            for (std::size_t i = 0; i < Lrdata.size(); ++i){
-                lamnr.push_back(Lrdata[i].n);
-                lamIr.push_back(Lrdata[i].I);
-                lamJr.push_back(Lrdata[i].J);
+        constexpr Region3() : resid(Region3residdata),
+            Imin(Imin_of(Region3residdata, 1, table_size(Region3residdata))), Imax(Imax_of(Region3residdata, 1, table_size(Region3residdata))),
+            Jmin(Jmin_of(Region3residdata, 1, table_size(Region3residdata))), Jmax(Jmax_of(Region3residdata, 1, table_size(Region3residdata))),
+            phi_kernel{IF97_KERNEL(Region3residdata_phi), IF97_KERNEL(Region3residdata_dphi_ddelta),
+                       IF97_KERNEL(Region3residdata_d2phi_ddelta2), IF97_KERNEL(Region3residdata_delta_dphi_ddelta),
+                       IF97_KERNEL(Region3residdata_tau_dphi_dtau), IF97_KERNEL(Region3residdata_delta2_d2phi_ddelta2),
+                       IF97_KERNEL(Region3residdata_tau2_d2phi_dtau2), IF97_KERNEL(Region3residdata_deltatau_d2phi_ddelta_dtau)},
+            derivs_kernel(IF97_KERNEL(Region3residdata_derivs)), ddelta_kernel(IF97_KERNEL(Region3residdata_ddelta)), T_star(1000), p_star(1*p_fact), R(Rgas) {}
+        /// Evaluates phi and all of its reduced first and second delta/tau derivatives in a single
+        /// sweep over the coefficient table.  The caloric properties, drhodp and the conductivity
+        /// critical enhancement are all built from this bundle, so callers needing several of them
+        /// at the same (T,rho) should evaluate it once and pass it to the (T, rho, HelmholtzDerivatives)
+        /// overloads.  Each sum is formed exactly as in the single-derivative functions below.
+        HelmholtzDerivatives derivs(double T, double rho) const{
+            const double delta = rho/Rhocrit, tau = Tcrit/T;
+            double s[6] = {resid[0].n*log(delta), resid[0].n, -resid[0].n, 0, 0, 0};
+            if (derivs_kernel) derivs_kernel(delta, tau, s);
+            else{
+                const PowerLadder DELTApow(delta, Imin, Imax), TAUpow(tau, Jmin, Jmax);
+                for (std::size_t i = 1; i < 40; ++i){
+                    const int I = resid[i].I, J = resid[i].J;
+                    const double n = resid[i].n, dI = DELTApow[I], tJ = TAUpow[J];
+                    s[0] += n*dI*tJ;
+                    s[1] += n*I*dI*tJ;
+                    s[2] += n*I*(I-1)*dI*tJ;
+                    s[3] += n*J*dI*tJ;
+                    s[4] += n*J*(J-1)*dI*tJ;
+                    s[5] += n*J*I*dI*tJ;
+                }
             }
-            for (std::size_t i = 0; i < L0data.size(); ++i){
-                lamn0.push_back(L0data[i].n);
-                lamJ0.push_back(L0data[i].J);
+            const HelmholtzDerivatives d = {s[0], s[1], s[2], s[3], s[4], s[5]};
+            return d;
+        }
+        /// Reference form of derivs() with a fresh powi() per term, as the sums were formed before the
+        /// power ladders.  Kept for verification and for timing the ladders against.
+        HelmholtzDerivatives derivs_powi(double T, double rho) const{
+            const double delta = rho/Rhocrit, tau = Tcrit/T;
+            double s[6] = {resid[0].n*log(delta), resid[0].n, -resid[0].n, 0, 0, 0};
+            for (std::size_t i = 1; i < 40; ++i){
+                const int I = resid[i].I, J = resid[i].J;
+                const double n = resid[i].n, dI = powi(delta, I), tJ = powi(tau, J);
+                s[0] += n*dI*tJ;
+                s[1] += n*I*dI*tJ;
+                s[2] += n*I*(I-1)*dI*tJ;
+                s[3] += n*J*dI*tJ;
+                s[4] += n*J*(J-1)*dI*tJ;
+                s[5] += n*J*I*dI*tJ;
             }
-            R = Rgas;
-        };
+            const HelmholtzDerivatives d = {s[0], s[1], s[2], s[3], s[4], s[5]};
+            return d;
+        }
+        /// Evaluates the Helmholtz bundles d[0..n) at n (T,rho) points, full groups of 8 or 4 points
+        /// through the AVX-512 or AVX2 lane kernels up to the given level, the rest through derivs(T,rho).
+        void derivs(const double *T, const double *rho, std::size_t n, HelmholtzDerivatives *d, IF97SIMD level = simd_level()) const{
+            std::size_t i = 0;
+#ifdef IF97_SIMD_X86
+            if (level >= SIMD_AVX512) for (; i + 8 <= n; i += 8) derivs_avx512(T + i, rho + i, d + i);
+            if (level >= SIMD_AVX2)   for (; i + 4 <= n; i += 4) derivs_avx2(T + i, rho + i, d + i);
+#else
+            (void)level;
+#endif
+            for (; i < n; ++i) d[i] = derivs(T[i], rho[i]);
+        }
         double phi(double T, double rho) const{
             const double delta = rho/Rhocrit, tau = Tcrit/T;
-            double summer = nr[0]*log(delta);
+            double summer = resid[0].n*log(delta);
+            if (phi_kernel[kernels::R3_PHI]){ phi_kernel[kernels::R3_PHI](delta, tau, &summer); return summer; }
+            const PowerLadder DELTApow(delta, Imin, Imax), TAUpow(tau, Jmin, Jmax);
             for (std::size_t i = 1; i < 40; ++i){
-                summer += nr[i]*powi(delta, Ir[i])*powi(tau, Jr[i]);
+                summer += resid[i].n*DELTApow[resid[i].I]*TAUpow[resid[i].J];
             }
             return summer;
         };
-#ifdef REGION3_ITERATE
         //
-        // These two extra terms Needed to evaluate Newton-Raphson
+        // These extra terms are needed by the p(T,rho) = p density solvers
         // ****************************************************************************
         double dphi_ddelta(double T, double rho) const{
             const double delta = rho/Rhocrit, tau = Tcrit/T;
-            double summer = nr[0]/delta;
+            double summer = resid[0].n/delta;
+            if (phi_kernel[kernels::R3_DPHI_DDELTA]){ phi_kernel[kernels::R3_DPHI_DDELTA](delta, tau, &summer); return summer; }
+            const PowerLadder DELTApow(delta, Imin-1, Imax), TAUpow(tau, Jmin, Jmax);
             for (std::size_t i = 1; i < 40; ++i){
-                summer += nr[i]*Ir[i]*powi(delta, Ir[i]-1)*powi(tau, Jr[i]);
+                summer += resid[i].n*resid[i].I*DELTApow[resid[i].I-1]*TAUpow[resid[i].J];
             }
             return summer;
         };
         double d2phi_ddelta2(double T, double rho) const{
             const double delta = rho/Rhocrit, tau = Tcrit/T;
-            double summer = -nr[0]/(delta*delta);
+            double summer = -resid[0].n/(delta*delta);
+            if (phi_kernel[kernels::R3_D2PHI_DDELTA2]){ phi_kernel[kernels::R3_D2PHI_DDELTA2](delta, tau, &summer); return summer; }
+            const PowerLadder DELTApow(delta, Imin-2, Imax), TAUpow(tau, Jmin, Jmax);
             for (std::size_t i = 1; i < 40; ++i){
-                summer += nr[i]*Ir[i]*(Ir[i]-1.0)*powi(delta, Ir[i]-2)*powi(tau, Jr[i]);
+                summer += resid[i].n*resid[i].I*(resid[i].I-1.0)*DELTApow[resid[i].I-2]*TAUpow[resid[i].J];
             }
             return summer;
         };
+        void ddelta_derivs(double T, double rho, double out[3]) const{
+            /// dphi/ddelta, d²phi/ddelta² and d³phi/ddelta³ in a single sweep.  The first two are
+            /// formed exactly as in dphi_ddelta() and d2phi_ddelta2().
+            const double delta = rho/Rhocrit, tau = Tcrit/T;
+            out[0] = resid[0].n/delta;
+            out[1] = -resid[0].n/(delta*delta);
+            out[2] = 2.0*resid[0].n/(delta*delta*delta);
+            if (ddelta_kernel){ ddelta_kernel(delta, tau, out); return; }
+            const PowerLadder DELTApow(delta, Imin-3, Imax), TAUpow(tau, Jmin, Jmax);
+            double s0 = out[0], s1 = out[1], s2 = out[2];
+            for (std::size_t i = 1; i < 40; ++i){
+                const int I = resid[i].I;
+                const double n = resid[i].n, tJ = TAUpow[resid[i].J];
+                s0 += n*I*DELTApow[I-1]*tJ;
+                s1 += n*I*(I-1.0)*DELTApow[I-2]*tJ;
+                s2 += n*I*(I-1.0)*(I-2.0)*DELTApow[I-3]*tJ;
+            }
+            out[0] = s0; out[1] = s1; out[2] = s2;
+        };
         // ****************************************************************************
-#endif
         double delta_dphi_ddelta(double T, double rho) const{
             const double delta = rho/Rhocrit, tau = Tcrit/T;
-            double summer = nr[0];
+            double summer = resid[0].n;
+            if (phi_kernel[kernels::R3_DELTA_DPHI_DDELTA]){ phi_kernel[kernels::R3_DELTA_DPHI_DDELTA](delta, tau, &summer); return summer; }
+            const PowerLadder DELTApow(delta, Imin, Imax), TAUpow(tau, Jmin, Jmax);
             for (std::size_t i = 1; i < 40; ++i){
-                summer += nr[i]*Ir[i]*powi(delta, Ir[i])*powi(tau, Jr[i]);
+                summer += resid[i].n*resid[i].I*DELTApow[resid[i].I]*TAUpow[resid[i].J];
             }
             return summer;
         };
         double tau_dphi_dtau(double T, double rho) const{
             const double delta = rho/Rhocrit, tau = Tcrit/T;
             double summer = 0;
+            if (phi_kernel[kernels::R3_TAU_DPHI_DTAU]){ phi_kernel[kernels::R3_TAU_DPHI_DTAU](delta, tau, &summer); return summer; }
+            const PowerLadder DELTApow(delta, Imin, Imax), TAUpow(tau, Jmin, Jmax);
             for (std::size_t i = 1; i < 40; ++i){
-                summer += nr[i]*Jr[i]*powi(delta, Ir[i])*powi(tau, Jr[i]);
+                summer += resid[i].n*resid[i].J*DELTApow[resid[i].I]*TAUpow[resid[i].J];
             }
             return summer;
         };
         double delta2_d2phi_ddelta2(double T, double rho) const{
             const double delta = rho/Rhocrit, tau = Tcrit/T;
-            double summer = -nr[0];
+            double summer = -resid[0].n;
+            if (phi_kernel[kernels::R3_DELTA2_D2PHI_DDELTA2]){ phi_kernel[kernels::R3_DELTA2_D2PHI_DDELTA2](delta, tau, &summer); return summer; }
+            const PowerLadder DELTApow(delta, Imin, Imax), TAUpow(tau, Jmin, Jmax);
             for (std::size_t i = 1; i < 40; ++i){
-                summer += nr[i]*Ir[i]*(Ir[i]-1)*powi(delta, Ir[i])*powi(tau, Jr[i]);
+                summer += resid[i].n*resid[i].I*(resid[i].I-1)*DELTApow[resid[i].I]*TAUpow[resid[i].J];
             }
             return summer;
         };
         double tau2_d2phi_dtau2(double T, double rho) const{
             const double delta = rho/Rhocrit, tau = Tcrit/T;
             double summer = 0;
+            if (phi_kernel[kernels::R3_TAU2_D2PHI_DTAU2]){ phi_kernel[kernels::R3_TAU2_D2PHI_DTAU2](delta, tau, &summer); return summer; }
+            const PowerLadder DELTApow(delta, Imin, Imax), TAUpow(tau, Jmin, Jmax);
             for (std::size_t i = 1; i < 40; ++i){
-                summer += nr[i]*Jr[i]*(Jr[i]-1)*powi(delta, Ir[i])*powi(tau, Jr[i]);
+                summer += resid[i].n*resid[i].J*(resid[i].J-1)*DELTApow[resid[i].I]*TAUpow[resid[i].J];
             }
             return summer;
         };
         double deltatau_d2phi_ddelta_dtau(double T, double rho) const{
             const double delta = rho/Rhocrit, tau = Tcrit/T;
             double summer = 0;
+            if (phi_kernel[kernels::R3_DELTATAU_D2PHI_DDELTA_DTAU]){ phi_kernel[kernels::R3_DELTATAU_D2PHI_DDELTA_DTAU](delta, tau, &summer); return summer; }
+            const PowerLadder DELTApow(delta, Imin, Imax), TAUpow(tau, Jmin, Jmax);
             for (std::size_t i = 1; i < 40; ++i){
-                summer += nr[i]*Jr[i]*Ir[i]*powi(delta, Ir[i])*powi(tau, Jr[i]);
+                summer += resid[i].n*resid[i].J*resid[i].I*DELTApow[resid[i].I]*TAUpow[resid[i].J];
             }
             return summer;
         };
-        double mu0(double T) const{
-            const double T_bar = T/Tcrit;
-            double summer = 0.0;
-            for (std::size_t i = 0; i < muJ0.size(); ++i)
-            {
-                summer += mun0[i]/powi(T_bar, muJ0[i]);
-            }
-            return 100.0*sqrt(T_bar)/summer;
-        }
-        double mu1(double T, double rho) const{
-            const double rho_bar = rho/Rhocrit;
-            double summer = 0.0;
-            for (std::size_t i = 0; i < muJr.size(); ++i){
-                summer += rho_bar * powi(Trterm(T),muIr[i]) * munr[i]*powi(Rhorterm(rho),muJr[i]);
-            }
-            return exp(summer);
+        double lambda2(double T, double p, double rho) const{
+            if (negligible_enhancement(rho)) return 0.0;
+            const HelmholtzDerivatives d = derivs(T, rho);
+            return critical_enhancement(T, p, rho, d) ? lambda2(T, p, rho, d, visc(T, rho)) : 0.0;
         }
-        double lambda0(double T) const{
-            const double T_bar = T/Tcrit;
-            double summer = 0.0;
-            for (std::size_t i = 0; i < lamJ0.size(); ++i){
-                summer += lamn0[i]/powi(T_bar, lamJ0[i]);
-            }
-            return sqrt(T_bar)/summer;
+        bool critical_enhancement(double T, double p, double rho, const HelmholtzDerivatives &d) const{
+            /// False where lambda2 is known to be zero, so that cp, cv and mu need not be formed.
+            return !negligible_enhancement(rho) && delChi(T, p, rho, d) >= DELCHI_MIN;
         }
-        double lambda1(double T, double rho) const{
-            const double rho_bar = rho/Rhocrit;
-            double summer = 0.0;
-            for (std::size_t i = 0; i < lamJr.size(); ++i){
-                summer += rho_bar * powi(Trterm(T),lamIr[i]) * lamnr[i]*powi(Rhorterm(rho),lamJr[i]);
-            }
-            return exp(summer);
+        double delChi(double T, double /*p*/, double rho, const HelmholtzDerivatives &d) const{
+            const double Tr = 1.5*Tcrit;                             /// Dimensionless
+            double zeta = Pcrit/Rhocrit*drhodp(T,rho,d);             /// 
+            if ((zeta < 0) || (zeta > 1.0E13)) zeta = 1.0E13;
+            return rho/Rhocrit*(zeta - delTr(rho)*Tr/T);
         }
-        double lambda2(double T, double /*p*/, double rho) const{
-            double y, Cpbar, mubar, k, Z, zeta, delChi, Cpcalc;
+        double lambda2(double T, double p, double rho, const HelmholtzDerivatives &d, double mu) const{
+            double y, Cpbar, mubar, k, Z, Cpcalc;
+            if (negligible_enhancement(rho)) return 0.0;
+            const double dchi = delChi(T, p, rho, d);
+            if (dchi < DELCHI_MIN) return 0.0;   /// Z = 0 here (see DELCHI_MIN)
             const double rhobar = rho/Rhocrit;   /// Dimensionless
             const double LAMBDA = 177.8514;      /// Dimensionless
             const double qD     = 1.0/0.40;      /// 1/nm
-            const double Tr     = 1.5*Tcrit;     /// Dimensionless
             const double xi0    = 0.13;          /// nm
             const double nu     = 0.630;         /// Dimensionless
             const double gam    = 1.239;         /// Dimensionless
             const double GAMMA0 = 0.06;          /// Dimensionless
             const double PI     = 2*acos(0.0);   /// Have to define this in C++
             const double Cpstar = 0.46151805*R_fact;  /// Note: Slightly lower than IF97 Rgas  {J/kg-K}
-            Cpcalc = cpmass(T,rho);                                  /// J/kg-K
+            y = qD*xi0*std::pow(dchi/GAMMA0,nu/gam);
+            if (y < 1.2E-7) return 0.0;
+            Cpcalc = cpmass(T,rho,d);                                /// J/kg-K
             Cpbar = Cpcalc/Cpstar;                                   /// Unit-less
             if ((Cpbar < 0) || (Cpbar > 1.0E13)) Cpbar = 1.0E13;     /// Unit-less
-            k = Cpcalc/cvmass(T,rho);                                /// Unit-less
-            mubar = visc(T,rho)/1.0E-6;                              /// Unit-less
-            zeta = Pcrit/Rhocrit*drhodp(T,rho);                      /// 
-            if ((zeta < 0) || (zeta > 1.0E13)) zeta = 1.0E13;
-            delChi = rhobar*(zeta - delTr(rho)*Tr/T);
-            y = qD*xi0*std::pow(delChi/GAMMA0,nu/gam);
-            if (y < 1.2E-7) 
-                Z = 0.0;
-            else
-                Z = 2.0/(PI*y)*(((1.0-1.0/k)*atan(y)+y/k) - (1.0 - exp(-1.0/(1.0/y + y*y/(3.0*rhobar*rhobar)))));
+            k = Cpcalc/cvmass(T,rho,d);                              /// Unit-less
+            mubar = mu/1.0E-6;                                       /// Unit-less
+            Z = 2.0/(PI*y)*(((1.0-1.0/k)*atan(y)+y/k) - (1.0 - exp(-1.0/(1.0/y + y*y/(3.0*rhobar*rhobar)))));
             return LAMBDA*rhobar*Cpbar*T/(Tcrit*mubar)*Z;
         }
-        double Trterm(double T) const{
-            return Tcrit/T - 1.0;
-        }
-        double Rhorterm(double rho) const{
-            return rho/Rhocrit - 1.0;
-        }
         double p(double T, double rho) const{
             return rho*R*T*delta_dphi_ddelta(T, rho)*(p_fact/1000/R_fact);
         };
 
-#ifdef REGION3_ITERATE
         //
-        // Newton-Raphson Technique for solving p(T,rho) for rho
+        // Newton-Raphson and Halley Techniques for solving p(T,rho) for rho
         //    Solves to find root of p - rho*R*T*delta*dphi_ddelta = 0
-        //    The equation is rearranged to solve for rho and turned
-        //    into functions f(T,P,rho0) and f'(T,P,rho0) for the
-        //    Newton-Raphson technique.  Functions for
-        //    dphi/ddelta and d²phi/ddelta² were also required.  These
-        //    additional Taylor functions are defined above.
+        //    The equation is rearranged to solve for rho as
+        //        f(rho) = 1/rho² - R*T*dphi_ddelta/(p*rhoc) = 0
+        //    and f, f' and f" are all formed from one ddelta_derivs()
+        //    sweep per iteration.  Newton steps by f/f', Halley by
+        //    2ff'/(2f'² - ff").
         //
-        double f(double T, double p, double rho0) const{
-            return 1.0/(rho0*rho0) - R*T*dphi_ddelta(T, rho0)/(p*Rhocrit)*(p_fact/1000/R_fact);
-        };
-        double df(double T, double p, double rho0) const{
-            const double rho_c = 322.0, rho_c2 = rho_c*rho_c;
-            return -2.0/(rho0*rho0*rho0) - R*T*d2phi_ddelta2(T, rho0)/(p*rho_c2)*(p_fact/1000/R_fact);
-        };
+        double rhomass(double T, double p, double rho0, IF97R3SOLVER method, double tol, int max_iter, int &iter) const {
+            // Iterates until |1 - p(T,rho)/p| = rho²|f| <= tol; iter returns the number of steps taken
+            const double c = R*T/(p*Rhocrit)*(p_fact/1000/R_fact);
+            double d[3];
+            for (iter = 0; ; ++iter){
+                ddelta_derivs(T, rho0, d);
+                const double r2 = 1.0/(rho0*rho0);
+                const double f = r2 - c*d[0];
+                if (std::abs(f) <= tol*r2) return rho0;
+                // don't go more than max_iter iterations or throw an exception
+                if (iter == max_iter) throw std::logic_error("Failed to converge!");
+                const double df = -2.0*r2/rho0 - c*d[1]/Rhocrit;
+                if (method == R3_HALLEY){
+                    const double d2f = 6.0*r2*r2 - c*d[2]/(Rhocrit*Rhocrit);
+                    rho0 -= 2.0*f*df/(2.0*df*df - f*d2f);
+                }
+                else
+                    rho0 -= f/df;
+            }
+        }
         double rhomass(double T, double p, double rho0) const {
-            int iter = 100;
-            double f_T_p_rho0 = f(T,p,rho0);
-            while ( std::abs(f_T_p_rho0) > 1.0e-14 )
-            {
-                rho0 -= ( f_T_p_rho0/df(T,p,rho0) );
-                // don't go more than 100 iterations or throw an exception
-                if (--iter == 0) throw std::logic_error("Failed to converge!"); 
-                f_T_p_rho0 = f(T,p,rho0);
+            int iter;
+            const Region3Solver &solver = region3_solver();
+            return rhomass(T, p, rho0, solver.method == R3_HALLEY ? R3_HALLEY : R3_NEWTON, solver.tol, solver.max_iter, iter);
+        }
+#ifdef IF97_SIMD_X86
+        /// rhomass() iteration for L points at once.  Every lane takes the same steps as the scalar
+        /// solver and is frozen as soon as its own residual test passes; the sweep repeats until all
+        /// lanes have converged or max_iter is reached.  The TAU ladder is fixed, so it is built once.
+        /// Returns the mask of lanes that failed to converge.
+        template<int L> __attribute__((always_inline)) inline unsigned rhomass_lanes(const double *T, const double *p, double *rho,
+                                                                                  IF97R3SOLVER method, double tol, int max_iter) const{
+            typedef typename Lanes<L>::V V;
+            V c, tau, r;
+            for (int l = 0; l < L; ++l){
+                c[l] = R*T[l]/(p[l]*Rhocrit)*(p_fact/1000/R_fact); tau[l] = Tcrit/T[l]; r[l] = rho[l];
+            }
+            V TAUpow[POWER_LADDER_MAX], DELTApow[POWER_LADDER_MAX];
+            const int Tlo = std::min(Jmin, 0), Dlo = std::min(Imin - 3, 0);
+            lane_ladder<L>(tau, Tlo, Jmax, TAUpow);
+            const double n0 = resid[0].n;
+            unsigned active = (1u << L) - 1;
+            for (int iter = 0; ; ++iter){
+                const V delta = r/Rhocrit;
+                lane_ladder<L>(delta, Dlo, Imax, DELTApow);
+                V s0 = n0/delta, s1 = -n0/(delta*delta), s2 = 2.0*n0/(delta*delta*delta);
+                for (std::size_t i = 1; i < 40; ++i){
+                    const int I = resid[i].I - Dlo;
+                    const double n = resid[i].n, nI = n*resid[i].I;
+                    const V tJ = TAUpow[resid[i].J - Tlo];
+                    s0 += nI*DELTApow[I-1]*tJ;
+                    s1 += nI*(resid[i].I-1.0)*DELTApow[I-2]*tJ;
+                    s2 += nI*(resid[i].I-1.0)*(resid[i].I-2.0)*DELTApow[I-3]*tJ;
+                }
+                const V r2 = 1.0/(r*r), f = r2 - c*s0;
+                for (int l = 0; l < L; ++l)
+                    if (std::abs(f[l]) <= tol*r2[l]) active &= ~(1u << l);
+                if (!active || iter == max_iter) break;
+                const V df = -2.0*r2/r - c*s1/Rhocrit;
+                V step;
+                if (method == R3_HALLEY){
+                    const V d2f = 6.0*r2*r2 - c*s2/(Rhocrit*Rhocrit);
+                    step = 2.0*f*df/(2.0*df*df - f*d2f);
+                }
+                else
+                    step = f/df;
+                for (int l = 0; l < L; ++l)
+                    if (active & (1u << l)) r[l] -= step[l];
+            }
+            for (int l = 0; l < L; ++l) rho[l] = r[l];
+            return active;
+        }
+        /// Lane kernel of derivs(T,rho): the same six sums, with log(delta) formed per lane.
+        template<int L> __attribute__((always_inline)) inline void derivs_lanes(const double *T, const double *rho, HelmholtzDerivatives *d) const{
+            typedef typename Lanes<L>::V V;
+            V delta, tau, s[6];
+            for (int l = 0; l < L; ++l){
+                delta[l] = rho[l]/Rhocrit; tau[l] = Tcrit/T[l];
+                s[0][l] = resid[0].n*log(delta[l]); s[1][l] = resid[0].n; s[2][l] = -resid[0].n;
+                s[3][l] = s[4][l] = s[5][l] = 0.0;
+            }
+            V DELTApow[POWER_LADDER_MAX], TAUpow[POWER_LADDER_MAX];
+            const int Dlo = std::min(Imin, 0), Tlo = std::min(Jmin, 0);
+            lane_ladder<L>(delta, Dlo, Imax, DELTApow);
+            lane_ladder<L>(tau, Tlo, Jmax, TAUpow);
+            for (std::size_t i = 1; i < 40; ++i){
+                const int I = resid[i].I, J = resid[i].J;
+                const double n = resid[i].n;
+                const V dI = DELTApow[I - Dlo], tJ = TAUpow[J - Tlo];
+                s[0] += n*dI*tJ;
+                s[1] += double(n*I)*dI*tJ;
+                s[2] += double(n*I*(I-1))*dI*tJ;
+                s[3] += double(n*J)*dI*tJ;
+                s[4] += double(n*J*(J-1))*dI*tJ;
+                s[5] += double(n*J*I)*dI*tJ;
+            }
+            for (int l = 0; l < L; ++l){
+                const HelmholtzDerivatives dl = {s[0][l], s[1][l], s[2][l], s[3][l], s[4][l], s[5][l]};
+                d[l] = dl;
             }
-            return rho0;
         }
-        // END Newton-Raphson
+        __attribute__((target("avx2,fma"))) void derivs_avx2(const double *T, const double *rho, HelmholtzDerivatives *d) const{
+            derivs_lanes<4>(T, rho, d);
+        }
+        __attribute__((target("avx512f,avx2,fma"))) void derivs_avx512(const double *T, const double *rho, HelmholtzDerivatives *d) const{
+            derivs_lanes<8>(T, rho, d);
+        }
+        __attribute__((target("avx2,fma"))) unsigned rhomass_avx2(const double *T, const double *p, double *rho,
+                                                                   IF97R3SOLVER method, double tol, int max_iter) const{
+            return rhomass_lanes<4>(T, p, rho, method, tol, max_iter);
+        }
+        __attribute__((target("avx512f,avx2,fma"))) unsigned rhomass_avx512(const double *T, const double *p, double *rho,
+                                                                            IF97R3SOLVER method, double tol, int max_iter) const{
+            return rhomass_lanes<8>(T, p, rho, method, tol, max_iter);
+        }
+#endif
+        bool rho_chunk(char region, const double *T, const double *p, std::size_t m, double *rho,
+                       const Region3Solver &solver, IF97SIMD level) const{
+            /// One chunk of the batch rho_Tp(): m points of subregion region, SR5-05 guesses and then
+            /// the iteration, 8 or 4 lanes at a time.  Failed points are set to NaN; returns true if any.
+            Region3Backwards::Region3_v_TP(region, T, p, m, rho, level);
+            for (std::size_t k = 0; k < m; ++k) rho[k] = 1/rho[k];
+            if (solver.method == R3_DIRECT) return false;
+            bool any_failed = false;
+            std::size_t k = 0;
+#ifdef IF97_SIMD_X86
+            if (level >= SIMD_AVX512) for (; k + 8 <= m; k += 8){
+                const unsigned failed = rhomass_avx512(T + k, p + k, rho + k, solver.method, solver.tol, solver.max_iter);
+                for (int l = 0; l < 8; ++l) if (failed & (1u << l)) rho[k+l] = std::numeric_limits<double>::quiet_NaN();
+                any_failed |= (failed != 0);
+            }
+            if (level >= SIMD_AVX2) for (; k + 4 <= m; k += 4){
+                const unsigned failed = rhomass_avx2(T + k, p + k, rho + k, solver.method, solver.tol, solver.max_iter);
+                for (int l = 0; l < 4; ++l) if (failed & (1u << l)) rho[k+l] = std::numeric_limits<double>::quiet_NaN();
+                any_failed |= (failed != 0);
+            }
 #endif
+            for (; k < m; ++k){
+                int iter;
+                try{
+                    rho[k] = rhomass(T[k], p[k], rho[k], solver.method, solver.tol, solver.max_iter, iter);
+                }
+                catch (const std::logic_error &){
+                    rho[k] = std::numeric_limits<double>::quiet_NaN();
+                    any_failed = true;
+                }
+            }
+            return any_failed;
+        }
+        // END Newton-Raphson and Halley
 
-        double umass(double T, double rho) const{
-            return R*T*tau_dphi_dtau(T, rho);
+        double umass(double T, double rho) const{ return umass(T, rho, derivs(T, rho)); }
+        double smass(double T, double rho) const{ return smass(T, rho, derivs(T, rho)); }
+        double hmass(double T, double rho) const{ return hmass(T, rho, derivs(T, rho)); }
+        double cpmass(double T, double rho) const{ return cpmass(T, rho, derivs(T, rho)); }
+        double cvmass(double T, double rho) const{ return cvmass(T, rho, derivs(T, rho)); }
+        double speed_sound(double T, double rho) const{ return speed_sound(T, rho, derivs(T, rho)); }
+        double drhodp(double T, double rho) const{ return drhodp(T, rho, derivs(T, rho)); }
+        double umass(double T, double /*rho*/, const HelmholtzDerivatives &d) const{
+            return R*T*d.tau_dphi_dtau;
         };
-        double smass(double T, double rho) const{
-            return R*(tau_dphi_dtau(T, rho) - phi(T, rho));
+        double smass(double /*T*/, double /*rho*/, const HelmholtzDerivatives &d) const{
+            return R*(d.tau_dphi_dtau - d.phi);
         };
-        double hmass(double T, double rho) const{
-            return R*T*(tau_dphi_dtau(T, rho) + delta_dphi_ddelta(T, rho));
+        double hmass(double T, double /*rho*/, const HelmholtzDerivatives &d) const{
+            return R*T*(d.tau_dphi_dtau + d.delta_dphi_ddelta);
         };
-        double cpmass(double T, double rho) const{
-            return R*(-tau2_d2phi_dtau2(T, rho) + powi(delta_dphi_ddelta(T, rho) - deltatau_d2phi_ddelta_dtau(T, rho), 2)/(2*delta_dphi_ddelta(T, rho) + delta2_d2phi_ddelta2(T, rho)));
+        double cpmass(double /*T*/, double /*rho*/, const HelmholtzDerivatives &d) const{
+            return R*(-d.tau2_d2phi_dtau2 + powi(d.delta_dphi_ddelta - d.deltatau_d2phi_ddelta_dtau, 2)/(2*d.delta_dphi_ddelta + d.delta2_d2phi_ddelta2));
         };
-        double cvmass(double T, double rho) const{
-            return R*(-tau2_d2phi_dtau2(T, rho));
+        double cvmass(double /*T*/, double /*rho*/, const HelmholtzDerivatives &d) const{
+            return R*(-d.tau2_d2phi_dtau2);
         };
-        double speed_sound(double T, double rho) const{
-            const double RHS = 2*delta_dphi_ddelta(T, rho) + delta2_d2phi_ddelta2(T, rho)-powi(delta_dphi_ddelta(T,rho)-deltatau_d2phi_ddelta_dtau(T,rho),2)/tau2_d2phi_dtau2(T,rho);
+        double speed_sound(double T, double /*rho*/, const HelmholtzDerivatives &d) const{
+            const double RHS = 2*d.delta_dphi_ddelta + d.delta2_d2phi_ddelta2-powi(d.delta_dphi_ddelta-d.deltatau_d2phi_ddelta_dtau,2)/d.tau2_d2phi_dtau2;
             return sqrt(R*(1000/R_fact)*T*RHS);
         }
-        double visc(double T, double rho) const{
-            /// This base region function was not inherited 
-            const double mu_star = 1.0E-6; // Reference viscosity [Pa-s]
-            const double mu2 = 1.0;        // For Industrial Formulation (IF97), mu2 = 1.0
-            return mu_star * mu0(T) * mu1(T,rho) * mu2;
-        }
         double tcond(double T, double p, double rho) const{
+            return tcond(T, p, rho, derivs(T, rho));
+        }
+        double tcond(double T, double p, double rho, const HelmholtzDerivatives &d) const{
+            /// Viscosity only enters through lambda2, so it is skipped where that vanishes
+            return tcond(T, p, rho, d, critical_enhancement(T, p, rho, d) ? visc(T, rho) : 0.0);
+        }
+        double tcond(double T, double p, double rho, const HelmholtzDerivatives &d, double mu) const{
             /// This base region function was not inherited in Region3
             const double lambda_star = 0.001;
-            const double lambda_bar = lambda0(T)*lambda1(T,rho) + lambda2(T,p,rho);
+            const double lambda_bar = lambda0(T)*lambda1(T,rho) + lambda2(T,p,rho,d,mu);
             return lambda_star * lambda_bar;
         }
-        double drhodp(double T, double rho) const
+        double drhodp(double T, double rho, const HelmholtzDerivatives &d) const
         /// Derived from IAPWS Revised Advisory Note No. 3 (See Table 2, Section 3.1 & 3.3)
         /// NOTE: rho is passed in here, not p as it is in Regions 1, 2, & 5.  This is done
         ///       because p(T,rho) is a simple algebraic in Region 3, the Helmholz functions
         ///       are functions of (T,rho), and the work has already been done by the output()
         ///       function to convert p to rho @ T.
         {
-            return (rho/p(T,rho)) / ( 2.0 + delta2_d2phi_ddelta2(T,rho)/delta_dphi_ddelta(T,rho) );
-        }
-        double delTr(double rho) const{
-            /// This is the IF97 correlation for drhodp at the reducing temperature, Tr
-            const double rhobar = rho/Rhocrit;
-            double summer = 0;
-            int j;
-            //
-            if      (rhobar <= 0.310559006) j = 0;
-            else if (rhobar <= 0.776397516) j = 1;
-            else if (rhobar <= 1.242236025) j = 2;
-            else if (rhobar <= 1.863354037) j = 3;
-            else                            j = 4;
-            //
-            double pow_rhobar = 1.0;
-            for (int i=0; i < 6; ++i){
-                summer += A[i][j]*pow_rhobar;
-                pow_rhobar *= rhobar;
-            }
-            return 1.0/summer;
+            const double p = rho*R*T*d.delta_dphi_ddelta*(p_fact/1000/R_fact);   // p(T,rho) from the bundle
+            return (rho/p) / ( 2.0 + d.delta2_d2phi_ddelta2/d.delta_dphi_ddelta );
         }
         char SatSubRegionAdjust(IF97SatState State, double p, char subregion) const{
             switch(State)      // See if saturated state is requested
@@ -2550,8 +3090,9 @@ namespace IF97
             return subregion;  // in case no adjustment needs to be made
         };  // SatSubRegionAdjust
 
-        double output(IF97parameters key, double T, double p, IF97SatState State) const{
-            double rho;
+        double rho_Tp(double T, double p, IF97SatState State, const Region3Solver &solver, int &iter) const{
+            /// Density from the backward equations v(T,p) of IAPWS SR5-05, refined by the iterative
+            /// solver selected in solver.  iter returns the number of iterations taken (0 for R3_DIRECT).
             char region = Region3Backwards::BackwardsRegion3RegionDetermination(T, p);
 
             // if this is a saturated vapor or liquid function, make sure we're on
@@ -2559,14 +3100,132 @@ namespace IF97
             // calculating density.
             region = SatSubRegionAdjust(State, p, region);
 
-            rho = 1/Region3Backwards::Region3_v_TP(region, T, p);
+            double rho = 1/Region3Backwards::Region3_v_TP(region, T, p);
 
-#ifdef REGION3_ITERATE
-            // Use previous rho value from algebraic equations 
-            //      as an initial guess to solve rhomass iteratively 
-            //      with Newton-Raphson
-            rho = rhomass(T, p, rho);   
-#endif
+            iter = 0;
+            if (solver.method != R3_DIRECT)
+                // Use previous rho value from algebraic equations 
+                //      as an initial guess to solve rhomass iteratively
+                rho = rhomass(T, p, rho, solver.method, solver.tol, solver.max_iter, iter);
+            return rho;
+        }
+        double rho_Tp(double T, double p, IF97SatState State) const{
+            int iter;
+            return rho_Tp(T, p, State, region3_solver(), iter);
+        }
+        void rho_Tp(const double *T, const double *p, std::size_t n, double *rho, IF97STATUS *status,
+                    const Region3Solver &solver = region3_solver(), IF97SIMD level = simd_level()) const{
+            /// Densities at n Region 3 (T,p) points.  The points are grouped by subregion, so that the SIMD
+            /// lanes of the SR5-05 initial guess share one coefficient set, and each group of 8 or 4 is
+            /// then iterated together with per-lane convergence.  A point that fails to converge gets NaN
+            /// and STATUS_NO_CONVERGENCE in status[i]; with status null, std::logic_error is thrown instead.
+            // Stable counting sort of the point indices by subregion letter
+            std::vector<char> sub(n);
+            std::size_t start[27] = {0};
+            for (std::size_t i = 0; i < n; ++i){
+                sub[i] = Region3Backwards::BackwardsRegion3RegionDetermination(T[i], p[i]);
+                if (sub[i] < 'A' || sub[i] > 'Z') throw std::out_of_range("Unable to match region");
+                ++start[sub[i] - 'A' + 1];
+            }
+            for (int k = 0; k < 26; ++k) start[k+1] += start[k];
+            std::vector<std::size_t> order(n);
+            for (std::size_t i = 0; i < n; ++i) order[start[sub[i] - 'A']++] = i;
+            double Tg[CHUNK], pg[CHUNK], rg[CHUNK];
+            bool any_failed = false;
+            for (std::size_t b = 0; b < n; ){
+                // Gather up to one chunk of points from a single subregion
+                std::size_t e = b + 1;
+                while (e < n && e - b < CHUNK && sub[order[e]] == sub[order[b]]) ++e;
+                const std::size_t m = e - b;
+                for (std::size_t k = 0; k < m; ++k){ Tg[k] = T[order[b+k]]; pg[k] = p[order[b+k]]; }
+                any_failed |= rho_chunk(sub[order[b]], Tg, pg, m, rg, solver, level);
+                for (std::size_t j = 0; j < m; ++j) rho[order[b+j]] = rg[j];
+                b = e;
+            }
+            if (any_failed && !status) throw std::logic_error("Failed to converge!");
+            if (status) for (std::size_t i = 0; i < n; ++i) status[i] = (rho[i] == rho[i]) ? STATUS_OK : STATUS_NO_CONVERGENCE;
+        }
+        void rho_Tp(char region, const double *T, const double *p, std::size_t n, double *rho, IF97STATUS *status,
+                    const Region3Solver &solver = region3_solver(), IF97SIMD level = simd_level()) const{
+            /// As rho_Tp(T, p, n, ...), for points already known to lie in SR5-05 subregion region (an
+            /// upper-case letter).  The points are taken in chunks of CHUNK from the start, so a call
+            /// split at multiples of CHUNK gives the same results as the whole.
+            if (region < 'A' || region > 'Z') throw std::out_of_range("Unable to match region");
+            bool any_failed = false;
+            for (std::size_t i = 0; i < n; i += CHUNK)
+                any_failed |= rho_chunk(region, T + i, p + i, std::min(CHUNK, n - i), rho + i, solver, level);
+            if (any_failed && !status) throw std::logic_error("Failed to converge!");
+            if (status) for (std::size_t i = 0; i < n; ++i) status[i] = (rho[i] == rho[i]) ? STATUS_OK : STATUS_NO_CONVERGENCE;
+        }
+        /// Points per batch chunk; the SR5-05 guesses and the iteration run over one chunk at a time.
+        static constexpr std::size_t CHUNK = 64;
+
+        void fill(double T, double p, unsigned int mask, IF97SatState SatState, State &st,
+                  const Region3Solver &solver = region3_solver()) const{
+            /// Classifies the subregion and solves for density once, with the given solver settings,
+            /// then fills all properties selected in mask from that density and a single Helmholtz sweep.
+            int iter;
+            const double rho = rho_Tp(T, p, SatState, solver, iter);
+            // Only DMASS and MU can be had without phi
+            fill(T, p, rho, mask, (mask & ~(PROP_DMASS | PROP_MU)) ? derivs(T, rho) : HelmholtzDerivatives(), st);
+        }
+        void fill(double T, double p, double rho, unsigned int mask, const HelmholtzDerivatives &d, State &st) const{
+            /// As fill(T, p, mask, NONE, st), from an already solved density and derivative bundle
+            /// (which is not read if mask selects nothing beyond DMASS and MU).
+            if (mask & PROP_DMASS)  st.rhomass = rho;
+            const double mu = (mask & (PROP_MU | PROP_PR)) ? visc(T, rho) : 0;   // k alone needs mu only if lambda2 does
+            if (mask & PROP_MU)     st.visc = mu;
+            if (!(mask & ~(PROP_DMASS | PROP_MU))) return;   // Nothing below needs phi
+            if (mask & PROP_HMASS)  st.hmass = hmass(T, rho, d);
+            if (mask & PROP_SMASS)  st.smass = smass(T, rho, d);
+            if (mask & PROP_UMASS)  st.umass = umass(T, rho, d);
+            if (mask & PROP_CPMASS) st.cpmass = cpmass(T, rho, d);
+            if (mask & PROP_CVMASS) st.cvmass = cvmass(T, rho, d);
+            if (mask & PROP_W)      st.speed_sound = speed_sound(T, rho, d);
+            if (mask & PROP_DRHODP) st.drhodp = drhodp(T, rho, d);
+            if (!(mask & (PROP_K | PROP_PR))) return;
+            const double k = (mask & (PROP_MU | PROP_PR)) ? tcond(T, p, rho, d, mu) : tcond(T, p, rho, d);
+            if (mask & PROP_K)      st.tcond = k;
+            if (mask & PROP_PR)     st.prandtl = mu*cpmass(T, rho, d)*(1000/R_fact)/k;
+        }
+
+        double output(IF97parameters key, double T, double p, double rho, const HelmholtzDerivatives &d) const{
+            /// As output(key, T, p, NONE), from an already solved density and derivative bundle.
+            switch(key)
+            {
+                case IF97_DMASS: return rho;
+                case IF97_HMASS: return hmass(T, rho, d);
+                case IF97_SMASS: return smass(T, rho, d);
+                case IF97_UMASS: return umass(T, rho, d);
+                case IF97_CPMASS: return cpmass(T, rho, d);
+                case IF97_CVMASS: return cvmass(T, rho, d);
+                case IF97_W: return speed_sound(T, rho, d);
+                case IF97_MU: return visc(T,rho);
+                case IF97_K: return tcond(T,p,rho,d);
+                case IF97_DRHODP: return drhodp(T, rho, d);
+
+                default:
+                    throw std::invalid_argument("Bad key to output");
+            }
+        }
+        void output(IF97parameters key, const double *T, const double *p, std::size_t n, double *out, IF97STATUS *status = 0,
+                    IF97SIMD level = simd_level()) const{
+            /// out[i] = output(key, T[i], p[i], NONE) for n Region 3 points, with the densities from the
+            /// batch rho_Tp() and the Helmholtz bundles from the lane kernels.  Points that fail to
+            /// converge are NaN, see rho_Tp().
+            std::vector<double> rho(n);
+            rho_Tp(T, p, n, rho.empty() ? 0 : &rho[0], status, region3_solver(), level);
+            const std::size_t chunk = 64;
+            HelmholtzDerivatives d[chunk];
+            for (std::size_t i = 0; i < n; i += chunk){
+                const std::size_t m = std::min(chunk, n - i);
+                derivs(T + i, &rho[i], m, d, level);
+                for (std::size_t k = 0; k < m; ++k)
+                    out[i + k] = (rho[i + k] == rho[i + k]) ? output(key, T[i + k], p[i + k], rho[i + k], d[k]) : rho[i + k];
+            }
+        }
+        double output(IF97parameters key, double T, double p, IF97SatState State) const{
+            const double rho = rho_Tp(T, p, State);
             switch(key)                 // return all properties using the new rho value
             {
                 case IF97_DMASS: return rho;
@@ -2593,7 +3252,7 @@ namespace IF97
         int i;
         double n;
     };
-    static const SaturationElement sat[] = {
+    alignas(64) static constexpr SaturationElement sat[] = {
         {1,  0.11670521452767e4},
         {2, -0.72421316703206e6},
         {3, -0.17073846940092e2},
@@ -2605,20 +3264,15 @@ namespace IF97
         {9, -0.23855557567849},
         {10, 0.65017534844798e3},
     };
-    static const std::vector<SaturationElement> reg4data(sat, sat + sizeof(sat)/sizeof(SaturationElement));
     /// This "region" is the saturation curve
     class Region4
     {
     public:
-        std::vector<double> n;
+        double n[11];                 // n[1..10] from sat[], 1-based as in the IAPWS release
         double p_star, T_star;
 
-        Region4() : p_star(1.0*p_fact), T_star(1.0) {
-            n.resize(1); n[0] = 0;
-            for (std::size_t i = 0; i < reg4data.size(); ++i){
-                n.push_back(reg4data[i].n);
-            }
-        };
+        constexpr Region4() : n{0, sat[0].n, sat[1].n, sat[2].n, sat[3].n, sat[4].n, sat[5].n, sat[6].n, sat[7].n, sat[8].n, sat[9].n},
+                              p_star(1.0*p_fact), T_star(1.0) {}
         double p_T(double T) const{
             // Allow extrapolation down to Pmin = P(Tmin=273.15K) = 611.213 Pa
             if ( ( T < Tmin ) || ( T > Tcrit ) ){
@@ -2718,7 +3372,7 @@ namespace IF97
     /********************************************************************************/
     /**************************       Region #5       *******************************/
     /********************************************************************************/
-    static const RegionResidualElement Region5residdata[] = {
+    alignas(64) static constexpr RegionResidualElement Region5residdata[] = {
         {1, 1,  0.15736404855259e-2},
         {1, 2,  0.90153761673944e-3},
         {1, 3, -0.50270077677648e-2},
@@ -2726,7 +3380,7 @@ namespace IF97
         {2, 9, -0.41163275453471e-5},
         {3, 7,  0.37919454822955e-7}
     };
-    static const RegionIdealElement Region5idealdata[] = {
+    alignas(64) static constexpr RegionIdealElement Region5idealdata[] = {
         { 0, -0.13179983674201e2},
         { 1,  0.68540841634434e1},
         {-3, -0.24805148933466e-1},
@@ -2734,15 +3388,12 @@ namespace IF97
         {-1, -0.31161318213925e1},
         { 2, -0.32961626538917}
     };
-    static const std::vector<RegionResidualElement> reg5rdata(Region5residdata, Region5residdata + sizeof(Region5residdata)/sizeof(RegionResidualElement));
-    static const std::vector<RegionIdealElement> reg50data(Region5idealdata, Region5idealdata + sizeof(Region5idealdata)/sizeof(RegionIdealElement));
 
     class Region5 : public BaseRegion
     {
     public:
-        Region5() : BaseRegion(reg5rdata, reg50data)  {
-            T_star = 1000; p_star = 1*p_fact; 
-        };
+        constexpr Region5() : BaseRegion(Region5residdata, table_size(Region5residdata), Region5idealdata, table_size(Region5idealdata),
+                                         1000, 1*p_fact, IF97_KERNEL(Region5residdata), IF97_KERNEL(Region5idealdata)) {}
         double lambda2(double /*T*/, double /*p*/, double /*rho*/) const{
             return 0.0;  // No critical enhancement of thermal conductivity in Region 5
         }
@@ -2771,7 +3422,7 @@ namespace IF97
             double n; ///< The leading numerical constant
         };
 
-        static const BackwardRegionResidualElement Coeff1H[] = {
+        alignas(64) static constexpr BackwardRegionResidualElement Coeff1H[] = {
             {0,  0, -0.23872489924521E+03},
             {0,  1,  0.40421188637945E+03},
             {0,  2,  0.11349746881718E+03},
@@ -2794,7 +3445,7 @@ namespace IF97
             {6, 32, -0.15020185953503E-16}
         };
 
-        static const BackwardRegionResidualElement Coeff1S[] = {
+        alignas(64) static constexpr BackwardRegionResidualElement Coeff1S[] = {
             {0,  0,  0.17478268058307E+03},
             {0,  1,  0.34806930892873E+02},
             {0,  2,  0.65292584978455E+01},
@@ -2817,7 +3468,7 @@ namespace IF97
             {4, 32, -0.30732199903668E-30}
         };
 
-        static const BackwardRegionResidualElement Coeff1HS[] = {
+        alignas(64) static constexpr BackwardRegionResidualElement Coeff1HS[] = {
             {0,  0, -0.691997014660582E0},
             {0,  1, -0.183612548787560E2},
             {0,  2, -0.928332409297335E1},
@@ -2839,7 +3490,7 @@ namespace IF97
             {5,  0, -0.436407041874559E3}
         };
 
-        static const BackwardRegionResidualElement Coeff2aH[] = {
+        alignas(64) static constexpr BackwardRegionResidualElement Coeff2aH[] = {
             {0,  0,  0.10898952318288E+04},
             {0,  1,  0.84951654495535E+03},
             {0,  2, -0.10781748091826E+03},
@@ -2876,7 +3527,7 @@ namespace IF97
             {7, 28, -0.62459855192507E+02}
         };
 
-        static const BackwardRegionResidualElement Coeff2bH[] = {
+        alignas(64) static constexpr BackwardRegionResidualElement Coeff2bH[] = {
             {0,  0,  0.14895041079516E+04},
             {0,  1,  0.74307798314034E+03},
             {0,  2, -0.97708318797837E+02},
@@ -2917,7 +3568,7 @@ namespace IF97
             {9, 40,  0.86934156344163E-14}
         };
 
-        static const BackwardRegionResidualElement Coeff2cH[] = {
+        alignas(64) static constexpr BackwardRegionResidualElement Coeff2cH[] = {
             {-7,  0, -0.32368398555242E+13},
             {-7,  4,  0.73263350902181E+13},
             {-6,  0,  0.35825089945447E+12},
@@ -2943,7 +3594,7 @@ namespace IF97
             { 6, 22,  0.12918582991878E-02}
         };
 
-        static const BackwardRegionResidualElement Coeff2aS[] = {
+        alignas(64) static constexpr BackwardRegionResidualElement Coeff2aS[] = {
             {-1.50, -24, -0.39235983861984E+6},
             {-1.50, -23,  0.51526573827270E+6},
             {-1.50, -19,  0.40482443161048E+5},
@@ -2992,7 +3643,7 @@ namespace IF97
             { 1.50,  18, -0.82198102652018E-5}
         };
 
-        static const BackwardRegionResidualElement Coeff2bS[] = {
+        alignas(64) static constexpr BackwardRegionResidualElement Coeff2bS[] = {
             {-6,  0,  0.31687665083497E+6},
             {-6, 11,  0.20864175881858E+2},
             {-5,  0, -0.39859399803599E+6},
@@ -3039,7 +3690,7 @@ namespace IF97
             { 5,  2,  0.16409393674725E-8}
         };
 
-        static const BackwardRegionResidualElement Coeff2cS[] = {
+        alignas(64) static constexpr BackwardRegionResidualElement Coeff2cS[] = {
             {-2, 0,  0.90968501005365E+03},
             {-2, 1,  0.24045667088420E+04},
             {-1, 0, -0.59162326387130E+03},
@@ -3072,7 +3723,7 @@ namespace IF97
             { 7, 5, -0.16429828281347E-09}
         };
 
-        static const BackwardRegionResidualElement Coeff2aHS[] = {
+        alignas(64) static constexpr BackwardRegionResidualElement Coeff2aHS[] = {
             {0,  1, -0.182575361923032E-1},
             {0,  3, -0.125229548799536E+0},
             {0,  6,  0.592290437320145E+0},
@@ -3104,7 +3755,7 @@ namespace IF97
             {7,  1,  0.400645798472063E-1}
         };
 
-        static const BackwardRegionResidualElement Coeff2bHS[] = {
+        alignas(64) static constexpr BackwardRegionResidualElement Coeff2bHS[] = {
             { 0,  0,  0.801496989929495E-01},
             { 0,  1, -0.543862807146111E+00},
             { 0,  2,  0.337455597421283E+00},
@@ -3140,7 +3791,7 @@ namespace IF97
             {14, 16, -0.123651009018773E+15}
         };
 
-        static const BackwardRegionResidualElement Coeff2cHS[] = {
+        alignas(64) static constexpr BackwardRegionResidualElement Coeff2cHS[] = {
             { 0,  0,  0.112225607199012E+00},
             { 0,  1, -0.339005953606712E+01},
             { 0,  2, -0.320503911730094E+02},
@@ -3174,7 +3825,7 @@ namespace IF97
             {16, 10, -0.111754907323424E+16}
         };
 
-        static const BackwardRegionResidualElement Coeff3aH[] = {
+        alignas(64) static constexpr BackwardRegionResidualElement Coeff3aH[] = {
             {-12,  0, -0.133645667811215E-6},
             {-12,  1,  0.455912656802978E-5},
             {-12,  2, -0.146294640700979E-4},
@@ -3208,7 +3859,7 @@ namespace IF97
             { 12,  5, -0.133027883575669E-1}
         };
 
-        static const BackwardRegionResidualElement Coeff3bH[] = {
+        alignas(64) static constexpr BackwardRegionResidualElement Coeff3bH[] = {
             {-12,  0,  0.323254573644920E-4},
             {-12,  1, -0.127575556587181E-3},
             {-10,  0, -0.475851877356068E-3},
@@ -3244,7 +3895,7 @@ namespace IF97
             {  8,  1,  0.676682064330275E-2}
         };
 
-        static const BackwardRegionResidualElement Coeff3aS[] = {
+        alignas(64) static constexpr BackwardRegionResidualElement Coeff3aS[] = {
             {-12.00, 28,  0.150042008263875E+10},
             {-12.00, 32, -0.159397258480424E+12},
             {-10.00,  4,  0.502181140217975E-03},
@@ -3280,7 +3931,7 @@ namespace IF97
             { 10.00,  2,  0.123220024851555E-02}
         };
 
-        static const BackwardRegionResidualElement Coeff3bS[] = {
+        alignas(64) static constexpr BackwardRegionResidualElement Coeff3bS[] = {
             {-12,  1,  0.527111701601660E+00},
             {-12,  3, -0.401317830052742E+02},
             {-12,  4,  0.153020073134484E+03},
@@ -3311,7 +3962,7 @@ namespace IF97
             { 14,  2, -0.215095749182309E-04}
         };
 
-        static const BackwardRegionResidualElement Coeff3aHS[] = {
+        alignas(64) static constexpr BackwardRegionResidualElement Coeff3aHS[] = {
             { 0,  0,  0.770889828326934E01},
             { 0,  1, -0.260835009128688E02},
             { 0,  5,  0.267416218930389E03},
@@ -3347,7 +3998,7 @@ namespace IF97
             {32, 28,  0.377121605943324E41}
         };
 
-        static const BackwardRegionResidualElement Coeff3bHS[] = {
+        alignas(64) static constexpr BackwardRegionResidualElement Coeff3bHS[] = {
             {-12,  2,  0.125244360717979E-12},
             {-12, 10, -0.126599322553713E-01},
             {-12, 12,  0.506878030140626E+01},
@@ -3385,7 +4036,7 @@ namespace IF97
             { 14,  7,  0.568795808129714E+10}
         };
 
-        static const BackwardRegionResidualElement Coeffb14HS[] = {
+        alignas(64) static constexpr BackwardRegionResidualElement Coeffb14HS[] = {
             { 0, 14,  0.332171191705237E+0},
             { 0, 36,  0.611217706323496E-3},
             { 1,  3, -0.882092478906822E+1},
@@ -3415,7 +4066,7 @@ namespace IF97
             {32,  8,  0.655444787064505E+2}
         };
 
-        static const BackwardRegionResidualElement Coeffb3a4HS[] = {
+        alignas(64) static constexpr BackwardRegionResidualElement Coeffb3a4HS[] = {
             { 0,  1,  0.822673364673336E+0},
             { 0,  4,  0.181977213534479E+0},
             { 0, 10, -0.112000260313624E-1},
@@ -3437,7 +4088,7 @@ namespace IF97
             {32,  6,  0.631052532240980E+0}
         };
 
-        static const BackwardRegionResidualElement Coeffb2abHS[] = {
+        alignas(64) static constexpr BackwardRegionResidualElement Coeffb2abHS[] = {
             { 1,  8, -0.524581170928788E03},
             { 1, 24, -0.926947218142218E07},
             { 2,  4, -0.237385107491666E03},
@@ -3470,7 +4121,7 @@ namespace IF97
             {36, 28, -0.710971318427851E39}
         };
 
-        static const BackwardRegionResidualElement Coeffb2c3bHS[] = {
+        alignas(64) static constexpr BackwardRegionResidualElement Coeffb2c3bHS[] = {
             { 0,  0,  0.104351280732769E01},
             { 0,  3, -0.227807912708513E01},
             { 0,  4,  0.180535256723202E01},
@@ -3489,7 +4140,7 @@ namespace IF97
             {36, 20, -0.116994334851995E41}
         };
 
-        static const BackwardRegionResidualElement Coeffb13HS[] = {
+        alignas(64) static constexpr BackwardRegionResidualElement Coeffb13HS[] = {
             { 0,   0,  0.913965547600543E+00},
             { 1,  -2, -0.430944856041991E-04},
             { 1,   2,  0.603235694765419E+02},
@@ -3498,7 +4149,7 @@ namespace IF97
             { 6,  -3, -0.690815545851641E+02}
         };
 
-        static const BackwardRegionResidualElement CoeffTb23HS[] = {
+        alignas(64) static constexpr BackwardRegionResidualElement CoeffTb23HS[] = {
             {-12,  10,  0.629096260829810E-03},
             {-10,   8, -0.823453502583165E-03},
             { -8,   3,  0.515446951519474E-07},
@@ -3526,7 +4177,7 @@ namespace IF97
             { 14,  1,  0.783237062349385E+07}
         };
 
-        static const BackwardRegionResidualElement CoeffT4HS[] = {
+        alignas(64) static constexpr BackwardRegionResidualElement CoeffT4HS[] = {
             { 0,  0,  0.179882673606601E+00},
             { 0,  3, -0.267507455199603E+00},
             { 0, 12,  0.116276722612600E+01},
@@ -3567,21 +4218,103 @@ namespace IF97
 
         class BackwardsRegion{
         protected:
-            double p_star, X_star, T_star, h_star, s_star, s2_star;
+            const BackwardRegionResidualElement *data;
             std::size_t N;
+            double p_star, X_star, T_star, h_star, s_star, s2_star;
             double a, b, c, d, e, f;
-            std::vector<double> I, J;
-            std::vector<double> n;
+            int Imin, Imax, Jmin, Jmax;   // Exponent spans of the integer terms, for the power ladders
+            bool integral;                // All exponents are integers (all tables but Coeff2aS)
+            SumKernel kernel;             // Generated kernel for this table (IF97_KERNELS), else 0
+            // Sum of n*x^I*y^J over the table.  Integer exponents are read from power ladders;
+            // std::pow is left only for the fractional ones.
+            double sum(double x, double y) const{
+                double summer = 0;
+                if (kernel){ kernel(x, y, &summer); return summer; }
+                const PowerLadder Xpow(x, Imin, Imax), Ypow(y, Jmin, Jmax);
+                if (integral) for (std::size_t i = 0; i < N; ++i){
+                    summer += data[i].n*Xpow[int(data[i].I)]*Ypow[int(data[i].J)];
+                }
+                else{
+                    // Fractional powers are taken once per run of equal I (the tables are sorted by I)
+                    double XI = 0, Ilast = std::numeric_limits<double>::quiet_NaN();
+                    for (std::size_t i = 0; i < N; ++i){
+                        const int I = int(data[i].I), J = int(data[i].J);
+                        if (data[i].I != Ilast){ Ilast = data[i].I; XI = (I == Ilast) ? Xpow[I] : std::pow(x, Ilast); }
+                        summer += data[i].n*XI*(J == data[i].J ? Ypow[J] : std::pow(y, data[i].J));
+                    }
+                }
+                return summer;
+            }
+#ifdef IF97_SIMD_X86
+            // sum() for L points at once, one per lane; every lane shares each table coefficient
+            template<int L> __attribute__((always_inline)) inline void sum_lanes(const typename Lanes<L>::V &x, const typename Lanes<L>::V &y,
+                                                                              typename Lanes<L>::V &summer) const{
+                typedef typename Lanes<L>::V V;
+                V Xpow[POWER_LADDER_MAX], Ypow[POWER_LADDER_MAX];
+                for (int l = 0; l < L; ++l) summer[l] = 0.0;
+                const int Xlo = std::min(Imin, 0), Ylo = std::min(Jmin, 0);
+                lane_ladder<L>(x, Xlo, Imax, Xpow);
+                lane_ladder<L>(y, Ylo, Jmax, Ypow);
+                if (integral) for (std::size_t i = 0; i < N; ++i){
+                    summer += data[i].n*Xpow[int(data[i].I) - Xlo]*Ypow[int(data[i].J) - Ylo];
+                }
+                else{
+                    // Quarter-integer I exponents (Region 2a T(p,s)) are read from a ladder of x^(1/4),
+                    // other fractional ones taken with std::pow once per run of equal I
+                    V Qpow[POWER_LADDER_MAX], XI = summer;
+                    int Qlo = 0, Qhi = 0;
+                    for (std::size_t i = 0; i < N; ++i){
+                        const double q = 4*data[i].I;
+                        if (q == int(q)){ Qlo = std::min(Qlo, int(q)); Qhi = std::max(Qhi, int(q)); }
+                    }
+                    const bool quarters = (Qhi - Qlo < POWER_LADDER_MAX);
+                    if (quarters){
+                        V r;
+                        for (int l = 0; l < L; ++l) r[l] = std::sqrt(std::sqrt(x[l]));
+                        lane_ladder<L>(r, Qlo, Qhi, Qpow);
+                    }
+                    double Ilast = std::numeric_limits<double>::quiet_NaN();
+                    for (std::size_t i = 0; i < N; ++i){
+                        const int I = int(data[i].I), J = int(data[i].J);
+                        const double q = 4*data[i].I;
+                        V YJ;
+                        if (data[i].I != Ilast){
+                            Ilast = data[i].I;
+                            if (I == Ilast) XI = Xpow[I - Xlo];
+                            else if (quarters && (q == int(q))) XI = Qpow[int(q) - Qlo];
+                            else for (int l = 0; l < L; ++l) XI[l] = std::pow(x[l], Ilast);
+                        }
+                        if (J == data[i].J) YJ = Ypow[J - Ylo]; else for (int l = 0; l < L; ++l) YJ[l] = std::pow(y[l], data[i].J);
+                        summer += data[i].n*XI*YJ;
+                    }
+                }
+            }
+            template<int L> __attribute__((always_inline)) inline void T_pX_lanes(const double *p, const double *X, double *T) const{
+                typename Lanes<L>::V x, y, s;
+                for (int l = 0; l < L; ++l){ x[l] = p[l]/p_star + a; y[l] = (X[l]/X_star + b)*f; }
+                sum_lanes<L>(x, y, s);
+                for (int l = 0; l < L; ++l) T[l] = s[l]*T_star;
+            }
+            __attribute__((target("avx2,fma"))) void T_pX_avx2(const double *p, const double *X, double *T) const{
+                T_pX_lanes<4>(p, X, T);
+            }
+            __attribute__((target("avx512f,avx2,fma"))) void T_pX_avx512(const double *p, const double *X, double *T) const{
+                T_pX_lanes<8>(p, X, T);
+            }
+#endif
         public:
     
-            BackwardsRegion(const BackwardRegionResidualElement data[], std::size_t N){
-                this->N = N;
-                for (std::size_t i = 0; i < N; ++i){
-                    n.push_back(data[i].n);
-                    I.push_back(data[i].I);
-                    J.push_back(data[i].J);
-                }
-            };
+            // Each equation family reads only its own scales and shape constants and passes 0 for the
+            // rest: T(p,X) uses p_star, X_star, T_star, a, b, f; p(h,s) uses p_star, h_star, s_star, a, b, c;
+            // T(h,s) uses T_star, h_star, s_star, a, b; and h(s) uses h_star, s_star, s2_star, a..e.
+            template<std::size_t Nt>
+            constexpr BackwardsRegion(const BackwardRegionResidualElement (&data)[Nt], SumKernel kernel,
+                                      double p_star, double X_star, double T_star, double h_star, double s_star, double s2_star,
+                                      double a, double b, double c, double d, double e, double f)
+                : data(data), N(Nt), p_star(p_star), X_star(X_star), T_star(T_star), h_star(h_star), s_star(s_star), s2_star(s2_star),
+                  a(a), b(b), c(c), d(d), e(e), f(f),
+                  Imin(Imin_of(data, 0, Nt)), Imax(Imax_of(data, 0, Nt)), Jmin(Jmin_of(data, 0, Nt)), Jmax(Jmax_of(data, 0, Nt)),
+                  integral(integral_of(data, 0, Nt)), kernel(kernel) {}
 
             // This function imitates the Region3BackwardsRegion structure already written above
             // for v(T,p) in Region 3. However, it can be used for the functions T(p,h) [Y=T, X=h] or
@@ -3591,22 +4324,28 @@ namespace IF97
             // process by evaluating v(T,p) using T(p,X) and the p value supplied.
             virtual double T_pX(double p, double X) const{
                 const double pi = p/p_star, eta = X/X_star;
-                double summer = 0;
-                for (std::size_t i = 0; i < N; ++i){
-                    summer += n[i]*std::pow(pi+a, I[i])*std::pow(eta+b, J[i])*std::pow(f, J[i]);
-                }
-                return summer*T_star;
+                return sum(pi+a, (eta+b)*f)*T_star;      // f = +/-1, so (eta+b)^J*f^J = ((eta+b)*f)^J
             };
+            // T(p,X) at n points.  Full groups of 8 or 4 points go through the AVX-512 or AVX2 lane
+            // kernels, up to the given level, sharing each table coefficient across lanes; the rest
+            // through T_pX(p,X).  Results agree with the scalar path to rounding.
+            void T_pX(const double *p, const double *X, std::size_t n, double *T, IF97SIMD level = simd_level()) const{
+                std::size_t i = 0;
+#ifdef IF97_SIMD_X86
+                if (level >= SIMD_AVX512) for (; i + 8 <= n; i += 8) T_pX_avx512(p + i, X + i, T + i);
+                if (level >= SIMD_AVX2)   for (; i + 4 <= n; i += 4) T_pX_avx2(p + i, X + i, T + i);
+#else
+                (void)level;
+#endif
+                for (; i < n; ++i) T[i] = T_pX(p[i], X[i]);
+            }
 
             // This function implements the backward boundary formulas for h'(s), h"(s) as defined 
             // in the IAPWS supplementary releases of 2014 for region 3.  It should only be called
             // when the appropriate coefficients are provided for an h(s) instance of this class.
             virtual double h_s(double s) const{
                 const double sigma1 = s/s_star, sigma2 = s/s2_star;
-                double summer = 0;
-                for (std::size_t i = 0; i < N; ++i){
-                    summer += n[i]*std::pow(std::pow(sigma1,d)+a, I[i])*std::pow(sigma2+b, J[i]);
-                }
+                const double summer = sum(std::pow(sigma1,d)+a, sigma2+b);
                 // NOTE: c=1, e=0 : Straight summation
                 //       c>1, e=0 : Power fit
                 //       c=1, e=1 : Exp fit
@@ -3618,10 +4357,7 @@ namespace IF97
             // when the appropriate coefficients are provided for a p(h,s) instance of this class.
             virtual double p_hs(double h, double s) const{
                 const double eta = h/h_star, sigma = s/s_star;
-                double summer = 0;
-                for (std::size_t i = 0; i < N; ++i){
-                    summer += n[i]*std::pow(eta+a, I[i])*std::pow(sigma+b, J[i]);
-                }
+                const double summer = sum(eta+a, sigma+b);
                 return std::pow(summer,c)*p_star;
             };
 
@@ -3629,10 +4365,7 @@ namespace IF97
 //       It may double as Tsat(h,s) in Region 4 as well.
             virtual double t_hs(double h, double s) const{
                 const double eta = h/h_star, sigma = s/s_star;
-                double summer = 0;
-                for (std::size_t i = 0; i < N; ++i){
-                    summer += n[i]*std::pow(eta+a, I[i])*std::pow(sigma+b, J[i]);
-                }
+                const double summer = sum(eta+a, sigma+b);
                 return summer*T_star;
             };
 
@@ -3641,160 +4374,217 @@ namespace IF97
         // Region 1 *******************************************************************************
         class Region1H : public BackwardsRegion{
         public:
-            Region1H() : BackwardsRegion(Coeff1H, 20){ 
-                p_star = 1*p_fact; T_star = 1.0; X_star = 2500.0*R_fact; a = 0; b = 1.0; f = 1;
-            };
+            constexpr Region1H() : BackwardsRegion(Coeff1H, IF97_KERNEL(Coeff1H),
+                1*p_fact, 2500.0*R_fact, 1.0, 0, 0, 0, 0, 1.0, 0, 0, 0, 1) {}
         };
         class Region1S : public BackwardsRegion{
         public:
-            Region1S() : BackwardsRegion(Coeff1S, 20){ 
-                p_star = 1*p_fact; T_star = 1.0; X_star = 1.0*R_fact; a = 0; b = 2.0; f = 1;
-            };
+            constexpr Region1S() : BackwardsRegion(Coeff1S, IF97_KERNEL(Coeff1S),
+                1*p_fact, 1.0*R_fact, 1.0, 0, 0, 0, 0, 2.0, 0, 0, 0, 1) {}
         };
         class Region1HS : public BackwardsRegion{
         public:
-            Region1HS() : BackwardsRegion(Coeff1HS, 19){ 
-                p_star = 100*p_fact; h_star = 3400*R_fact; s_star = 7.6*R_fact; a = 0.05; b = 0.05; c = 1;
-            };
+            constexpr Region1HS() : BackwardsRegion(Coeff1HS, IF97_KERNEL(Coeff1HS),
+                100*p_fact, 0, 0, 3400*R_fact, 7.6*R_fact, 0, 0.05, 0.05, 1, 0, 0, 0) {}
         };
         // Region 2 *******************************************************************************
         class Region2aH : public BackwardsRegion{
         public:
-            Region2aH() : BackwardsRegion(Coeff2aH, 34){ 
-                p_star = 1*p_fact; T_star = 1.0; X_star = 2000.0*R_fact; a = 0; b = -2.1; f = 1;
-            };
+            constexpr Region2aH() : BackwardsRegion(Coeff2aH, IF97_KERNEL(Coeff2aH),
+                1*p_fact, 2000.0*R_fact, 1.0, 0, 0, 0, 0, -2.1, 0, 0, 0, 1) {}
         };
         class Region2bH : public BackwardsRegion{
         public:
-            Region2bH() : BackwardsRegion(Coeff2bH, 38){ 
-                p_star = 1*p_fact; T_star = 1.0; X_star = 2000.0*R_fact; a = -2; b = -2.6; f = 1;
-            };
+            constexpr Region2bH() : BackwardsRegion(Coeff2bH, IF97_KERNEL(Coeff2bH),
+                1*p_fact, 2000.0*R_fact, 1.0, 0, 0, 0, -2, -2.6, 0, 0, 0, 1) {}
         };
         class Region2cH : public BackwardsRegion{
         public:
-            Region2cH() : BackwardsRegion(Coeff2cH, 23){ 
-                p_star = 1*p_fact; T_star = 1.0; X_star = 2000.0*R_fact; a = 25; b = -1.8; f = 1;
-            };
+            constexpr Region2cH() : BackwardsRegion(Coeff2cH, IF97_KERNEL(Coeff2cH),
+                1*p_fact, 2000.0*R_fact, 1.0, 0, 0, 0, 25, -1.8, 0, 0, 0, 1) {}
         };
         class Region2aS : public BackwardsRegion{
         public:
-            Region2aS() : BackwardsRegion(Coeff2aS, 46){ 
-                p_star = 1*p_fact; T_star = 1.0; X_star = 2.0*R_fact; a = 0; b = -2; f = 1;
-            };
+            constexpr Region2aS() : BackwardsRegion(Coeff2aS, IF97_KERNEL(Coeff2aS),
+                1*p_fact, 2.0*R_fact, 1.0, 0, 0, 0, 0, -2, 0, 0, 0, 1) {}
         };
         class Region2bS : public BackwardsRegion{
         public:
-            Region2bS() : BackwardsRegion(Coeff2bS, 44){ 
-                p_star = 1*p_fact; T_star = 1.0; X_star = 0.7853*R_fact; a = 0; b = -10; f = -1;
-            };
+            constexpr Region2bS() : BackwardsRegion(Coeff2bS, IF97_KERNEL(Coeff2bS),
+                1*p_fact, 0.7853*R_fact, 1.0, 0, 0, 0, 0, -10, 0, 0, 0, -1) {}
         };
         class Region2cS : public BackwardsRegion{
         public:
-            Region2cS() : BackwardsRegion(Coeff2cS, 30){ 
-                p_star = 1*p_fact; T_star = 1.0; X_star = 2.9251*R_fact; a = 0; b = -2; f = -1;
-            };
+            constexpr Region2cS() : BackwardsRegion(Coeff2cS, IF97_KERNEL(Coeff2cS),
+                1*p_fact, 2.9251*R_fact, 1.0, 0, 0, 0, 0, -2, 0, 0, 0, -1) {}
         };
         class Region2aHS : public BackwardsRegion{
         public:
-            Region2aHS() : BackwardsRegion(Coeff2aHS, 29){ 
-                p_star = 4*p_fact; h_star = 4200*R_fact; s_star = 12*R_fact; a = -0.5; b = -1.2; c = 4;
-            };
+            constexpr Region2aHS() : BackwardsRegion(Coeff2aHS, IF97_KERNEL(Coeff2aHS),
+                4*p_fact, 0, 0, 4200*R_fact, 12*R_fact, 0, -0.5, -1.2, 4, 0, 0, 0) {}
         };
         class Region2bHS : public BackwardsRegion{
         public:
-            Region2bHS() : BackwardsRegion(Coeff2bHS, 33){ 
-                p_star = 100*p_fact; h_star = 4100*R_fact; s_star = 7.9*R_fact; a = -0.6; b = -1.01; c = 4;
-            };
+            constexpr Region2bHS() : BackwardsRegion(Coeff2bHS, IF97_KERNEL(Coeff2bHS),
+                100*p_fact, 0, 0, 4100*R_fact, 7.9*R_fact, 0, -0.6, -1.01, 4, 0, 0, 0) {}
         };
         class Region2cHS : public BackwardsRegion{
         public:
-            Region2cHS() : BackwardsRegion(Coeff2cHS, 31){ 
-                p_star = 100*p_fact; h_star = 3500*R_fact; s_star = 5.9*R_fact; a = -0.7; b = -1.1; c = 4;
-            };
+            constexpr Region2cHS() : BackwardsRegion(Coeff2cHS, IF97_KERNEL(Coeff2cHS),
+                100*p_fact, 0, 0, 3500*R_fact, 5.9*R_fact, 0, -0.7, -1.1, 4, 0, 0, 0) {}
         };
         // Region 3 *******************************************************************************
         class Region3aH : public BackwardsRegion{
         public:
-            Region3aH() : BackwardsRegion(Coeff3aH, 31){ 
-                p_star = 100*p_fact; T_star = 760.0; X_star = 2300.0*R_fact; a = 0.240; b = -0.615; f = 1;
-            };
+            constexpr Region3aH() : BackwardsRegion(Coeff3aH, IF97_KERNEL(Coeff3aH),
+                100*p_fact, 2300.0*R_fact, 760.0, 0, 0, 0, 0.240, -0.615, 0, 0, 0, 1) {}
         };
         class Region3bH : public BackwardsRegion{
         public:
-            Region3bH() : BackwardsRegion(Coeff3bH, 33){ 
-                p_star = 100*p_fact; T_star = 860.0; X_star = 2800.0*R_fact; a = 0.298; b = -0.720; f = 1;
-            };
+            constexpr Region3bH() : BackwardsRegion(Coeff3bH, IF97_KERNEL(Coeff3bH),
+                100*p_fact, 2800.0*R_fact, 860.0, 0, 0, 0, 0.298, -0.720, 0, 0, 0, 1) {}
         };
         class Region3aS : public BackwardsRegion{
         public:
-            Region3aS() : BackwardsRegion(Coeff3aS, 33){ 
-                p_star = 100*p_fact; T_star = 760.0; X_star = 4.4*R_fact; a = 0.240; b = -0.703; f = 1;
-            };
+            constexpr Region3aS() : BackwardsRegion(Coeff3aS, IF97_KERNEL(Coeff3aS),
+                100*p_fact, 4.4*R_fact, 760.0, 0, 0, 0, 0.240, -0.703, 0, 0, 0, 1) {}
         };
         class Region3bS : public BackwardsRegion{
         public:
-            Region3bS() : BackwardsRegion(Coeff3bS, 28){ 
-                p_star = 100*p_fact; T_star = 860.0; X_star = 5.3*R_fact; a = 0.760; b = -0.818; f = 1;
-            };
+            constexpr Region3bS() : BackwardsRegion(Coeff3bS, IF97_KERNEL(Coeff3bS),
+                100*p_fact, 5.3*R_fact, 860.0, 0, 0, 0, 0.760, -0.818, 0, 0, 0, 1) {}
         };
         class Region3aHS : public BackwardsRegion{
         public:
-            Region3aHS() : BackwardsRegion(Coeff3aHS, 33){ 
-                p_star = 99*p_fact; h_star = 2300*R_fact; s_star = 4.4*R_fact; a = -1.01; b = -0.750; c = 1;
-            };
+            constexpr Region3aHS() : BackwardsRegion(Coeff3aHS, IF97_KERNEL(Coeff3aHS),
+                99*p_fact, 0, 0, 2300*R_fact, 4.4*R_fact, 0, -1.01, -0.750, 1, 0, 0, 0) {}
         };
         class Region3bHS : public BackwardsRegion{
         public:
-            Region3bHS() : BackwardsRegion(Coeff3bHS, 35){ 
-                p_star = 16.6*p_fact; h_star = 2800*R_fact; s_star = 5.3*R_fact; a = -0.681; b = -0.792; c = -1;
-            };
+            constexpr Region3bHS() : BackwardsRegion(Coeff3bHS, IF97_KERNEL(Coeff3bHS),
+                16.6*p_fact, 0, 0, 2800*R_fact, 5.3*R_fact, 0, -0.681, -0.792, -1, 0, 0, 0) {}
         };
         // Region 4 *******************************************************************************
         class Region4HS : public BackwardsRegion{
         public:
-            Region4HS() : BackwardsRegion(CoeffT4HS, 36){ 
-                h_star = 2800.0*R_fact; s_star = 9.2*R_fact; T_star = 550; a = -0.119; b = -1.07;
-            };
+            constexpr Region4HS() : BackwardsRegion(CoeffT4HS, IF97_KERNEL(CoeffT4HS),
+                0, 0, 550, 2800.0*R_fact, 9.2*R_fact, 0, -0.119, -1.07, 0, 0, 0, 0) {}
         };
         // h(s) Boundary Equations *******************************************************************************
         class Boundary14HS : public BackwardsRegion{
         public:
-            Boundary14HS() : BackwardsRegion(Coeffb14HS, 27){ 
-                h_star = 1700.0*R_fact; s_star = 3.8*R_fact; s2_star = s_star; a = -1.09; b = 0.366E-4; c = 1; d = 1; e = 0;
-            };
+            constexpr Boundary14HS() : BackwardsRegion(Coeffb14HS, IF97_KERNEL(Coeffb14HS),
+                0, 0, 0, 1700.0*R_fact, 3.8*R_fact, 3.8*R_fact, -1.09, 0.366E-4, 1, 1, 0, 0) {}
         };
         class Boundary3a4HS : public BackwardsRegion{
         public:
-            Boundary3a4HS() : BackwardsRegion(Coeffb3a4HS, 19){ 
-                h_star = 1700.0*R_fact; s_star = 3.8*R_fact; s2_star = s_star; a = -1.09; b = 0.366E-4; c = 1; d = 1; e = 0;
-            };
+            constexpr Boundary3a4HS() : BackwardsRegion(Coeffb3a4HS, IF97_KERNEL(Coeffb3a4HS),
+                0, 0, 0, 1700.0*R_fact, 3.8*R_fact, 3.8*R_fact, -1.09, 0.366E-4, 1, 1, 0, 0) {}
         };
         class Boundary2ab4HS : public BackwardsRegion{
         public:
-            Boundary2ab4HS() : BackwardsRegion(Coeffb2abHS, 30){ 
-                h_star = 2800.0*R_fact; s_star = 5.21*R_fact; s2_star = 9.2*R_fact; a = -0.513; b = -0.524; c = 1; d = -1; e = 1;
-            };
+            constexpr Boundary2ab4HS() : BackwardsRegion(Coeffb2abHS, IF97_KERNEL(Coeffb2abHS),
+                0, 0, 0, 2800.0*R_fact, 5.21*R_fact, 9.2*R_fact, -0.513, -0.524, 1, -1, 1, 0) {}
         };
         class Boundary2c3b4HS : public BackwardsRegion{
         public:
-            Boundary2c3b4HS() : BackwardsRegion(Coeffb2c3bHS, 16){ 
-                h_star = 2800.0*R_fact; s_star = 5.9*R_fact; s2_star = s_star; a = -1.02; b = -0.726; c = 4; d = 1; e = 0;
-            };
+            constexpr Boundary2c3b4HS() : BackwardsRegion(Coeffb2c3bHS, IF97_KERNEL(Coeffb2c3bHS),
+                0, 0, 0, 2800.0*R_fact, 5.9*R_fact, 5.9*R_fact, -1.02, -0.726, 4, 1, 0, 0) {}
         };
         class Boundary13HS : public BackwardsRegion{
         public:
-            Boundary13HS() : BackwardsRegion(Coeffb13HS, 6){ 
-                h_star = 1700.0*R_fact; s_star = 3.8*R_fact; s2_star = s_star; a = -0.884; b = -0.864; c = 1; d = 1; e = 0;
-            };
+            constexpr Boundary13HS() : BackwardsRegion(Coeffb13HS, IF97_KERNEL(Coeffb13HS),
+                0, 0, 0, 1700.0*R_fact, 3.8*R_fact, 3.8*R_fact, -0.884, -0.864, 1, 1, 0, 0) {}
         };
         class Boundary23HS : public BackwardsRegion{
         public:
-            Boundary23HS() : BackwardsRegion(CoeffTb23HS, 25){ 
-                h_star = 3000.0*R_fact; s_star = 5.3*R_fact; T_star = 900; a = -0.727; b = -0.864;
-            };
+            constexpr Boundary23HS() : BackwardsRegion(CoeffTb23HS, IF97_KERNEL(CoeffTb23HS),
+                0, 0, 900, 3000.0*R_fact, 5.3*R_fact, 0, -0.727, -0.864, 0, 0, 0, 0) {}
         };
 
-        static const double Region2b2cdata[] = {
+    };  // Backwards Namespace (region classes)
+
+    /********************************************************************************/
+    /**************************    Region Registry    *******************************/
+    /********************************************************************************/
+    // The one process-wide instance of every region evaluator and of the transport correlations.
+    // All of the API functions below read their evaluators from Regions rather than keeping their
+    // own function-local copies, so there is a single, constant-initialized object per region.
+    // Static members of a class template may be defined in a header without ODR trouble, which
+    // keeps IF97.h header-only.  (The Region 3 v(T,p) subregions and dividing lines are needed
+    // before this point and keep their single instances inside Region3Backwards.)
+    template<class Unused = void> struct RegionRegistry
+    {
+        // Forward equations and transport
+        static constexpr Region1 R1{};
+        static constexpr Region2 R2{};
+        static constexpr Region3 R3{};
+        static constexpr Region4 R4{};
+        static constexpr Region5 R5{};
+        static constexpr Transport TR{};
+        // Backward equations T(p,h), T(p,s), p(h,s), T(h,s) and the h(s) saturation boundaries
+        static constexpr Backwards::Region1H B1H{};
+        static constexpr Backwards::Region1S B1S{};
+        static constexpr Backwards::Region2aH B2aH{};
+        static constexpr Backwards::Region2bH B2bH{};
+        static constexpr Backwards::Region2cH B2cH{};
+        static constexpr Backwards::Region2aS B2aS{};
+        static constexpr Backwards::Region2bS B2bS{};
+        static constexpr Backwards::Region2cS B2cS{};
+        static constexpr Backwards::Region3aH B3aH{};
+        static constexpr Backwards::Region3bH B3bH{};
+        static constexpr Backwards::Region3aS B3aS{};
+        static constexpr Backwards::Region3bS B3bS{};
+        static constexpr Backwards::Region1HS B1HS{};
+        static constexpr Backwards::Region2aHS B2aHS{};
+        static constexpr Backwards::Region2bHS B2bHS{};
+        static constexpr Backwards::Region2cHS B2cHS{};
+        static constexpr Backwards::Region3aHS B3aHS{};
+        static constexpr Backwards::Region3bHS B3bHS{};
+        static constexpr Backwards::Region4HS B4HS{};
+        static constexpr Backwards::Boundary14HS b14HS{};
+        static constexpr Backwards::Boundary3a4HS b3a4HS{};
+        static constexpr Backwards::Boundary2ab4HS b2ab4HS{};
+        static constexpr Backwards::Boundary2c3b4HS b2c3b4HS{};
+        static constexpr Backwards::Boundary13HS b13HS{};
+        static constexpr Backwards::Boundary23HS b23HS{};
+    };
+    template<class Unused> constexpr Region1 RegionRegistry<Unused>::R1;
+    template<class Unused> constexpr Region2 RegionRegistry<Unused>::R2;
+    template<class Unused> constexpr Region3 RegionRegistry<Unused>::R3;
+    template<class Unused> constexpr Region4 RegionRegistry<Unused>::R4;
+    template<class Unused> constexpr Region5 RegionRegistry<Unused>::R5;
+    template<class Unused> constexpr Transport RegionRegistry<Unused>::TR;
+    template<class Unused> constexpr Backwards::Region1H RegionRegistry<Unused>::B1H;
+    template<class Unused> constexpr Backwards::Region1S RegionRegistry<Unused>::B1S;
+    template<class Unused> constexpr Backwards::Region2aH RegionRegistry<Unused>::B2aH;
+    template<class Unused> constexpr Backwards::Region2bH RegionRegistry<Unused>::B2bH;
+    template<class Unused> constexpr Backwards::Region2cH RegionRegistry<Unused>::B2cH;
+    template<class Unused> constexpr Backwards::Region2aS RegionRegistry<Unused>::B2aS;
+    template<class Unused> constexpr Backwards::Region2bS RegionRegistry<Unused>::B2bS;
+    template<class Unused> constexpr Backwards::Region2cS RegionRegistry<Unused>::B2cS;
+    template<class Unused> constexpr Backwards::Region3aH RegionRegistry<Unused>::B3aH;
+    template<class Unused> constexpr Backwards::Region3bH RegionRegistry<Unused>::B3bH;
+    template<class Unused> constexpr Backwards::Region3aS RegionRegistry<Unused>::B3aS;
+    template<class Unused> constexpr Backwards::Region3bS RegionRegistry<Unused>::B3bS;
+    template<class Unused> constexpr Backwards::Region1HS RegionRegistry<Unused>::B1HS;
+    template<class Unused> constexpr Backwards::Region2aHS RegionRegistry<Unused>::B2aHS;
+    template<class Unused> constexpr Backwards::Region2bHS RegionRegistry<Unused>::B2bHS;
+    template<class Unused> constexpr Backwards::Region2cHS RegionRegistry<Unused>::B2cHS;
+    template<class Unused> constexpr Backwards::Region3aHS RegionRegistry<Unused>::B3aHS;
+    template<class Unused> constexpr Backwards::Region3bHS RegionRegistry<Unused>::B3bHS;
+    template<class Unused> constexpr Backwards::Region4HS RegionRegistry<Unused>::B4HS;
+    template<class Unused> constexpr Backwards::Boundary14HS RegionRegistry<Unused>::b14HS;
+    template<class Unused> constexpr Backwards::Boundary3a4HS RegionRegistry<Unused>::b3a4HS;
+    template<class Unused> constexpr Backwards::Boundary2ab4HS RegionRegistry<Unused>::b2ab4HS;
+    template<class Unused> constexpr Backwards::Boundary2c3b4HS RegionRegistry<Unused>::b2c3b4HS;
+    template<class Unused> constexpr Backwards::Boundary13HS RegionRegistry<Unused>::b13HS;
+    template<class Unused> constexpr Backwards::Boundary23HS RegionRegistry<Unused>::b23HS;
+    typedef RegionRegistry<> Regions;
+
+    namespace Backwards{
+
+        alignas(64) static constexpr double Region2b2cdata[] = {
 	     0.90584278514723E+3,
 	    -0.67955786399241E+0,
 	     0.12809002730136E-3,
@@ -3802,65 +4592,59 @@ namespace IF97
 	     0.45257578905948E+1
         };
 
-        static const std::vector<double> region2b2c_n(Region2b2cdata, Region2b2cdata + sizeof(Region2b2cdata)/sizeof(double));
-
         inline double P2b2c_h(double h){
             // Only called for Region determination and debugging.  No range checking.
             const double p_star = 1*p_fact, h_star = 1*R_fact, eta = h/h_star;
-            const double PI = region2b2c_n[0] + region2b2c_n[1]*eta + region2b2c_n[2]*eta*eta;
+            const double PI = Region2b2cdata[0] + Region2b2cdata[1]*eta + Region2b2cdata[2]*eta*eta;
             return PI*p_star;
         }
         inline double H2b2c_p(double p){
             // Only called for Region determination and debugging.  No range checking.
             const double p_star = 1*p_fact, h_star = 1*R_fact, PI = p/p_star;
-            const double ETA = region2b2c_n[3] + sqrt((PI - region2b2c_n[4])/region2b2c_n[2]);
+            const double ETA = Region2b2cdata[3] + sqrt((PI - Region2b2cdata[4])/Region2b2cdata[2]);
             return ETA*h_star;
         }
 
-        static const double Region3abdata[] = {
+        alignas(64) static constexpr double Region3abdata[] = {
 	     0.201464004206875E+4,
 	     0.374696550136983E+1,
 	    -0.219921901054187E-1,
 	     0.875131686009950E-4,
         };
 
-        static const std::vector<double> region3ab_n(Region3abdata, Region3abdata + sizeof(Region3abdata)/sizeof(double));
-
         inline double H3ab_p(double p){
             // Only called for Region determination and debugging.  No range checking.
             const double p_star = 1*p_fact, h_star = 1*R_fact, PI = p/p_star;
-            double ETA = region3ab_n[0] + region3ab_n[1]*PI + region3ab_n[2]*PI*PI + region3ab_n[3]*PI*PI*PI;
+            double ETA = Region3abdata[0] + Region3abdata[1]*PI + Region3abdata[2]*PI*PI + Region3abdata[3]*PI*PI*PI;
             return ETA*h_star;
         };
 
-        static const double Region2abdata[] = {
+        alignas(64) static constexpr double Region2abdata[] = {
 	    -0.349898083432139E+4,
 	     0.257560716905876E+4,
 	    -0.421073558227969E+3,
 	     0.276349063799944E+2,
         };
 
-        static const std::vector<double> region2ab_n(Region2abdata, Region2abdata + sizeof(Region2abdata)/sizeof(double));
-
         inline double H2ab_s(double s){
             // Only called for Region determination and debugging.  No range checking.
             const double s_star = 1*R_fact, h_star = 1*R_fact, sigma = s/s_star;
-            double ETA = region2ab_n[0] + region2ab_n[1]*sigma + region2ab_n[2]*powi(sigma,2) + region2ab_n[3]*powi(sigma,3);
+            double ETA = Region2abdata[0] + Region2abdata[1]*sigma + Region2abdata[2]*powi(sigma,2) + Region2abdata[3]*powi(sigma,3);
             return ETA*h_star;
         };
 
         inline double H13_s(double s){
             // Only called for Region determination and debugging.  No range checking.
-            static const Boundary13HS b13; 
+            const Boundary13HS &b13 = Regions::b13HS; 
             return b13.h_s(s);
         };
 
         inline double Hsat_s(double s){
             // Only called for Region determination and debugging.  Has range checking.
-            static const Boundary14HS b14hs;
-            static const Boundary3a4HS b3a4hs;
-            static const Boundary2c3b4HS b2c3b4hs;
-            static const Boundary2ab4HS b2ab4hs;
+            const Boundary14HS &b14hs = Regions::b14HS;
+            const Boundary3a4HS &b3a4hs = Regions::b3a4HS;
+            const Boundary2c3b4HS &b2c3b4hs = Regions::b2c3b4HS;
+            const Boundary2ab4HS &b2ab4hs = Regions::b2ab4HS;
             if (s < 0)
                 throw std::out_of_range("Entropy out of range");
             else if (s <= SfT23 )
@@ -3875,63 +4659,73 @@ namespace IF97
                 throw std::out_of_range("Entropy out of range");
         };
 
-    };  // Backwards Namespace
+    };  // Backwards Namespace (boundary functions)
 
     /********************************************************************************/
     /**************************      General          *******************************/
     /********************************************************************************/
 
-    enum IF97REGIONS {REGION_1, REGION_2, REGION_3, REGION_4, REGION_5};
     enum IF97BACKREGIONS {BACK_1, BACK_2A, BACK_2B, BACK_2C, BACK_3A, BACK_3B, BACK_4};
 
-    inline IF97REGIONS RegionDetermination_TP(double T, double p)
+    inline IF97STATUS RegionDetermination_TP(double T, double p, IF97REGIONS &region)
     {
-        static const Region4 R4;
+        // Non-throwing form of RegionDetermination_TP(T,p); region is only set when STATUS_OK is returned.
+        const Region4 &R4 = Regions::R4;
         // Check overall IF97 boundary limits for Pressure
-        if ((p < Pmin) || (p > Pmax)) throw std::out_of_range("Pressure out of range");
+        if ((p < Pmin) || (p > Pmax)) return STATUS_P_RANGE;
 
         // Now Check Temperature Range
         if (T > Text){
-            throw std::out_of_range("Temperature out of range");
+            return STATUS_T_RANGE;
         }
         else if (T > Tmax && T <= Text){
             if (p <= Pext){
-                return REGION_5;
+                region = REGION_5;
             }
             else{
-                throw std::out_of_range("Pressure out of range");
+                return STATUS_P_RANGE;
             }
         }
         else if (T > T23min && T <= Tmax){
             if (p < P23min){  // Check this one first to avoid the call to 2-3 boundary curve (a little bit faster)
-                return REGION_2;
+                region = REGION_2;
             }
             else if (p > Region23_T(T)){
-                return REGION_3;
+                region = REGION_3;
             }
             else{
-                return REGION_2;
+                region = REGION_2;
             }
         }
         else if (T >= Tmin && T <= T23min){
             if(p > R4.p_T(T))
-                return REGION_1;
+                region = REGION_1;
             else if(p < R4.p_T(T))
-                return REGION_2;
+                region = REGION_2;
             else
-                return REGION_4;
+                region = REGION_4;
         }
         else{
-            throw std::out_of_range("Temperature out of range");
+            return STATUS_T_RANGE;
+        }
+        return STATUS_OK;
+    };
+
+    inline IF97REGIONS RegionDetermination_TP(double T, double p)
+    {
+        IF97REGIONS region = REGION_1;
+        switch (RegionDetermination_TP(T, p, region)){
+            case STATUS_P_RANGE: throw std::out_of_range("Pressure out of range");
+            case STATUS_T_RANGE: throw std::out_of_range("Temperature out of range");
+            default: return region;
         }
     };
 
     inline double RegionOutput(IF97parameters outkey, double T, double p, IF97SatState State){
-        static const Region1 R1;
-        static const Region2 R2;
-        static const Region3 R3;
-        static const Region4 R4;
-        static const Region5 R5;
+        const Region1 &R1 = Regions::R1;
+        const Region2 &R2 = Regions::R2;
+        const Region3 &R3 = Regions::R3;
+        const Region5 &R5 = Regions::R5;
 
         IF97REGIONS region = RegionDetermination_TP(T, p);
 
@@ -3962,28 +4756,67 @@ namespace IF97
     };
 
 
-    inline IF97REGIONS RegionDetermination_pX(double p, double X, IF97parameters inkey){
+    inline void RegionFill(double T, double p, unsigned int mask, State &st, const Region3Solver &solver = region3_solver()){
+        // Fills the properties selected in mask for the region already stored in st.region
+        switch (st.region){
+            case REGION_1: Regions::R1.fill(T, p, mask, st); break;
+            case REGION_2: Regions::R2.fill(T, p, mask, st); break;
+            case REGION_3: Regions::R3.fill(T, p, mask, NONE, st, solver); break;
+            case REGION_4: throw std::out_of_range("Cannot use Region 4 with T and p as inputs");
+            case REGION_5: Regions::R5.fill(T, p, mask, st); break;
+        }
+    };
+
+    inline State props_Tp(double T, double p, unsigned int mask = PROP_ALL, const Region3Solver &solver = region3_solver()){
+        // Determines the region, and in Region 3 the subregion and density, only once and
+        // then fills every property selected in mask from the shared intermediates.  Region 3
+        // densities are solved with the given solver settings (by default the process-wide ones).
+        const double nan = std::numeric_limits<double>::quiet_NaN();
+        State st = {T, p, nan, nan, nan, nan, nan, nan, nan, nan, nan, nan, nan, REGION_1};
+
+        st.region = RegionDetermination_TP(T, p);
+        RegionFill(T, p, mask, st, solver);
+        return st;
+    };
+
+    inline SatState SatOutput(double T, double p, unsigned int mask = PROP_ALL){
+        // Both saturated phases at a (T,p) point on the saturation line, from one region determination
+        // and one fill of the properties in mask per phase.  The phases are chosen as in RegionOutput()
+        // with LIQUID and VAPOR: Region 3 with the requested phase, otherwise Region 1 and Region 2.
+        const double nan = std::numeric_limits<double>::quiet_NaN();
+        const State blank = {T, p, nan, nan, nan, nan, nan, nan, nan, nan, nan, nan, nan, REGION_1};
+        SatState sat = {T, p, blank, blank};
+
+        if (RegionDetermination_TP(T, p) == REGION_3) {
+            sat.liq.region = sat.vap.region = REGION_3;
+            Regions::R3.fill(T, p, mask, LIQUID, sat.liq);
+            Regions::R3.fill(T, p, mask, VAPOR, sat.vap);
+        } else {
+            sat.vap.region = REGION_2;
+            Regions::R1.fill(T, p, mask, sat.liq);
+            Regions::R2.fill(T, p, mask, sat.vap);
+        }
+        return sat;
+    };
+
+    inline IF97STATUS RegionDetermination_pX_exact(double p, double X, IF97parameters inkey, IF97REGIONS &region){
+        // Reference (p,X) classification, from the boundary values evaluated exactly at p by the forward
+        // equations.  Non-throwing; region is only set when STATUS_OK is returned.
         // Setup needed Region Equations for region determination
-        static const Region1 R1;
-        static const Region2 R2;
+        const Region1 &R1 = Regions::R1;
+        const Region2 &R2 = Regions::R2;
         // Saturation Region Limit Variables (initialized outside of the if statements below)
         double Tsat = 0;
         double Xliq = 0;
         double Xvap = 0;
 
-        // Check overall boundary limits - Throw errors if not met
+        // Check overall boundary limits
         if ((p < Pmin) || (p > Pmax))
-                throw std::out_of_range("Pressure out of range");
+                return STATUS_P_RANGE;
         double Xmin = R1.output(inkey,Tmin,p);
         double Xmax = R2.output(inkey,Tmax,p);
-        if (( X < Xmin ) || (X > (Xmax + 1.0E-10) )){
-            if (inkey == IF97_HMASS){
-                throw std::out_of_range("Enthalpy out of range");
-            }
-            else{
-                throw std::out_of_range("Entropy out of range");
-            }
-        }
+        if (( X < Xmin ) || (X > (Xmax + 1.0E-10) ))
+                return STATUS_X_RANGE;
 
         if (p <= Pcrit) {  // Check saturation Dome first
 
@@ -3992,7 +4825,8 @@ namespace IF97
             Xvap = RegionOutput(inkey, Tsat, p, VAPOR);   // Makes determination between Regions 2 & 3.
 
             if ((Xliq <= X) && (X <= Xvap)) {  // Within Saturation Dome (inclusive)
-                return REGION_4;               //    Region 4
+                region = REGION_4;             //    Region 4
+                return STATUS_OK;
             }
         }
         // End Check of saturation Dome
@@ -4000,23 +4834,1618 @@ namespace IF97
         // Check values below min pressure on B23 line (16.529 MPa)
         if (p <= P23min) {  // p <= P23min (saturation dome)
             if (X < Xliq) {
-                return REGION_1;
+                region = REGION_1;
             } else if (X > Xvap) {
-                return REGION_2;
+                region = REGION_2;
             } else {
-                return REGION_4;  // This should already be handled and returned above.
+                region = REGION_4;  // This should already be handled and returned above.
             }
         }
         // Check values above P23min
         else if (X <= R1.output(inkey, T23min, p))         // T23min is also the Temp between R1 & R3a
-            return REGION_1;                               // ...otherwise R3a (fallthrough)
+            region = REGION_1;                             // ...otherwise R3a (fallthrough)
         else if (X >= R2.output(inkey, Region23_p(p), p))  // compare with X along B23 curve
-            return REGION_2;                               // ...othersise R3b (fallthrough)
+            region = REGION_2;                             // ...othersise R3b (fallthrough)
         else
-            return REGION_3;                               // Return R3 since R4 has already been accounted for above.
+            region = REGION_3;                             // Return R3 since R4 has already been accounted for above.
+        return STATUS_OK;
 
     };  // RegionDetermination_pX
 
+    // The boundary curves, in the order of their rows in BoundaryTables.  For RegionDetermination_pX,
+    // for X = h and then s: X at Tmin and Tmax, X' and X'' on the saturation dome, and X at T23min
+    // (Region 1 / 3a) and on the B23 line (Region 2 / 3b).  For RegionDetermination_HS: h(s) along
+    // Pmax and along Pmin.
+    enum IF97BOUNDARY {BC_HMIN, BC_HMAX, BC_HLIQ, BC_HVAP, BC_H13, BC_H23,
+                       BC_SMIN, BC_SMAX, BC_SLIQ, BC_SVAP, BC_S13, BC_S23,
+                       BC_HS_PMAX, BC_HS_PMIN, BC_COUNT};
+    constexpr int BOUNDARY_INTERVALS = 256;   // Intervals per boundary curve
+
+    // BEGIN BoundaryTables -- written by IF97_kernelgen --boundaries; do not edit
+    template<class Unused = void> struct BoundaryTables
+    {
+        static constexpr double u0[BC_COUNT] = {
+            -7.4000650507046508e+00, -7.4000650507046508e+00, -7.4000650507046508e+00, -7.4000650507046508e+00,
+             2.8051263511237270e+00,  2.8051263511237270e+00, -7.4000650507046508e+00, -7.4000650507046508e+00,
+            -7.4000650507046508e+00, -7.4000650507046508e+00,  2.8051263511237270e+00,  2.8051263511237270e+00,
+             0.0000000000000000e+00,  9.1554920765096810e+00,
+        };
+        static constexpr double du[BC_COUNT] = {
+             4.6895450143331026e-02,  4.6895450143331026e-02,  4.0992235827170299e-02,  4.0992235827170299e-02,
+             7.0314212299389250e-03,  7.0314212299389250e-03,  4.6895450143331026e-02,  4.6895450143331026e-02,
+             4.0992235827170299e-02,  4.0992235827170299e-02,  7.0314212299389250e-03,  7.0314212299389250e-03,
+             2.3595639342626484e-02,  1.0802979486489929e-02,
+        };
+        alignas(64) static constexpr double y[BC_COUNT][BOUNDARY_INTERVALS + 1] = {
+            {   // BC_HMIN
+                -4.1587825659313918e-02, -4.1557927990311778e-02, -4.1526594862866140e-02, -4.1493757357284049e-02,
+                -4.1459343244917547e-02, -4.1423276829149945e-02, -4.1385478779082427e-02, -4.1345865954956075e-02,
+                -4.1304351225272665e-02, -4.1260843275144850e-02, -4.1215246405488425e-02, -4.1167460322490086e-02,
+                -4.1117379917075661e-02, -4.1064895033536372e-02, -4.1009890227423372e-02, -4.0952244511586779e-02,
+                -4.0891831090000989e-02, -4.0828517078950570e-02, -4.0762163214533000e-02, -4.0692623546738721e-02,
+                -4.0619745118038911e-02, -4.0543367627210655e-02, -4.0463323076532012e-02, -4.0379435402511758e-02,
+                -4.0291520088450591e-02, -4.0199383758689575e-02, -4.0102823753166712e-02, -4.0001627681825483e-02,
+                -3.9895572957316543e-02, -3.9784426305563059e-02, -3.9667943252451786e-02, -3.9545867586397068e-02,
+                -3.9417930794506048e-02, -3.9283851472298612e-02, -3.9143334704530831e-02, -3.8996071416638148e-02,
+                -3.8841737694839305e-02, -3.8679994073885324e-02, -3.8510484790265594e-02, -3.8332836999754344e-02,
+                -3.8146659957410824e-02, -3.7951544158032903e-02, -3.7747060435742531e-02, -3.7532759019727732e-02,
+                -3.7308168545276049e-02, -3.7072795016947949e-02, -3.6826120722087366e-02, -3.6567603092153601e-02,
+                -3.6296673509484727e-02, -3.6012736056595232e-02, -3.5715166205696161e-02, -3.5403309444888953e-02,
+                -3.5076479838971254e-02, -3.4733958520590635e-02, -3.4374992109409662e-02, -3.3998791055128715e-02,
+                -3.3604527901054615e-02, -3.3191335464230177e-02, -3.2758304928389208e-02, -3.2304483845210605e-02,
+                -3.1828874039724286e-02, -3.1330429414958373e-02, -3.0808053651567465e-02, -3.0260597796792021e-02,
+                -2.9686857737676202e-02, -2.9085571553161511e-02, -2.8455416738976849e-02, -2.7795007299289343e-02,
+                -2.7102890698925144e-02, -2.6377544669125962e-02, -2.5617373860118829e-02, -2.4820706332958197e-02,
+                -2.3985789883144260e-02, -2.3110788187418126e-02, -2.2193776766243251e-02, -2.1232738751905716e-02,
+                -2.0225560453919329e-02, -1.9170026711587101e-02, -1.8063816023220276e-02, -1.6904495442103071e-02,
+                -1.5689515227147385e-02, -1.4416203237176014e-02, -1.3081759055881576e-02, -1.1683247835226162e-02,
+                -1.0217593843231893e-02, -8.6815737023814114e-03, -7.0718093033859657e-03, -5.3847603792791156e-03,
+                -3.6167167230076202e-03, -1.7637900319524913e-03,  1.7809463908332137e-04,  2.2132078345249405e-03,
+                 4.3460250844535690e-03,  6.5812367413045194e-03,  8.9237582881222278e-03,  1.1378741141256353e-02,
+                 1.3951583971269669e-02,  1.6647944566369616e-02,  1.9473752265032115e-02,  2.2435220984431351e-02,
+                 2.5538862873694248e-02,  2.8791502621531573e-02,  3.2200292449823122e-02,  3.5772727825836986e-02,
+                 3.9516663927530039e-02,  4.3440332897889990e-02,  4.7552361926098581e-02,  5.1861792195306636e-02,
+                 5.6378098737740384e-02,  6.1111211241453058e-02,  6.6071535853535285e-02,  7.1269978027499348e-02,
+                 7.6717966465183904e-02,  8.2427478204653182e-02,  8.8411064909664688e-02,  9.4681880417201561e-02,
+                 1.0125370960418732e-01,  1.0814099863506670e-01,  1.1535888665717217e-01,  1.2292323901225730e-01,
+                 1.3085068203683767e-01,  1.3915863952675869e-01,  1.4786537094550531e-01,  1.5699001145900052e-01,
+                 1.6655261388435078e-01,  1.7657419264264210e-01,  1.8707676981217664e-01,  1.9808342338121260e-01,
+                 2.0961833780506056e-01,  2.2170685697670137e-01,  2.3437553972565181e-01,  2.4765221796521661e-01,
+                 2.6156605761269713e-01,  2.7614762241544766e-01,  2.9142894081886500e-01,  3.0744357602120170e-01,
+                 3.2422669936532977e-01,  3.4181516722538630e-01,  3.6024760155303814e-01,  3.7956447425631579e-01,
+                 3.9980819559115316e-01,  4.2102320675484894e-01,  4.4325607687906687e-01,  4.6655560462917989e-01,
+                 4.9097292462566489e-01,  5.1656161891445962e-01,  5.4337783372212012e-01,  5.7148040174310466e-01,
+                 6.0093097021785880e-01,  6.3179413507169369e-01,  6.6413758139654189e-01,  6.9803223057153119e-01,
+                 7.3355239432970920e-01,  7.7077593609369899e-01,  8.0978443991663285e-01,  8.5066338737990110e-01,
+                 8.9350234281452057e-01,  9.3839514722936934e-01,  9.8544012134680858e-01,  1.0347402781621815e+00,
+                 1.0864035454637453e+00,  1.1405429987668871e+00,  1.1972771051370767e+00,  1.2567299783952888e+00,
+                 1.3190316462215963e+00,  1.3843183296936987e+00,  1.4527327358202848e+00,  1.5244243636512489e+00,
+                 1.5995498245725912e+00,  1.6782731774172932e+00,  1.7607662790494365e+00,  1.8472091511059965e+00,
+                 1.9377903636067455e+00,  2.0327074361722919e+00,  2.1321672576175836e+00,  2.2363865247189838e+00,
+                 2.3455922009828636e+00,  2.4600219962750667e+00,  2.5799248682017208e+00,  2.7055615461658911e+00,
+                 2.8372050790558738e+00,  2.9751414075561331e+00,  3.1196699621055326e+00,  3.2711042875626060e+00,
+                 3.4297726956722632e+00,  3.5960189464646395e+00,  3.7702029597518640e+00,  3.9527015579249722e+00,
+                 4.1439092412885774e+00,  4.3442389972071558e+00,  4.5541231443720731e+00,  4.7740142135339516e+00,
+                 5.0043858660788247e+00,  5.2457338518616536e+00,  5.4985770077420835e+00,  5.7634582983002565e+00,
+                 6.0409459002401178e+00,  6.3316343320168329e+00,  6.6361456302508923e+00,  6.9551305745172760e+00,
+                 7.2892699621191159e+00,  7.6392759344756103e+00,  8.0058933567698851e+00,  8.3899012525158270e+00,
+                 8.7921142947128388e+00,  9.2133843552624910e+00,  9.6546021143235610e+00,  1.0116698731278058e+01,
+                 1.0600647578974810e+01,  1.1107466042903967e+01,  1.1638217386939402e+01,  1.2194012687264822e+01,
+                 1.2776012836071434e+01,  1.3385430616585181e+01,  1.4023532850945665e+01,  1.4691642622419792e+01,
+                 1.5391141573389753e+01,  1.6123472280512257e+01,  1.6890140708397890e+01,  1.7692718743115471e+01,
+                 1.8532846806781865e+01,  1.9412236554458943e+01,  2.0332673654545673e+01,  2.1296020653831420e+01,
+                 2.2304219928365704e+01,  2.3359296721306052e+01,  2.4463362268935022e+01,  2.5618617016090955e+01,
+                 2.6827353922343168e+01,  2.8091961860366499e+01,  2.9414929108136292e+01,  3.0798846936781022e+01,
+                 3.2246413296203919e+01,  3.3760436600914147e+01,  3.5343839618910636e+01,  3.6999663466924851e+01,
+                 3.8731071715864239e+01,  4.0541354610897642e+01,  4.2433933411276833e+01,  4.4412364855680316e+01,
+                 4.6480345759571314e+01,  4.8641717751736593e+01,  5.0900472157762493e+01,  5.3260755038631544e+01,
+                 5.5726872392768527e+01,  5.8303295529588134e+01,  6.0994666621701604e+01,  6.3805804441157889e+01,
+                 6.6741710282097358e+01,  6.9807574067546781e+01,  7.3008780631207387e+01,  7.6350916155278597e+01,
+                 7.9839774731694391e+01,  8.3481364995459941e+01,  8.7281916753595453e+01,  9.1247887499677688e+01,
+                 9.5385968659767016e+01,
+            },
+            {   // BC_HMAX
+                 4.1606609282486661e+03,  4.1606607956496528e+03,  4.1606606566842238e+03,  4.1606605110467090e+03,
+                 4.1606603584167642e+03,  4.1606601984586623e+03,  4.1606600308205598e+03,  4.1606598551337192e+03,
+                 4.1606596710116983e+03,  4.1606594780494997e+03,  4.1606592758226834e+03,  4.1606590638864291e+03,
+                 4.1606588417745588e+03,  4.1606586089985130e+03,  4.1606583650462735e+03,  4.1606581093812410e+03,
+                 4.1606578414410487e+03,  4.1606575606363303e+03,  4.1606572663494244e+03,  4.1606569579330098e+03,
+                 4.1606566347086882e+03,  4.1606562959654857e+03,  4.1606559409582942e+03,  4.1606555689062307e+03,
+                 4.1606551789909181e+03,  4.1606547703546867e+03,  4.1606543420986845e+03,  4.1606538932809053e+03,
+                 4.1606534229141107e+03,  4.1606529299636641e+03,  4.1606524133452476e+03,  4.1606518719224850e+03,
+                 4.1606513045044348e+03,  4.1606507098429747e+03,  4.1606500866300521e+03,  4.1606494334948138e+03,
+                 4.1606487490005784e+03,  4.1606480316416892e+03,  4.1606472798401928e+03,  4.1606464919423697e+03,
+                 4.1606456662150977e+03,  4.1606448008420375e+03,  4.1606438939196396e+03,  4.1606429434529518e+03,
+                 4.1606419473512342e+03,  4.1606409034233602e+03,  4.1606398093729904e+03,  4.1606386627935253e+03,
+                 4.1606374611628116e+03,  4.1606362018375867e+03,  4.1606348820476705e+03,  4.1606334988898661e+03,
+                 4.1606320493215744e+03,  4.1606305301540951e+03,  4.1606289380456183e+03,  4.1606272694938652e+03,
+                 4.1606255208283847e+03,  4.1606236882024768e+03,  4.1606217675847256e+03,  4.1606197547501351e+03,
+                 4.1606176452708232e+03,  4.1606154345062860e+03,  4.1606131175931787e+03,  4.1606106894346221e+03,
+                 4.1606081446889757e+03,  4.1606054777580903e+03,  4.1606026827749865e+03,  4.1605997535909355e+03,
+                 4.1605966837619380e+03,  4.1605934665345294e+03,  4.1605900948309236e+03,  4.1605865612334292e+03,
+                 4.1605828579681265e+03,  4.1605789768877485e+03,  4.1605749094537550e+03,  4.1605706467175260e+03,
+                 4.1605661793006693e+03,  4.1605614973743695e+03,  4.1605565906377460e+03,  4.1605514482951794e+03,
+                 4.1605460590325329e+03,  4.1605404109922438e+03,  4.1605344917472112e+03,  4.1605282882734246e+03,
+                 4.1605217869212856e+03,  4.1605149733855405e+03,  4.1605078326737739e+03,  4.1605003490733825e+03,
+                 4.1604925061169615e+03,  4.1604842865460232e+03,  4.1604756722729771e+03,  4.1604666443412671e+03,
+                 4.1604571828836079e+03,  4.1604472670781952e+03,  4.1604368751028114e+03,  4.1604259840867326e+03,
+                 4.1604145700603058e+03,  4.1604026079021032e+03,  4.1603900712835330e+03,  4.1603769326107786e+03,
+                 4.1603631629639467e+03,  4.1603487320332706e+03,  4.1603336080522495e+03,  4.1603177577275637e+03,
+                 4.1603011461656070e+03,  4.1602837367954717e+03,  4.1602654912882326e+03,  4.1602463694723247e+03,
+                 4.1602263292448379e+03,  4.1602053264785409e+03,  4.1601833149243985e+03,  4.1601602461093980e+03,
+                 4.1601360692294329e+03,  4.1601107310370053e+03,  4.1600841757235112e+03,  4.1600563447958266e+03,
+                 4.1600271769469291e+03,  4.1599966079202550e+03,  4.1599645703674942e+03,  4.1599309936995078e+03,
+                 4.1598958039300051e+03,  4.1598589235116679e+03,  4.1598202711643180e+03,  4.1597797616947528e+03,
+                 4.1597373058078456e+03,  4.1596928099084680e+03,  4.1596461758937994e+03,  4.1595973009355412e+03,
+                 4.1595460772515435e+03,  4.1594923918663226e+03,  4.1594361263599258e+03,  4.1593771566045525e+03,
+                 4.1593153524883637e+03,  4.1592505776257940e+03,  4.1591826890537504e+03,  4.1591115369129639e+03,
+                 4.1590369641137686e+03,  4.1589588059855396e+03,  4.1588768899089700e+03,  4.1587910349303302e+03,
+                 4.1587010513568175e+03,  4.1586067403320531e+03,  4.1585078933907134e+03,  4.1584042919912808e+03,
+                 4.1582957070257844e+03,  4.1581818983054009e+03,  4.1580626140206723e+03,  4.1579375901750891e+03,
+                 4.1578065499906597e+03,  4.1576692032840792e+03,  4.1575252458119830e+03,  4.1573743585837192e+03,
+                 4.1572162071399980e+03,  4.1570504407956514e+03,  4.1568766918446936e+03,  4.1566945747257359e+03,
+                 4.1565036851457235e+03,  4.1563035991598526e+03,  4.1560938722054079e+03,  4.1558740380871432e+03,
+                 4.1556436079116957e+03,  4.1554020689683894e+03,  4.1551488835536584e+03,  4.1548834877361360e+03,
+                 4.1546052900593359e+03,  4.1543136701786607e+03,  4.1540079774293044e+03,  4.1536875293214453e+03,
+                 4.1533516099588960e+03,  4.1529994683772238e+03,  4.1526303167970946e+03,  4.1522433287883987e+03,
+                 4.1518376373404735e+03,  4.1514123328334745e+03,  4.1509664609057299e+03,  4.1504990202116041e+03,
+                 4.1500089600641259e+03,  4.1494951779563762e+03,  4.1489565169552834e+03,  4.1483917629611960e+03,
+                 4.1477996418262646e+03,  4.1471788163243518e+03,  4.1465278829648305e+03,  4.1458453686423072e+03,
+                 4.1451297271139538e+03,  4.1443793352957864e+03,  4.1435924893689034e+03,  4.1427674006863090e+03,
+                 4.1419021914706955e+03,  4.1409948902932019e+03,  4.1400434273228921e+03,  4.1390456293364623e+03,
+                 4.1379992144774787e+03,  4.1369017867542871e+03,  4.1357508302656779e+03,  4.1345437031433767e+03,
+                 4.1332776312005644e+03,  4.1319497012758657e+03,  4.1305568542626443e+03,  4.1290958778140330e+03,
+                 4.1275633987149531e+03,  4.1259558749134176e+03,  4.1242695872048516e+03,  4.1225006305648985e+03,
+                 4.1206449051283844e+03,  4.1186981068148452e+03,  4.1166557176043061e+03,  4.1145129954710374e+03,
+                 4.1122649639878282e+03,  4.1099064016190823e+03,  4.1074318307278963e+03,  4.1048355063304307e+03,
+                 4.1021114046404318e+03,  4.0992532114580472e+03,  4.0962543104702718e+03,  4.0931077715457363e+03,
+                 4.0898063391245282e+03,  4.0863424208245560e+03,  4.0827080764100751e+03,  4.0788950072959447e+03,
+                 4.0748945467933067e+03,  4.0706976513393706e+03,  4.0662948929964846e+03,  4.0616764535542343e+03,
+                 4.0568321206238875e+03,  4.0517512861777677e+03,  4.0464229480580739e+03,  4.0408357150612533e+03,
+                 4.0349778162962539e+03,  4.0288371156189755e+03,  4.0224011320621212e+03,  4.0156570673105462e+03,
+                 4.0085918414182720e+03,  4.0011921381256657e+03,  3.9934444613147366e+03,  3.9853352043379791e+03,
+                 3.9768507341719883e+03,  3.9679774925812703e+03,  3.9587021167295716e+03,  3.9490115819442071e+03,
+                 3.9388933696204363e+03,  3.9283356635438113e+03,  3.9173275782020974e+03,  3.9058594229457813e+03,
+                 3.8939230061247758e+03,  3.8815119835613696e+03,  3.8686222558927434e+03,  3.8552524193998606e+03,
+                 3.8414042748929314e+03,  3.8270833989946300e+03,  3.8122997816828365e+03,  3.7970685331374971e+03,
+                 3.7814106616692338e+03,  3.7653539226477137e+03,  3.7489337357140193e+03,  3.7321941639237821e+03,
+                 3.7151889435376711e+03,
+            },
+            {   // BC_HLIQ
+                -4.1557181219707716e-02,  2.3438120565297176e+00,  4.7392468456782462e+00,  7.1448685546229278e+00,
+                 9.5607978097550053e+00,  1.1987154567786851e+01,  1.4424058186643002e+01,  1.6871627494973357e+01,
+                 1.9329980860330636e+01,  2.1799236256043937e+01,  2.4279511326836957e+01,  2.6770923453234342e+01,
+                 2.9273589814781229e+01,  3.1787627452125879e+01,  3.4313153328007921e+01,  3.6850284387170035e+01,
+                 3.9399137615244371e+01,  4.1959830096657448e+01,  4.4532479071562690e+01,  4.7117201991860178e+01,
+                 4.9714116576324095e+01,  5.2323340864882596e+01,  5.4944993272062781e+01,  5.7579192639668868e+01,
+                 6.0226058288673173e+01,  6.2885710070419172e+01,  6.5558268417099171e+01,  6.8243854391587945e+01,
+                 7.0942589736638837e+01,  7.3654596923476149e+01,  7.6379999199823132e+01,  7.9118920637367168e+01,
+                 8.1871486178743680e+01,  8.4637821684000087e+01,  8.7418053976625998e+01,  9.0212310889137413e+01,
+                 9.3020721308282333e+01,  9.5843415219845269e+01,  9.8680523753126622e+01,  1.0153217922508635e+02,
+                 1.0439851518420990e+02,  1.0727966645409342e+02,  1.1017576917680223e+02,  1.1308696085600198e+02,
+                 1.1601338039991326e+02,  1.1895516816410066e+02,  1.2191246599412382e+02,  1.2488541726808376e+02,
+                 1.2787416693907748e+02,  1.3087886157760005e+02,  1.3389964941390969e+02,  1.3693668038039468e+02,
+                 1.3999010615393826e+02,  1.4306008019835119e+02,  1.4614675780685536e+02,  1.4925029614467061e+02,
+                 1.5237085429172271e+02,  1.5550859328549589e+02,  1.5866367616405446e+02,  1.6183626800927058e+02,
+                 1.6502653599027491e+02,  1.6823464940715485e+02,  1.7146077973493459e+02,  1.7470510066785872e+02,
+                 1.7796778816401806e+02,  1.8124902049031138e+02,  1.8454897826783116e+02,  1.8786784451762912e+02,
+                 1.9120580470695228e+02,  1.9456304679594240e+02,  1.9793976128484132e+02,  2.0133614126172731e+02,
+                 2.0475238245081849e+02,  2.0818868326136993e+02,  2.1164524483719771e+02,  2.1512227110686035e+02,
+                 2.1861996883453236e+02,  2.2213854767160436e+02,  2.2567822020904055e+02,  2.2923920203053243e+02,
+                 2.3282171176648507e+02,  2.3642597114886331e+02,  2.4005220506695110e+02,  2.4370064162404853e+02,
+                 2.4737151219516238e+02,  2.5106505148570426e+02,  2.5478149759127413e+02,  2.5852109205853793e+02,
+                 2.6228407994726757e+02,  2.6607070989358164e+02,  2.6988123417442642e+02,  2.7371590877336058e+02,
+                 2.7757499344768019e+02,  2.8145875179694269e+02,  2.8536745133294880e+02,  2.8930136355122278e+02,
+                 2.9326076400406276e+02,  2.9724593237520861e+02,  3.0125715255620975e+02,  3.0529471272451980e+02,
+                 3.0935890542342770e+02,  3.1345002764385595e+02,  3.1756838090812482e+02,  3.2171427135573424e+02,
+                 3.2588800983125822e+02,  3.3008991197441981e+02,  3.3432029831242966e+02,  3.3857949435467765e+02,
+                 3.4286783068987279e+02,  3.4718564308570399e+02,  3.5153327259114184e+02,  3.5591106564146651e+02,
+                 3.6031937416613152e+02,  3.6475855569957412e+02,  3.6922897349507940e+02,  3.7373099664182888e+02,
+                 3.7826500018524143e+02,  3.8283136525074843e+02,  3.8743047917113199e+02,  3.9206273561756404e+02,
+                 3.9672853473450289e+02,  4.0142828327858757e+02,  4.0616239476170381e+02,  4.1093128959837412e+02,
+                 4.1573539525765750e+02,  4.2057514641974626e+02,  4.2545098513743363e+02,  4.3036336100266834e+02,
+                 4.3531273131840686e+02,  4.4029956127596699e+02,  4.4532432413813098e+02,  4.5038750142823585e+02,
+                 4.5548958312548774e+02,  4.6063106786678918e+02,  4.6581246315535526e+02,  4.7103428557637466e+02,
+                 4.7629706102008038e+02,  4.8160132491250829e+02,  4.8694762245429092e+02,  4.9233650886785557e+02,
+                 4.9776854965339430e+02,  5.0324432085397598e+02,  5.0876440933025856e+02,  5.1432941304518829e+02,
+                 5.1993994135918649e+02,  5.2559661533626286e+02,  5.3130006806160918e+02,  5.3705094497115783e+02,
+                 5.4284990419372275e+02,  5.4869761690627035e+02,  5.5459476770297260e+02,  5.6054205497870407e+02,
+                 5.6654019132767348e+02,  5.7258990395793637e+02,  5.7869193512255742e+02,  5.8484704256826944e+02,
+                 5.9105600000247011e+02,  5.9731959757952200e+02,  6.0363864240729890e+02,  6.1001395907502661e+02,
+                 6.1644639020352122e+02,  6.2293679701899305e+02,  6.2948605995163780e+02,  6.3609507926033825e+02,
+                 6.4276477568486860e+02,  6.4949609112709049e+02,  6.5628998936268761e+02,  6.6314745678516488e+02,
+                 6.7006950318383542e+02,  6.7705716255776588e+02,  6.8411149396764972e+02,  6.9123358242779420e+02,
+                 6.9842453984055760e+02,  7.0568550597565877e+02,  7.1301764949704011e+02,  7.2042216904008376e+02,
+                 7.2790029434222652e+02,  7.3545328743024163e+02,  7.4308244386758952e+02,  7.5078909406572291e+02,
+                 7.5857460466323630e+02,  7.6644037997729549e+02,  7.7438786353199521e+02,  7.8241853966869610e+02,
+                 7.9053393524378509e+02,  7.9873562141984621e+02,  8.0702521555656199e+02,  8.1540438320839201e+02,
+                 8.2387484023653269e+02,  8.3243835504352023e+02,  8.4109675093937813e+02,  8.4985190864927438e+02,
+                 8.5870576897347803e+02,  8.6766033561147231e+02,  8.7671767816339889e+02,  8.8587993532321366e+02,
+                 8.9514931827960675e+02,  9.0452811434241391e+02,  9.1401869081425696e+02,  9.2362349912944887e+02,
+                 9.3334507928475864e+02,  9.4318606458962802e+02,  9.5314918676685522e+02,  9.6323728143867163e+02,
+                 9.7345329403774713e+02,  9.8380028618777646e+02,  9.9428144260451131e+02,  1.0049000785750408e+03,
+                 1.0156596480813803e+03,  1.0265637526438602e+03,  1.0376161509710359e+03,  1.0488207695157018e+03,
+                 1.0601817140518076e+03,  1.0717032824048786e+03,  1.0833899784893149e+03,  1.0952465278305442e+03,
+                 1.1072778947784736e+03,  1.1194893016527042e+03,  1.1318862500991174e+03,  1.1444745449839033e+03,
+                 1.1572603212046165e+03,  1.1702500738604438e+03,  1.1834506922958619e+03,  1.1968694986142998e+03,
+                 1.2105142913529776e+03,  1.2243933951170197e+03,  1.2385157170932237e+03,  1.2528908115046474e+03,
+                 1.2675289532341842e+03,  1.2824412220529593e+03,  1.2976395991656536e+03,  1.3131370781801220e+03,
+                 1.3289477932113095e+03,  1.3450871677876485e+03,  1.3615720897820404e+03,  1.3784211201112018e+03,
+                 1.3956547469929944e+03,  1.4132957039141929e+03,  1.4313693792093948e+03,  1.4499043596270271e+03,
+                 1.4689331709713670e+03,  1.4884933072385354e+03,  1.5086286762360726e+03,  1.5293916332156589e+03,
+                 1.5508458194913997e+03,  1.5730700586548933e+03,  1.5961635665321669e+03,  1.6202526647111831e+03,
+                 1.6454989929732949e+03,  1.6721413596023249e+03,  1.7004716496101953e+03,  1.7309485605542916e+03,
+                 1.7642617191394586e+03,  1.8016232264457526e+03,  1.8455469883227051e+03,  1.9032007153005709e+03,
+                 2.0866826730767184e+03,
+            },
+            {   // BC_HVAP
+                 2.5008926311621326e+03,  2.5019315272096051e+03,  2.5029750550741824e+03,  2.5040232425094437e+03,
+                 2.5050761174625841e+03,  2.5061337080759026e+03,  2.5071960426881678e+03,  2.5082631498358560e+03,
+                 2.5093350582542671e+03,  2.5104117968784753e+03,  2.5114933948441430e+03,  2.5125798814881559e+03,
+                 2.5136712863490898e+03,  2.5147676391674859e+03,  2.5158689698859325e+03,  2.5169753086489245e+03,
+                 2.5180866858025142e+03,  2.5192031318937275e+03,  2.5203246776697179e+03,  2.5214513540766852e+03,
+                 2.5225831922585021e+03,  2.5237202235550717e+03,  2.5248624795003821e+03,  2.5260099918202463e+03,
+                 2.5271627924297277e+03,  2.5283209134302228e+03,  2.5294843871061939e+03,  2.5306532459215382e+03,
+                 2.5318275225155794e+03,  2.5330072496986613e+03,  2.5341924604473488e+03,  2.5353831878991887e+03,
+                 2.5365794653470525e+03,  2.5377813262330260e+03,  2.5389888041418244e+03,  2.5402019327937451e+03,
+                 2.5414207460371240e+03,  2.5426452778402713e+03,  2.5438755622829090e+03,  2.5451116335470506e+03,
+                 2.5463535259073401e+03,  2.5476012737208307e+03,  2.5488549114161660e+03,  2.5501144734821796e+03,
+                 2.5513799944558828e+03,  2.5526515089098139e+03,  2.5539290514387585e+03,  2.5552126566458137e+03,
+                 2.5565023591277622e+03,  2.5577981934597738e+03,  2.5591001941793938e+03,  2.5604083957698103e+03,
+                 2.5617228326423756e+03,  2.5630435391183760e+03,  2.5643705494100227e+03,  2.5657038976006397e+03,
+                 2.5670436176240537e+03,  2.5683897432431204e+03,  2.5697423080274198e+03,  2.5711013453300520e+03,
+                 2.5724668882635356e+03,  2.5738389696747790e+03,  2.5752176221190830e+03,  2.5766028778331765e+03,
+                 2.5779947687072263e+03,  2.5793933262558016e+03,  2.5807985815877701e+03,  2.5822105653750637e+03,
+                 2.5836293078203080e+03,  2.5850548386232508e+03,  2.5864871869459544e+03,  2.5879263813767152e+03,
+                 2.5893724498926417e+03,  2.5908254198208706e+03,  2.5922853177983211e+03,  2.5937521697299794e+03,
+                 2.5952260007456116e+03,  2.5967068351548633e+03,  2.5981946964006552e+03,  2.5996896070108296e+03,
+                 2.6011915885479375e+03,  2.6027006615571049e+03,  2.6042168455118908e+03,  2.6057401587580243e+03,
+                 2.6072706184549643e+03,  2.6088082405151363e+03,  2.6103530395407665e+03,  2.6119050287582127e+03,
+                 2.6134642199496466e+03,  2.6150306233819952e+03,  2.6166042477330066e+03,  2.6181851000143211e+03,
+                 2.6197731854914009e+03,  2.6213685076002034e+03,  2.6229710678604506e+03,  2.6245808657853545e+03,
+                 2.6261978987876582e+03,  2.6278221620818445e+03,  2.6294536485823737e+03,  2.6310923487978043e+03,
+                 2.6327382507206430e+03,  2.6343913397127894e+03,  2.6360515983864311e+03,  2.6377190064802467e+03,
+                 2.6393935407307890e+03,  2.6410751747389104e+03,  2.6427638788311137e+03,  2.6444596199157122e+03,
+                 2.6461623613336819e+03,  2.6478720627041225e+03,  2.6495886797642261e+03,  2.6513121642036831e+03,
+                 2.6530424634934702e+03,  2.6547795207089534e+03,  2.6565232743472920e+03,  2.6582736581391027e+03,
+                 2.6600306008544021e+03,  2.6617940261028334e+03,  2.6635638521281853e+03,  2.6653399915972891e+03,
+                 2.6671223513833129e+03,  2.6689108323435612e+03,  2.6707053290918448e+03,  2.6725057297655317e+03,
+                 2.6743119157873862e+03,  2.6761237616223093e+03,  2.6779411345290896e+03,  2.6797638943072952e+03,
+                 2.6815918930393987e+03,  2.6834249748282318e+03,  2.6852629755298585e+03,  2.6871057224818992e+03,
+                 2.6889530342273238e+03,  2.6908047202336988e+03,  2.6926605806077946e+03,  2.6945204058054051e+03,
+                 2.6963839763361825e+03,  2.6982510624631650e+03,  2.7001214238966054e+03,  2.7019948094815959e+03,
+                 2.7038709568788622e+03,  2.7057495922379394e+03,  2.7076304298618625e+03,  2.7095131718622538e+03,
+                 2.7113975078036160e+03,  2.7132831143353710e+03,  2.7151696548100772e+03,  2.7170567788859794e+03,
+                 2.7189441221119268e+03,  2.7208313054924065e+03,  2.7227179350302863e+03,  2.7246036012446325e+03,
+                 2.7264878786607592e+03,  2.7283703252694700e+03,  2.7302504819522733e+03,  2.7321278718691578e+03,
+                 2.7340019998053735e+03,  2.7358723514735161e+03,  2.7377383927670976e+03,  2.7395995689616811e+03,
+                 2.7414553038596259e+03,  2.7433049988744233e+03,  2.7451480320506230e+03,  2.7469837570153695e+03,
+                 2.7488115018576304e+03,  2.7506305679313177e+03,  2.7524402285785532e+03,  2.7542397277695586e+03,
+                 2.7560282786557382e+03,  2.7578050620327176e+03,  2.7595692247102829e+03,  2.7613198777862772e+03,
+                 2.7630560948217171e+03,  2.7647769099144029e+03,  2.7664813156684481e+03,  2.7681682610570524e+03,
+                 2.7698366491757984e+03,  2.7714853348835759e+03,  2.7731131223278462e+03,  2.7747187623506993e+03,
+                 2.7763009497713856e+03,  2.7778583205404852e+03,  2.7793894487598923e+03,  2.7808928435617945e+03,
+                 2.7823669458386648e+03,  2.7838101248149642e+03,  2.7852206744496912e+03,  2.7865968096574379e+03,
+                 2.7879366623337396e+03,  2.7892382771688794e+03,  2.7904996072322056e+03,  2.7917185093072862e+03,
+                 2.7928927389561150e+03,  2.7940199452886000e+03,  2.7950976654115543e+03,  2.7961233185292226e+03,
+                 2.7970941996651623e+03,  2.7980074729728753e+03,  2.7988601645998037e+03,  2.7996491550661531e+03,
+                 2.8003711711160900e+03,  2.8010227769941298e+03,  2.8016003650935563e+03,  2.8021001459162171e+03,
+                 2.8025181372736333e+03,  2.8028501526475002e+03,  2.8030917886131642e+03,  2.8032384112116515e+03,
+                 2.8032851411342735e+03,  2.8032268375578178e+03,  2.8030580804379051e+03,  2.8027731510324716e+03,
+                 2.8023660103866259e+03,  2.8018302754640331e+03,  2.8011591925587354e+03,  2.8003456075653071e+03,
+                 2.7993819326248895e+03,  2.7982601086016630e+03,  2.7969715627790092e+03,  2.7955071610997529e+03,
+                 2.7938571542108716e+03,  2.7920111165116427e+03,  2.7899578773441563e+03,  2.7876854434024053e+03,
+                 2.7851809113618406e+03,  2.7824303696258939e+03,  2.7794187879184219e+03,  2.7761298931700630e+03,
+                 2.7725460296761999e+03,  2.7686480007371506e+03,  2.7644148877831126e+03,  2.7598238411539519e+03,
+                 2.7548498340281003e+03,  2.7494653672318582e+03,  2.7436401075672984e+03,  2.7373404356667179e+03,
+                 2.7305288711020580e+03,  2.7231633325995394e+03,  2.7151961800257191e+03,  2.7065729729334257e+03,
+                 2.6972308688674293e+03,  2.6870965746679926e+03,  2.6760837572595083e+03,  2.6640898184079979e+03,
+                 2.6509919416222083e+03,  2.6366423282115711e+03,  2.6208625499914651e+03,  2.6034369494408511e+03,
+                 2.5841049961608878e+03,  2.5625897938349085e+03,  2.5382968373088020e+03,  2.5105398463164629e+03,
+                 2.4782179712392531e+03,  2.4394217160163735e+03,  2.3902894694090360e+03,  2.3202402445440621e+03,
+                 2.0886911276142105e+03,
+            },
+            {   // BC_H13
+                 1.6708582182745788e+03,  1.6697634070988299e+03,  1.6686864922816494e+03,  1.6676268208849124e+03,
+                 1.6665837627337055e+03,  1.6655567100421463e+03,  1.6645450770229838e+03,  1.6635482994833169e+03,
+                 1.6625658344067069e+03,  1.6615971595222775e+03,  1.6606417728624970e+03,  1.6596991923098863e+03,
+                 1.6587689551339420e+03,  1.6578506175192765e+03,  1.6569437540856648e+03,  1.6560479574013495e+03,
+                 1.6551628374900988e+03,  1.6542880213335750e+03,  1.6534231523694186e+03,  1.6525678899863356e+03,
+                 1.6517219090172421e+03,  1.6508848992309011e+03,  1.6500565648238296e+03,  1.6492366239123683e+03,
+                 1.6484248080268492e+03,  1.6476208616080442e+03,  1.6468245415069809e+03,  1.6460356164891132e+03,
+                 1.6452538667434915e+03,  1.6444790833977929e+03,  1.6437110680399708e+03,  1.6429496322473856e+03,
+                 1.6421945971238702e+03,  1.6414457928456775e+03,  1.6407030582167424e+03,  1.6399662402339723e+03,
+                 1.6392351936632595e+03,  1.6385097806262704e+03,  1.6377898701991485e+03,  1.6370753380230649e+03,
+                 1.6363660659272446e+03,  1.6356619415648283e+03,  1.6349628580617446e+03,  1.6342687136791196e+03,
+                 1.6335794114891519e+03,  1.6328948590648565e+03,  1.6322149681837504e+03,  1.6315396545455601e+03,
+                 1.6308688375040051e+03,  1.6302024398126621e+03,  1.6295403873849368e+03,  1.6288826090679543e+03,
+                 1.6282290364303847e+03,  1.6275796035638812e+03,  1.6269342468981356e+03,  1.6262929050291204e+03,
+                 1.6256555185603768e+03,  1.6250220299570058e+03,  1.6243923834119907e+03,  1.6237665247245609e+03,
+                 1.6231444011900917e+03,  1.6225259615012426e+03,  1.6219111556597711e+03,  1.6212999348986204e+03,
+                 1.6206922516137688e+03,  1.6200880593053180e+03,  1.6194873125273384e+03,  1.6188899668458739e+03,
+                 1.6182959788046210e+03,  1.6177053058976767e+03,  1.6171179065488259e+03,  1.6165337400968067e+03,
+                 1.6159527667859543e+03,  1.6153749477617173e+03,  1.6148002450704535e+03,  1.6142286216629602e+03,
+                 1.6136600414012200e+03,  1.6130944690678098e+03,  1.6125318703774963e+03,  1.6119722119904716e+03,
+                 1.6114154615268096e+03,  1.6108615875816349e+03,  1.6103105597405902e+03,  1.6097623485952154e+03,
+                 1.6092169257577882e+03,  1.6086742638753328e+03,  1.6081343366424173e+03,  1.6075971188124579e+03,
+                 1.6070625862072420e+03,  1.6065307157244372e+03,  1.6060014853428563e+03,  1.6054748741253095e+03,
+                 1.6049508622188694e+03,  1.6044294308524538e+03,  1.6039105623316075e+03,  1.6033942400304347e+03,
+                 1.6028804483806521e+03,  1.6023691728577455e+03,  1.6018603999642717e+03,  1.6013541172103357e+03,
+                 1.6008503130913471e+03,  1.6003489770631218e+03,  1.5998500995144884e+03,  1.5993536717375155e+03,
+                 1.5988596858955459e+03,  1.5983681349891917e+03,  1.5978790128205324e+03,  1.5973923139556671e+03,
+                 1.5969080336859013e+03,  1.5964261679877659e+03,  1.5959467134821157e+03,  1.5954696673925564e+03,
+                 1.5949950275034503e+03,  1.5945227921177450e+03,  1.5940529600148736e+03,  1.5935855304089823e+03,
+                 1.5931205029077109e+03,  1.5926578774717752e+03,  1.5921976543755718e+03,  1.5917398341690152e+03,
+                 1.5912844176408291e+03,  1.5908314057834511e+03,  1.5903807997597678e+03,  1.5899326008718019e+03,
+                 1.5894868105315277e+03,  1.5890434302339106e+03,  1.5886024615323065e+03,  1.5881639060162870e+03,
+                 1.5877277652919747e+03,  1.5872940409649345e+03,  1.5868627346256360e+03,  1.5864338478375296e+03,
+                 1.5860073821276940e+03,  1.5855833389800453e+03,  1.5851617198310635e+03,  1.5847425260679579e+03,
+                 1.5843257590292108e+03,  1.5839114200073845e+03,  1.5834995102541013e+03,  1.5830900309870485e+03,
+                 1.5826829833989009e+03,  1.5822783686679832e+03,  1.5818761879705523e+03,  1.5814764424944979e+03,
+                 1.5810791334543173e+03,  1.5806842621071960e+03,  1.5802918297699853e+03,  1.5799018378369274e+03,
+                 1.5795142877979451e+03,  1.5791291812573031e+03,  1.5787465199524879e+03,  1.5783663057731239e+03,
+                 1.5779885407797658e+03,  1.5776132272224129e+03,  1.5772403675585952e+03,  1.5768699644708911e+03,
+                 1.5765020208837570e+03,  1.5761365399795354e+03,  1.5757735252135471e+03,  1.5754129803281792e+03,
+                 1.5750549093658651e+03,  1.5746993166809150e+03,  1.5743462069501277e+03,  1.5739955851821312e+03,
+                 1.5736474567254609e+03,  1.5733018272753118e+03,  1.5729587028789870e+03,  1.5726180899400604e+03,
+                 1.5722799952212426e+03,  1.5719444258460153e+03,  1.5716113892990359e+03,  1.5712808934254108e+03,
+                 1.5709529464288410e+03,  1.5706275568687506e+03,  1.5703047336564478e+03,  1.5699844860503999e+03,
+                 1.5696668236507010e+03,  1.5693517563928326e+03,  1.5690392945407791e+03,  1.5687294486796193e+03,
+                 1.5684222297076515e+03,  1.5681176488281699e+03,  1.5678157175409569e+03,  1.5675164476336010e+03,
+                 1.5672198511726963e+03,  1.5669259404950276e+03,  1.5666347281988058e+03,  1.5663462271350277e+03,
+                 1.5660604503990078e+03,  1.5657774113221856e+03,  1.5654971234642123e+03,  1.5652196006053998e+03,
+                 1.5649448567395623e+03,  1.5646729060672803e+03,  1.5644037629896359e+03,  1.5641374421024238e+03,
+                 1.5638739581908660e+03,  1.5636133262248375e+03,  1.5633555613546193e+03,  1.5631006789071707e+03,
+                 1.5628486943829184e+03,  1.5625996234530660e+03,  1.5623534819573986e+03,  1.5621102859025780e+03,
+                 1.5618700514609075e+03,  1.5616327949695478e+03,  1.5613985329301520e+03,  1.5611672820089213e+03,
+                 1.5609390590370183e+03,  1.5607138810113572e+03,  1.5604917650956913e+03,  1.5602727286220343e+03,
+                 1.5600567890923269e+03,  1.5598439641803748e+03,  1.5596342717340001e+03,  1.5594277297773967e+03,
+                 1.5592243565136760e+03,  1.5590241703275665e+03,  1.5588271897882551e+03,  1.5586334336523680e+03,
+                 1.5584429208670551e+03,  1.5582556705731818e+03,  1.5580717021086161e+03,  1.5578910350115978e+03,
+                 1.5577136890241879e+03,  1.5575396840958072e+03,  1.5573690403868338e+03,  1.5572017782722928e+03,
+                 1.5570379183456232e+03,  1.5568774814225278e+03,  1.5567204885449210e+03,  1.5565669609849633e+03,
+                 1.5564169202492267e+03,  1.5562703880829540e+03,  1.5561273864744685e+03,  1.5559879376597155e+03,
+                 1.5558520641269561e+03,  1.5557197886216372e+03,  1.5555911341514307e+03,  1.5554661239914760e+03,
+                 1.5553447816898117e+03,  1.5552271310730412e+03,  1.5551131962522034e+03,  1.5550030016288920e+03,
+                 1.5548965719016132e+03,  1.5547939320723829e+03,  1.5546951074535768e+03,  1.5546001236750305e+03,
+                 1.5545090066913772e+03,  1.5544217827896275e+03,  1.5543384785969724e+03,  1.5542591210887908e+03,
+                 1.5541837375968496e+03,  1.5541123558176630e+03,  1.5540450038209704e+03,  1.5539817100583041e+03,
+                 1.5539225033716009e+03,
+            },
+            {   // BC_H23
+                 2.5635920038883869e+03,  2.5686782010277552e+03,  2.5733218767457315e+03,  2.5775759476744115e+03,
+                 2.5814846258277516e+03,  2.5850851487829304e+03,  2.5884091179388502e+03,  2.5914835431236115e+03,
+                 2.5943316650380566e+03,  2.5969736080767980e+03,  2.5994269025199737e+03,  2.6017069053002178e+03,
+                 2.6038271414080218e+03,  2.6057995827409031e+03,  2.6076348772967990e+03,  2.6093425386881690e+03,
+                 2.6109311037465181e+03,  2.6124082643092056e+03,  2.6137809779956874e+03,  2.6150555617897639e+03,
+                 2.6162377714759605e+03,  2.6173328693779818e+03,  2.6183456823760143e+03,  2.6192806518072557e+03,
+                 2.6201418765585072e+03,  2.6209331504235015e+03,  2.6216579946083034e+03,  2.6223196861152978e+03,
+                 2.6229212826125827e+03,  2.6234656442948990e+03,  2.6239554531598301e+03,  2.6243932300555362e+03,
+                 2.6247813498005348e+03,  2.6251220546299951e+03,  2.6254174661847373e+03,  2.6256695962272256e+03,
+                 2.6258803562421504e+03,  2.6260515660567994e+03,  2.6261849615975525e+03,  2.6262822018828488e+03,
+                 2.6263448753395187e+03,  2.6263745055178206e+03,  2.6263725562707796e+03,  2.6263404364549970e+03,
+                 2.6262795042029270e+03,  2.6261910708104929e+03,  2.6260764042784785e+03,  2.6259367325416511e+03,
+                 2.6257732464155270e+03,  2.6255871022872252e+03,  2.6253794245738686e+03,  2.6251513079693764e+03,
+                 2.6249038194981895e+03,  2.6246380003924569e+03,  2.6243548678074894e+03,  2.6240554163886954e+03,
+                 2.6237406197019131e+03,  2.6234114315378361e+03,  2.6230687871001342e+03,  2.6227136040860482e+03,
+                 2.6223467836673067e+03,  2.6219692113785441e+03,  2.6215817579197628e+03,  2.6211852798787891e+03,
+                 2.6207806203791843e+03,  2.6203686096586225e+03,  2.6199500655823522e+03,  2.6195257940960114e+03,
+                 2.6190965896217563e+03,  2.6186632354013859e+03,  2.6182265037899069e+03,  2.6177871565027613e+03,
+                 2.6173459448197632e+03,  2.6169036097486173e+03,  2.6164608821507222e+03,  2.6160184828318934e+03,
+                 2.6155771226004354e+03,  2.6151375022949828e+03,  2.6147003127843750e+03,  2.6142662349417897e+03,
+                 2.6138359395952748e+03,  2.6134100874567498e+03,  2.6129893290315172e+03,  2.6125743045102440e+03,
+                 2.6121656436453709e+03,  2.6117639656138226e+03,  2.6113698788678685e+03,  2.6109839809759687e+03,
+                 2.6106068584553923e+03,  2.6102390865983380e+03,  2.6098812292932867e+03,  2.6095338388432692e+03,
+                 2.6091974557827029e+03,  2.6088726086943802e+03,  2.6085598140282159e+03,  2.6082595759232531e+03,
+                 2.6079723860344120e+03,  2.6076987233654586e+03,  2.6074390541095031e+03,  2.6071938314984232e+03,
+                 2.6069634956624482e+03,  2.6067484735011089e+03,  2.6065491785667091e+03,  2.6063660109613329e+03,
+                 2.6061993572484648e+03,  2.6060495903800143e+03,  2.6059170696396714e+03,  2.6058021406032508e+03,
+                 2.6057051351166865e+03,  2.6056263712922482e+03,  2.6055661535233539e+03,  2.6055247725183826e+03,
+                 2.6055025053536847e+03,  2.6054996155459189e+03,  2.6055163531437388e+03,  2.6055529548387394e+03,
+                 2.6056096440954393e+03,  2.6056866313000169e+03,  2.6057841139273564e+03,  2.6059022767258789e+03,
+                 2.6060412919195423e+03,  2.6062013194262418e+03,  2.6063825070918433e+03,  2.6065849909388439e+03,
+                 2.6068088954287427e+03,  2.6070543337369672e+03,  2.6073214080392286e+03,  2.6076102098080846e+03,
+                 2.6079208201184333e+03,  2.6082533099605821e+03,  2.6086077405596143e+03,  2.6089841636995743e+03,
+                 2.6093826220511692e+03,  2.6098031495015175e+03,  2.6102457714846164e+03,  2.6107105053111450e+03,
+                 2.6111973604962855e+03,  2.6117063390842750e+03,  2.6122374359685214e+03,  2.6127906392060713e+03,
+                 2.6133659303254658e+03,  2.6139632846269533e+03,  2.6145826714742784e+03,  2.6152240545772643e+03,
+                 2.6158873922646608e+03,  2.6165726377467204e+03,  2.6172797393672668e+03,  2.6180086408450311e+03,
+                 2.6187592815042835e+03,  2.6195315964948991e+03,  2.6203255170021503e+03,  2.6211409704467333e+03,
+                 2.6219778806756003e+03,  2.6228361681444089e+03,  2.6237157500925036e+03,  2.6246165407114631e+03,
+                 2.6255384513084400e+03,  2.6264813904655348e+03,  2.6274452641966732e+03,  2.6284299761033749e+03,
+                 2.6294354275310698e+03,  2.6304615177274536e+03,  2.6315081440045528e+03,  2.6325752019061019e+03,
+                 2.6336625853818064e+03,  2.6347701869700554e+03,  2.6358978979905178e+03,  2.6370456087480061e+03,
+                 2.6382132087488185e+03,  2.6394005869306461e+03,  2.6406076319069098e+03,  2.6418342322262210e+03,
+                 2.6430802766474153e+03,  2.6443456544303149e+03,  2.6456302556421456e+03,  2.6469339714792259e+03,
+                 2.6482566946031898e+03,  2.6495983194907349e+03,  2.6509587427955248e+03,  2.6523378637205096e+03,
+                 2.6537355843986370e+03,  2.6551518102795208e+03,  2.6565864505193645e+03,  2.6580394183710550e+03,
+                 2.6595106315710673e+03,  2.6610000127195508e+03,  2.6625074896496571e+03,  2.6640329957820172e+03,
+                 2.6655764704600292e+03,  2.6671378592615101e+03,  2.6687171142821453e+03,  2.6703141943861674e+03,
+                 2.6719290654196211e+03,  2.6735617003817588e+03,  2.6752120795501669e+03,  2.6768801905554055e+03,
+                 2.6785660284013093e+03,  2.6802695954273172e+03,  2.6819909012096796e+03,  2.6837299623988529e+03,
+                 2.6854868024908947e+03,  2.6872614515313107e+03,  2.6890539457504788e+03,  2.6908643271304732e+03,
+                 2.6926926429038890e+03,  2.6945389449861323e+03,  2.6964032893434446e+03,  2.6982857352998763e+03,
+                 2.7001863447873075e+03,  2.7021051815435608e+03,  2.7040423102645777e+03,  2.7059977957175561e+03,
+                 2.7079717018228612e+03,  2.7099640907133657e+03,  2.7119750217807423e+03,  2.7140045507189730e+03,
+                 2.7160527285760782e+03,  2.7181196008256288e+03,  2.7202052064702298e+03,  2.7223095771894909e+03,
+                 2.7244327365453964e+03,  2.7265746992581176e+03,  2.7287354705653888e+03,  2.7309150456785078e+03,
+                 2.7331134093477358e+03,  2.7353305355495640e+03,  2.7375663873077183e+03,  2.7398209166591396e+03,
+                 2.7420940647753073e+03,  2.7443857622483010e+03,  2.7466959295498996e+03,  2.7490244776706859e+03,
+                 2.7513713089448079e+03,  2.7537363180645089e+03,  2.7561193932869496e+03,  2.7585204178341714e+03,
+                 2.7609392714852756e+03,  2.7633758323581496e+03,  2.7658299788761997e+03,  2.7683015919137756e+03,
+                 2.7707905571121682e+03,  2.7732967673562916e+03,  2.7758201254005226e+03,  2.7783605466305607e+03,
+                 2.7809179619467341e+03,  2.7834923207528332e+03,  2.7860835940334723e+03,  2.7886917775019228e+03,
+                 2.7913168947996887e+03,  2.7939590007285442e+03,  2.7966181844954363e+03,  2.7992945729506059e+03,
+                 2.8019883337995266e+03,  2.8046996787696762e+03,  2.8074288667138412e+03,  2.8101762066326764e+03,
+                 2.8129420606003778e+03,
+            },
+            {   // BC_SMIN
+                -1.5454959192117218e-04, -1.5454759385566234e-04, -1.5454549986148621e-04, -1.5454330533360485e-04,
+                -1.5454100544540580e-04, -1.5453859513861454e-04, -1.5453606911238716e-04, -1.5453342181115775e-04,
+                -1.5453064741279148e-04, -1.5452773981573554e-04, -1.5452469262531362e-04, -1.5452149914014753e-04,
+                -1.5451815233712463e-04, -1.5451464485595021e-04, -1.5451096898291068e-04, -1.5450711663434017e-04,
+                -1.5450307933840643e-04, -1.5449884821667537e-04, -1.5449441396430034e-04, -1.5448976683031710e-04,
+                -1.5448489659537301e-04, -1.5447979254978232e-04, -1.5447444346967910e-04, -1.5446883759272285e-04,
+                -1.5446296259197698e-04, -1.5445680554903023e-04, -1.5445035292511216e-04, -1.5444359053222066e-04,
+                -1.5443650350107420e-04, -1.5442907624913858e-04, -1.5442129244596026e-04, -1.5441313497767303e-04,
+                -1.5440458590847286e-04, -1.5439562644300325e-04, -1.5438623688334094e-04, -1.5437639658668389e-04,
+                -1.5436608391972771e-04, -1.5435527621129546e-04, -1.5434394970277929e-04, -1.5433207949535081e-04,
+                -1.5431963949602353e-04, -1.5430660235994496e-04, -1.5429293943099940e-04, -1.5427862067789020e-04,
+                -1.5426361462954010e-04, -1.5424788830506543e-04, -1.5423140714203480e-04, -1.5421413492061381e-04,
+                -1.5419603368367504e-04, -1.5417706365457307e-04, -1.5415718314938632e-04, -1.5413634848511287e-04,
+                -1.5411451388516070e-04, -1.5409163137794830e-04, -1.5406765069308389e-04, -1.5404251915028742e-04,
+                -1.5401618154439352e-04, -1.5398858002477596e-04, -1.5395965396852639e-04, -1.5392933984859712e-04,
+                -1.5389757109394973e-04, -1.5386427794462850e-04, -1.5382938729913251e-04, -1.5379282255546215e-04,
+                -1.5375450344238184e-04, -1.5371434584594948e-04, -1.5367226162505473e-04, -1.5362815841906798e-04,
+                -1.5358193944714019e-04, -1.5353350329685007e-04, -1.5348274370376527e-04, -1.5342954931938502e-04,
+                -1.5337380346986553e-04, -1.5331538390170175e-04, -1.5325416251570233e-04, -1.5319000508968135e-04,
+                -1.5312277098613233e-04, -1.5305231284809377e-04, -1.5297847627884518e-04, -1.5290109950743104e-04,
+                -1.5282001303928332e-04, -1.5273503928908106e-04, -1.5264599219655135e-04, -1.5255267682506317e-04,
+                -1.5245488894146680e-04, -1.5235241457485464e-04, -1.5224502955648550e-04, -1.5213249903732841e-04,
+                -1.5201457698382721e-04, -1.5189100564893491e-04, -1.5176151502042416e-04, -1.5162582224219313e-04,
+                -1.5148363100980810e-04, -1.5133463093734820e-04, -1.5117849689600391e-04, -1.5101488832175555e-04,
+                -1.5084344849136834e-04, -1.5066380376581168e-04, -1.5047556279816307e-04, -1.5027831570683215e-04,
+                -1.5007163321050968e-04, -1.4985506572393466e-04, -1.4962814241380640e-04, -1.4939037021103487e-04,
+                -1.4914123278024488e-04, -1.4888018944227488e-04, -1.4860667404955962e-04, -1.4832009381094395e-04,
+                -1.4801982806624914e-04, -1.4770522700579647e-04, -1.4737561033496046e-04, -1.4703026588086372e-04,
+                -1.4666844813811117e-04, -1.4628937675379179e-04, -1.4589223494696624e-04, -1.4547616786192403e-04,
+                -1.4504028085147945e-04, -1.4458363769044778e-04, -1.4410525871369552e-04, -1.4360411887934775e-04,
+                -1.4307914575308585e-04, -1.4252921741132599e-04, -1.4195316026171988e-04, -1.4134974677884745e-04,
+                -1.4071769315019219e-04, -1.4005565683522332e-04, -1.3936223403121381e-04, -1.3863595704483638e-04,
+                -1.3787529156985445e-04, -1.3707863386684690e-04, -1.3624430784492435e-04, -1.3537056204368755e-04,
+                -1.3445556651605156e-04, -1.3349740960882803e-04, -1.3249409464433033e-04, -1.3144353649990008e-04,
+                -1.3034355809024665e-04, -1.2919188675021697e-04, -1.2798615052351408e-04, -1.2672387435821880e-04,
+                -1.2540247621400987e-04, -1.2401926308642730e-04, -1.2257142695373230e-04, -1.2105604065165793e-04,
+                -1.1947005369169040e-04, -1.1781028802247710e-04, -1.1607343375750723e-04, -1.1425604487541847e-04,
+                -1.1235453491350175e-04, -1.1036517267117420e-04, -1.0828407794703637e-04, -1.0610721733184273e-04,
+                -1.0383040008744890e-04, -1.0144927414334530e-04, -9.8959322246669099e-05, -9.6355858306293031e-05,
+                -9.3634023977125249e-05, -9.0788785538380219e-05, -8.7814931120349575e-05, -8.4707068347561904e-05,
+                -8.1459622470604379e-05, -7.8066835068513559e-05, -7.4522763410031902e-05, -7.0821280579758312e-05,
+                -6.6956076477417946e-05, -6.2920659818770856e-05, -5.8708361275608368e-05, -5.4312337911091745e-05,
+                -4.9725579080985172e-05, -4.4940913991508495e-05, -3.9951021123828114e-05, -3.4748439758027417e-05,
+                -2.9325583855491452e-05, -2.3674758581419272e-05, -1.7788179784104392e-05, -1.1657996776193822e-05,
+                -5.2763187995884294e-06,  1.3647544038988183e-06,  8.2730974537639767e-06,  1.5456519113969661e-05,
+                 2.2922716433941373e-05,  3.0679222635477601e-05,  3.8733348063538268e-05,  4.7092113458994630e-05,
+                 5.5762174735030189e-05,  6.4749738363154593e-05,  7.4060466384586786e-05,  8.3699369973798830e-05,
+                 9.3670690372023088e-05,  1.0397776590651579e-04,  1.1462288368114542e-04,  1.2560711439903730e-04,
+                 1.3693012863334788e-04,  1.4858999270930478e-04,  1.6058294219068641e-04,  1.7290313078566991e-04,
+                 1.8554235229163794e-04,  1.9848973298551464e-04,  2.1173139163954037e-04,  2.2525006409784262e-04,
+                 2.3902468908371130e-04,  2.5302995162577302e-04,  2.6723578018614968e-04,  2.8160679324609246e-04,
+                 2.9610169076339554e-04,  3.1067258553316331e-04,  3.2526426909992368e-04,  3.3981340643875169e-04,
+                 3.5424765318506146e-04,  3.6848468871479323e-04,  3.8243115788691293e-04,  3.9598151373389841e-04,
+                 4.0901675284001835e-04,  4.2140303457963195e-04,  4.3299017479434627e-04,  4.4361000387690313e-04,
+                 4.5307457860229068e-04,  4.6117423640584657e-04,  4.6767548015500725e-04,  4.7231868081758146e-04,
+                 4.7481558476921652e-04,  4.7484661185455239e-04,  4.7205792969919150e-04,  4.6605828918100818e-04,
+                 4.5641560543701351e-04,  4.4265326829053713e-04,  4.2424616558393396e-04,  4.0061640257489764e-04,
+                 3.7112870035039880e-04,  3.3508545612254750e-04,  2.9172144833971002e-04,  2.4019816977235810e-04,
+                 1.7959777215110229e-04,  1.0891660654939224e-04,  2.7058344532461474e-05, -6.7173333857232443e-05,
+                -1.7508249794837756e-04, -2.9808918134211957e-04, -4.3773806346927212e-04, -5.9570762571480712e-04,
+                -7.7381978832502312e-04, -9.7405003278484847e-04, -1.1985380131872400e-03, -1.4495986595990378e-03,
+                -1.7297337769619644e-03, -2.0416441451611396e-03, -2.3882421302254056e-03, -2.7726648241148243e-03,
+                -3.1982877423409853e-03, -3.6687391262485505e-03, -4.1879149221200297e-03, -4.7599945447291464e-03,
+                -5.3894575817371596e-03, -6.0811016612746351e-03, -6.8400617931616784e-03, -7.6718316106988782e-03,
+                -8.5822870926208356e-03,
+            },
+            {   // BC_SMAX
+                 1.1921054825051103e+01,  1.1899411256760617e+01,  1.1877767683728042e+01,  1.1856124105725698e+01,
+                 1.1834480522514971e+01,  1.1812836933845793e+01,  1.1791193339456088e+01,  1.1769549739071202e+01,
+                 1.1747906132403282e+01,  1.1726262519150666e+01,  1.1704618898997204e+01,  1.1682975271611566e+01,
+                 1.1661331636646514e+01,  1.1639687993738136e+01,  1.1618044342505053e+01,  1.1596400682547571e+01,
+                 1.1574757013446803e+01,  1.1553113334763756e+01,  1.1531469646038351e+01,  1.1509825946788430e+01,
+                 1.1488182236508671e+01,  1.1466538514669500e+01,  1.1444894780715915e+01,  1.1423251034066261e+01,
+                 1.1401607274110958e+01,  1.1379963500211163e+01,  1.1358319711697352e+01,  1.1336675907867852e+01,
+                 1.1315032087987309e+01,  1.1293388251285059e+01,  1.1271744396953430e+01,  1.1250100524145976e+01,
+                 1.1228456631975600e+01,  1.1206812719512619e+01,  1.1185168785782713e+01,  1.1163524829764773e+01,
+                 1.1141880850388667e+01,  1.1120236846532876e+01,  1.1098592817022030e+01,  1.1076948760624330e+01,
+                 1.1055304676048825e+01,  1.1033660561942575e+01,  1.1012016416887690e+01,  1.0990372239398184e+01,
+                 1.0968728027916724e+01,  1.0947083780811202e+01,  1.0925439496371135e+01,  1.0903795172803918e+01,
+                 1.0882150808230859e+01,  1.0860506400683063e+01,  1.0838861948097090e+01,  1.0817217448310418e+01,
+                 1.0795572899056680e+01,  1.0773928297960691e+01,  1.0752283642533204e+01,  1.0730638930165448e+01,
+                 1.0708994158123367e+01,  1.0687349323541627e+01,  1.0665704423417299e+01,  1.0644059454603251e+01,
+                 1.0622414413801218e+01,  1.0600769297554551e+01,  1.0579124102240611e+01,  1.0557478824062777e+01,
+                 1.0535833459042124e+01,  1.0514188003008627e+01,  1.0492542451592017e+01,  1.0470896800212133e+01,
+                 1.0449251044068859e+01,  1.0427605178131548e+01,  1.0405959197127954e+01,  1.0384313095532615e+01,
+                 1.0362666867554708e+01,  1.0341020507125274e+01,  1.0319374007883875e+01,  1.0297727363164581e+01,
+                 1.0276080565981294e+01,  1.0254433609012365e+01,  1.0232786484584469e+01,  1.0211139184655702e+01,
+                 1.0189491700797879e+01,  1.0167844024177960e+01,  1.0146196145538601e+01,  1.0124548055177751e+01,
+                 1.0102899742927297e+01,  1.0081251198130628e+01,  1.0059602409619197e+01,  1.0037953365687880e+01,
+                 1.0016304054069188e+01,  9.9946544619062330e+00,  9.9730045757243886e+00,  9.9513543814015897e+00,
+                 9.9297038641371866e+00,  9.9080530084193299e+00,  9.8864017979907537e+00,  9.8647502158129221e+00,
+                 9.8430982440284556e+00,  9.8214458639217295e+00,  9.7997930558775934e+00,  9.7781397993380796e+00,
+                 9.7564860727570437e+00,  9.7348318535526044e+00,  9.7131771180572777e+00,  9.6915218414657431e+00,
+                 9.6698659977800574e+00,  9.6482095597522175e+00,  9.6265524988239779e+00,  9.6048947850637418e+00,
+                 9.5832363871004063e+00,  9.5615772720540111e+00,  9.5399174054630382e+00,  9.5182567512081899e+00,
+                 9.4965952714324828e+00,  9.4749329264574662e+00,  9.4532696746954095e+00,  9.4316054725571963e+00,
+                 9.4099402743557956e+00,  9.3882740322050289e+00,  9.3666066959134415e+00,  9.3449382128730161e+00,
+                 9.3232685279424850e+00,  9.3015975833249822e+00,  9.2799253184397550e+00,  9.2582516697876258e+00,
+                 9.2365765708099001e+00,  9.2148999517404615e+00,  9.1932217394505749e+00,  9.1715418572862166e+00,
+                 9.1498602248974130e+00,  9.1281767580592810e+00,  9.1064913684843010e+00,  9.0848039636254487e+00,
+                 9.0631144464696689e+00,  9.0414227153212678e+00,  9.0197286635746590e+00,  8.9980321794760023e+00,
+                 8.9763331458731077e+00,  8.9546314399530953e+00,  8.9329269329671011e+00,  8.9112194899414803e+00,
+                 8.8895089693747540e+00,  8.8677952229196020e+00,  8.8460780950491547e+00,  8.8243574227067931e+00,
+                 8.8026330349385855e+00,  8.7809047525075332e+00,  8.7591723874886309e+00,  8.7374357428438305e+00,
+                 8.7156946119758327e+00,  8.6939487782596228e+00,  8.6721980145506503e+00,  8.6504420826683859e+00,
+                 8.6286807328540327e+00,  8.6069137032010161e+00,  8.5851407190568825e+00,  8.5633614923950621e+00,
+                 8.5415757211549970e+00,  8.5197830885488948e+00,  8.4979832623334239e+00,  8.4761758940444878e+00,
+                 8.4543606181931210e+00,  8.4325370514204430e+00,  8.4107047916095770e+00,  8.3888634169521303e+00,
+                 8.3670124849669261e+00,  8.3451515314683693e+00,  8.3232800694818092e+00,  8.3013975881030202e+00,
+                 8.2795035512988324e+00,  8.2575973966457354e+00,  8.2356785340031404e+00,  8.2137463441177321e+00,
+                 8.1918001771552866e+00,  8.1698393511559395e+00,  8.1478631504088526e+00,  8.1258708237419004e+00,
+                 8.1038615827217910e+00,  8.0818345997598176e+00,  8.0597890061181321e+00,  8.0377238898112466e+00,
+                 8.0156382933970942e+00,  7.9935312116518498e+00,  7.9714015891222179e+00,  7.9492483175488236e+00,
+                 7.9270702331538798e+00,  7.9048661137860741e+00,  7.8826346759153214e+00,  7.8603745714696780e+00,
+                 7.8380843845064847e+00,  7.8157626277094865e+00,  7.7934077387034053e+00,  7.7710180761772119e+00,
+                 7.7485919158071805e+00,  7.7261274459704916e+00,  7.7036227632402268e+00,  7.6810758676523641e+00,
+                 7.6584846577355350e+00,  7.6358469252943015e+00,  7.6131603499371145e+00,  7.5904224933402853e+00,
+                 7.5676307932400544e+00,  7.5447825571454556e+00,  7.5218749557657540e+00,  7.4989050161474697e+00,
+                 7.4758696145176611e+00,  7.4527654688321592e+00,  7.4295891310298776e+00,  7.4063369789974578e+00,
+                 7.3830052082520599e+00,  7.3595898233545975e+00,  7.3360866290709152e+00,  7.3124912213046729e+00,
+                 7.2887989778330597e+00,  7.2650050488851541e+00,  7.2411043476129446e+00,  7.2170915405169049e+00,
+                 7.1929610379019540e+00,  7.1687069844556897e+00,  7.1443232500595633e+00,  7.1198034209651917e+00,
+                 7.0951407914929518e+00,  7.0703283564385853e+00,  7.0453588044064226e+00,  7.0202245123253251e+00,
+                 6.9949175414463189e+00,  6.9694296351696456e+00,  6.9437522191042929e+00,  6.9178764038256801e+00,
+                 6.8917929908679234e+00,  6.8654924825666503e+00,  6.8389650964576161e+00,  6.8122007850362216e+00,
+                 6.7851892617943061e+00,  6.7579200345741501e+00,  6.7303824474162495e+00,  6.7025657322279955e+00,
+                 6.6744590717654635e+00,  6.6460516756006935e+00,  6.6173328709426880e+00,  6.5882922103920016e+00,
+                 6.5589195989365283e+00,  6.5292054427400936e+00,  6.4991408225358622e+00,  6.4687176947138898e+00,
+                 6.4379291234877591e+00,  6.4067695478418152e+00,  6.3752350873031336e+00,  6.3433238909607148e+00,
+                 6.3110365345844457e+00,  6.2783764712048171e+00,  6.2453505411444254e+00,  6.2119695483109236e+00,
+                 6.1782489106725533e+00,  6.1442093943996410e+00,  6.1098779434055297e+00,  6.0752886193115110e+00,
+                 6.0404836717123809e+00,
+            },
+            {   // BC_SLIQ
+                -1.5443740287116601e-04,  8.5692619985030336e-03,  1.7311649946033337e-02,  2.6073006417077983e-02,
+                 3.4853605765676213e-02,  4.3653717003167260e-02,  5.2473604070879934e-02,  6.1313526105118629e-02,
+                 7.0173737694677760e-02,  7.9054489131048858e-02,  8.7956026651544741e-02,  9.6878592675561093e-02,
+                 1.0582242603409490e-01,  1.1478776219278237e-01,  1.2377483346860700e-01,  1.3278386924043190e-01,
+                 1.4181509615355378e-01,  1.5086873831849215e-01,  1.5994501750406462e-01,  1.6904415332503619e-01,
+                 1.7816636342440567e-01,  1.8731186365055416e-01,  1.9648086822933070e-01,  2.0567358993133156e-01,
+                 2.1489024023433850e-01,  2.2413102948131453e-01,  2.3339616703381341e-01,  2.4268586142115037e-01,
+                 2.5200032048535620e-01,  2.6133975152207894e-01,  2.7070436141755932e-01,  2.8009435678174494e-01,
+                 2.8950994407781205e-01,  2.9895132974800170e-01,  3.0841872033605816e-01,  3.1791232260627700e-01,
+                 3.2743234365937529e-01,  3.3697899104514339e-01,  3.4655247287213253e-01,  3.5615299791435751e-01,
+                 3.6578077571522977e-01,  3.7543601668869447e-01,  3.8511893221779453e-01,  3.9482973475062716e-01,
+                 4.0456863789389985e-01,  4.1433585650409471e-01,  4.2413160677637185e-01,  4.3395610633127857e-01,
+                 4.4380957429934509e-01,  4.5369223140367065e-01,  4.6360430004055891e-01,  4.7354600435831479e-01,
+                 4.8351757033420378e-01,  4.9351922584976660e-01,  5.0355120076445381e-01,  5.1361372698771568e-01,
+                 5.2370703854961953e-01,  5.3383137167003381e-01,  5.4398696482645847e-01,  5.5417405882060122e-01,
+                 5.6439289684374083e-01,  5.7464372454093160e-01,  5.8492679007414161e-01,  5.9524234418438138e-01,
+                 6.0559064025290710e-01,  6.1597193436146758e-01,  6.2638648535185326e-01,  6.3683455488455565e-01,
+                 6.4731640749682862e-01,  6.5783231066006609e-01,  6.6838253483662735e-01,  6.7896735353613735e-01,
+                 6.8958704337133481e-01,  7.0024188411353905e-01,  7.1093215874776938e-01,  7.2165815352760265e-01,
+                 7.3242015802979865e-01,  7.4321846520879786e-01,  7.5405337145109397e-01,  7.6492517662959791e-01,
+                 7.7583418415801697e-01,  7.8678070104530828e-01,  7.9776503795029430e-01,  8.0878750923647380e-01,
+                 8.1984843302712818e-01,  8.3094813126071476e-01,  8.4208692974670518e-01,  8.5326515822184379e-01,
+                 8.6448315040695078e-01,  8.7574124406432274e-01,  8.8703978105576509e-01,  8.9837910740138305e-01,
+                 9.0975957333914004e-01,  9.2118153338529829e-01,  9.3264534639580965e-01,  9.4415137562870288e-01,
+                 9.5569998880756879e-01,  9.6729155818620671e-01,  9.7892646061456157e-01,  9.9060507760591987e-01,
+                 1.0023277954056027e+00,  1.0140950050611020e+00,  1.0259071024938533e+00,  1.0377644885726656e+00,
+                 1.0496675691889654e+00,  1.0616167553338980e+00,  1.0736124631774342e+00,  1.0856551141495447e+00,
+                 1.0977451350236207e+00,  1.1098829580021610e+00,  1.1220690208049253e+00,  1.1343037667596374e+00,
+                 1.1465876448953720e+00,  1.1589211100387562e+00,  1.1713046229131301e+00,  1.1837386502408167e+00,
+                 1.1962236648486162e+00,  1.2087601457767272e+00,  1.2213485783912250e+00,  1.2339894545002614e+00,
+                 1.2466832724742054e+00,  1.2594305373698482e+00,  1.2722317610589255e+00,  1.2850874623610973e+00,
+                 1.2979981671816394e+00,  1.3109644086540682e+00,  1.3239867272878807e+00,  1.3370656711217006e+00,
+                 1.3502017958820609e+00,  1.3633956651480774e+00,  1.3766478505223041e+00,  1.3899589318080603e+00,
+                 1.4033294971935013e+00,  1.4167601434427899e+00,  1.4302514760947129e+00,  1.4438041096689862e+00,
+                 1.4574186678807735e+00,  1.4710957838636902e+00,  1.4848361004017110e+00,  1.4986402701704555e+00,
+                 1.5125089559882752e+00,  1.5264428310775555e+00,  1.5404425793368430e+00,  1.5545088956242004e+00,
+                 1.5686424860524364e+00,  1.5828440682966951e+00,  1.5971143719151155e+00,  1.6114541386830914e+00,
+                 1.6258641229419246e+00,  1.6403450919624882e+00,  1.6548978263247052e+00,  1.6695231203136338e+00,
+                 1.6842217823329941e+00,  1.6989946353370315e+00,  1.7138425172816345e+00,  1.7287662815957530e+00,
+                 1.7437667976740974e+00,  1.7588449513923285e+00,  1.7740016456458445e+00,  1.7892378009134329e+00,
+                 1.8045543558471488e+00,  1.8199522678898219e+00,  1.8354325139216676e+00,  1.8509960909376169e+00,
+                 1.8666440167570633e+00,  1.8823773307678426e+00,  1.8981970947063029e+00,  1.9141043934756228e+00,
+                 1.9301003360044222e+00,  1.9461860561481483e+00,  1.9623627136355939e+00,  1.9786314950632449e+00,
+                 1.9949936149403724e+00,  2.0114503167877955e+00,  2.0280028742936662e+00,  2.0446525925297201e+00,
+                 2.0614008092317784e+00,  2.0782488961485885e+00,  2.0951982604631456e+00,  2.1122503462915061e+00,
+                 2.1294066362638029e+00,  2.1466686531931489e+00,  2.1640379618382353e+00,  2.1815161707660224e+00,
+                 2.1991049343214173e+00,  2.2168059547116004e+00,  2.2346209842130449e+00,  2.2525518275103091e+00,
+                 2.2706003441762408e+00,  2.2887684513045152e+00,  2.3070581263060008e+00,  2.3254714098820903e+00,
+                 2.3440104091891816e+00,  2.3626773012099775e+00,  2.3814743363492350e+00,  2.4004038422731733e+00,
+                 2.4194682280142370e+00,  2.4386699883652576e+00,  2.4580117085899853e+00,  2.4774960694802788e+00,
+                 2.4971258527939817e+00,  2.5169039471118797e+00,  2.5368333541571726e+00,  2.5569171956266361e+00,
+                 2.5771587205894901e+00,  2.5975613135174971e+00,  2.6181285030190846e+00,  2.6388639713605513e+00,
+                 2.6597715648697040e+00,  2.6808553053312552e+00,  2.7021194025000734e+00,  2.7235682678774404e+00,
+                 2.7452065299181019e+00,  2.7670390508623521e+00,  2.7890709454181306e+00,  2.8113076015545930e+00,
+                 2.8337547037105550e+00,  2.8564182587713525e+00,  2.8793046252249650e+00,  2.9024205459760624e+00,
+                 2.9257731853741453e+00,  2.9493701711020148e+00,  2.9732196416734520e+00,  2.9973303004051179e+00,
+                 3.0217114768595641e+00,  3.0463731969031689e+00,  3.0713262626891051e+00,  3.0965823440653875e+00,
+                 3.1221540831337520e+00,  3.1480552139701228e+00,  3.1743006999075667e+00,  3.2009068913611558e+00,
+                 3.2278917080859175e+00,  3.2552748512456224e+00,  3.2830780531190205e+00,  3.3113253762746471e+00,
+                 3.3400435804817721e+00,  3.3692625857224510e+00,  3.3990160750530496e+00,  3.4293423037212105e+00,
+                 3.4602852130240813e+00,  3.4918959906807552e+00,  3.5242352743871139e+00,  3.5573762589105731e+00,
+                 3.5914090306080158e+00,  3.6264464972137889e+00,  3.6626322695223918e+00,  3.7001507265217413e+00,
+                 3.7392391681717791e+00,  3.7802465457483803e+00,  3.8236201210927820e+00,  3.8700414629859243e+00,
+                 3.9205491996569704e+00,  3.9769805517799712e+00,  4.0431678907852104e+00,  4.1300953124781579e+00,
+                 4.4106860203153619e+00,
+            },
+            {   // BC_SVAP
+                 9.1557592006552913e+00,  9.1406504143008469e+00,  9.1255509570065314e+00,  9.1104608635024817e+00,
+                 9.0953801687285232e+00,  9.0803089078378445e+00,  9.0652471162002559e+00,  9.0501948294050614e+00,
+                 9.0351520832635721e+00,  9.0201189138111175e+00,  9.0050953573086900e+00,  8.9900814502440092e+00,
+                 8.9750772293321699e+00,  8.9600827315156959e+00,  8.9450979939640902e+00,  8.9301230540727268e+00,
+                 8.9151579494612161e+00,  8.9002027179710979e+00,  8.8852573976628406e+00,  8.8703220268122376e+00,
+                 8.8553966439059959e+00,  8.8404812876366634e+00,  8.8255759968967631e+00,  8.8106808107721371e+00,
+                 8.7957957685344965e+00,  8.7809209096331191e+00,  8.7660562736857042e+00,  8.7512019004683452e+00,
+                 8.7363578299046036e+00,  8.7215241020536318e+00,  8.7067007570974102e+00,  8.6918878353269520e+00,
+                 8.6770853771275736e+00,  8.6622934229631721e+00,  8.6475120133594068e+00,  8.6327411888859569e+00,
+                 8.6179809901376476e+00,  8.6032314577145357e+00,  8.5884926322009267e+00,  8.5737645541432901e+00,
+                 8.5590472640270576e+00,  8.5443408022523606e+00,  8.5296452091085566e+00,  8.5149605247477123e+00,
+                 8.5002867891568776e+00,  8.4856240421292437e+00,  8.4709723232341378e+00,  8.4563316717858648e+00,
+                 8.4417021268113430e+00,  8.4270837270165995e+00,  8.4124765107520929e+00,  8.3978805159768175e+00,
+                 8.3832957802212338e+00,  8.3687223405490041e+00,  8.3541602335175398e+00,  8.3396094951372923e+00,
+                 8.3250701608298989e+00,  8.3105422653850400e+00,  8.2960258429161051e+00,  8.2815209268145882e+00,
+                 8.2670275497032542e+00,  8.2525457433879996e+00,  8.2380755388084470e+00,  8.2236169659872349e+00,
+                 8.2091700539779566e+00,  8.1947348308117451e+00,  8.1803113234424938e+00,  8.1658995576906150e+00,
+                 8.1514995581853782e+00,  8.1371113483057265e+00,  8.1227349501195345e+00,  8.1083703843212831e+00,
+                 8.0940176701680571e+00,  8.0796768254138378e+00,  8.0653478662419520e+00,  8.0510308071956977e+00,
+                 8.0367256611069742e+00,  8.0224324390229000e+00,  8.0081511501302103e+00,  7.9938818016774826e+00,
+                 7.9796243988949334e+00,  7.9653789449117554e+00,  7.9511454406708202e+00,  7.9369238848406178e+00,
+                 7.9227142737243508e+00,  7.9085166011659123e+00,  7.8943308584526868e+00,  7.8801570342150100e+00,
+                 7.8659951143220574e+00,  7.8518450817740417e+00,  7.8377069165905082e+00,  7.8235805956945912e+00,
+                 7.8094660927929658e+00,  7.7953633782514249e+00,  7.7812724189657745e+00,  7.7671931782279815e+00,
+                 7.7531256155872770e+00,  7.7390696867061335e+00,  7.7250253432109055e+00,  7.7109925325369684e+00,
+                 7.6969711977682360e+00,  7.6829612774708709e+00,  7.6689627055211362e+00,  7.6549754109272161e+00,
+                 7.6409993176449680e+00,  7.6270343443875372e+00,  7.6130804044287927e+00,  7.5991374054005778e+00,
+                 7.5852052490838506e+00,  7.5712838311936634e+00,  7.5573730411582209e+00,  7.5434727618920396e+00,
+                 7.5295828695634404e+00,  7.5157032333565628e+00,  7.5018337152281962e+00,  7.4879741696596804e+00,
+                 7.4741244434042846e+00,  7.4602843752304251e+00,  7.4464537956611281e+00,  7.4326325267102868e+00,
+                 7.4188203816161682e+00,  7.4050171645727385e+00,  7.3912226704594044e+00,  7.3774366845697283e+00,
+                 7.3636589823397998e+00,  7.3498893290768450e+00,  7.3361274796886944e+00,  7.3223731784147894e+00,
+                 7.3086261585592212e+00,  7.2948861422264351e+00,  7.2811528400600238e+00,  7.2674259509850856e+00,
+                 7.2537051619544108e+00,  7.2399901476987818e+00,  7.2262805704814070e+00,  7.2125760798564302e+00,
+                 7.1988763124312971e+00,  7.1851808916324691e+00,  7.1714894274738485e+00,  7.1578015163269484e+00,
+                 7.1441167406916772e+00,  7.1304346689661227e+00,  7.1167548552136797e+00,  7.1030768389252295e+00,
+                 7.0894001447740136e+00,  7.0757242823602429e+00,  7.0620487459423078e+00,  7.0483730141509113e+00,
+                 7.0346965496822413e+00,  7.0210187989657422e+00,  7.0073391918018801e+00,  6.9936571409647783e+00,
+                 6.9799720417644391e+00,  6.9662832715628564e+00,  6.9525901892381787e+00,  6.9388921345908221e+00,
+                 6.9251884276853080e+00,  6.9114783681215402e+00,  6.8977612342291872e+00,  6.8840362821788794e+00,
+                 6.8703027450041114e+00,  6.8565598315278846e+00,  6.8428067251884430e+00,  6.8290425827587811e+00,
+                 6.8152665329550608e+00,  6.8014776749295853e+00,  6.7876750766444136e+00,  6.7738577731224758e+00,
+                 6.7600247645734806e+00,  6.7461750143926897e+00,  6.7323074470311548e+00,  6.7184209457366464e+00,
+                 6.7045143501650468e+00,  6.6905864538623057e+00,  6.6766360016175863e+00,  6.6626616866881632e+00,
+                 6.6486621478967747e+00,  6.6346359666019525e+00,  6.6205816635411647e+00,  6.6064976955463388e+00,
+                 6.5923824521298355e+00,  6.5782342519381887e+00,  6.5640513390690991e+00,  6.5498318792453825e+00,
+                 6.5355739558376342e+00,  6.5212755657249666e+00,  6.5069346149805760e+00,  6.4925489143664139e+00,
+                 6.4781161746181093e+00,  6.4636340014988178e+00,  6.4490998905972461e+00,  6.4345112218427145e+00,
+                 6.4198652537069334e+00,  6.4051591170594975e+00,  6.3903898086414861e+00,  6.3755541841186423e+00,
+                 6.3606489506729629e+00,  6.3456706590883760e+00,  6.3306156952826633e+00,  6.3154802712336489e+00,
+                 6.3002604152421933e+00,  6.2849519614677236e+00,  6.2695505386631316e+00,  6.2540515580243303e+00,
+                 6.2384502000550777e+00,  6.2227414003288262e+00,  6.2069198340063680e+00,  6.1909798989392053e+00,
+                 6.1749156971544270e+00,  6.1587210144756703e+00,  6.1423892979872088e+00,  6.1259136309931472e+00,
+                 6.1092867050617112e+00,  6.0925007886757641e+00,  6.0755476919357365e+00,  6.0584187266812997e+00,
+                 6.0411046613146446e+00,  6.0235956695246058e+00,  6.0058812720278114e+00,  5.9879502703659666e+00,
+                 5.9697906717276021e+00,  5.9513896037013447e+00,  5.9327332178131176e+00,  5.9138065806438993e+00,
+                 5.8945935512514840e+00,  5.8750766434943884e+00,  5.8552368716253484e+00,  5.8350535770984324e+00,
+                 5.8145042337927606e+00,  5.7935642276221850e+00,  5.7722066045459668e+00,  5.7504017780368590e+00,
+                 5.7281171827720367e+00,  5.7053168553389515e+00,  5.6819609147663845e+00,  5.6580049054589860e+00,
+                 5.6333989525701362e+00,  5.6080866652164136e+00,  5.5820037068423609e+00,  5.5550759356153305e+00,
+                 5.5272170026520620e+00,  5.4983252843252046e+00,  5.4682800193145376e+00,  5.4369365236614975e+00,
+                 5.4041203689410544e+00,  5.3696204283313040e+00,  5.3331807166243754e+00,  5.2944909586455786e+00,
+                 5.2531757875531797e+00,  5.2088439027156959e+00,  5.1606009235799357e+00,  5.1074328492950034e+00,
+                 5.0476921915952229e+00,  4.9784990957428175e+00,  4.8939894549056477e+00,  4.7779907416548575e+00,
+                 4.4137898173241528e+00,
+            },
+            {   // BC_S13
+                 3.7782813395442321e+00,  3.7761990731597770e+00,  3.7741438573352335e+00,  3.7721146256415463e+00,
+                 3.7701103483584122e+00,  3.7681300318677708e+00,  3.7661727180211342e+00,  3.7642374834845009e+00,
+                 3.7623234390613498e+00,  3.7604297289946378e+00,  3.7585555302505465e+00,  3.7567000517844025e+00,
+                 3.7548625337908241e+00,  3.7530422469397271e+00,  3.7512384915993056e+00,  3.7494505970481837e+00,
+                 3.7476779206775204e+00,  3.7459198471856014e+00,  3.7441757877655601e+00,  3.7424451792883322e+00,
+                 3.7407274834825102e+00,  3.7390221861118462e+00,  3.7373287961532426e+00,  3.7356468449750704e+00,
+                 3.7339758855189435e+00,  3.7323154914852501e+00,  3.7306652565241665e+00,  3.7290247934337963e+00,
+                 3.7273937333664384e+00,  3.7257717250443894e+00,  3.7241584339864997e+00,  3.7225535417468829e+00,
+                 3.7209567451665087e+00,  3.7193677556391989e+00,  3.7177862983927259e+00,  3.7162121117861941e+00,
+                 3.7146449466247655e+00,  3.7130845654918820e+00,  3.7115307421007571e+00,  3.7099832606650822e+00,
+                 3.7084419152899226e+00,  3.7069065093833924e+00,  3.7053768550894035e+00,  3.7038527727423047e+00,
+                 3.7023340903433297e+00,  3.7008206430594721e+00,  3.6993122727449204e+00,  3.6978088274851642e+00,
+                 3.6963101611638791e+00,  3.6948161330525613e+00,  3.6933266074229878e+00,  3.6918414531821604e+00,
+                 3.6903605435297853e+00,  3.6888837556377401e+00,  3.6874109703515541e+00,  3.6859420719131784e+00,
+                 3.6844769477048360e+00,  3.6830154880133867e+00,  3.6815575858146015e+00,  3.6801031365768710e+00,
+                 3.6786520380835426e+00,  3.6772041902733852e+00,  3.6757594950982786e+00,  3.6743178563974781e+00,
+                 3.6728791797876141e+00,  3.6714433725675928e+00,  3.6700103436375970e+00,  3.6685800034312503e+00,
+                 3.6671522638601242e+00,  3.6657270382696310e+00,  3.6643042414054405e+00,  3.6628837893895048e+00,
+                 3.6614655997047305e+00,  3.6600495911874771e+00,  3.6586356840269159e+00,  3.6572237997703785e+00,
+                 3.6558138613338476e+00,  3.6544057930167071e+00,  3.6529995205199670e+00,  3.6515949709670963e+00,
+                 3.6501920729267749e+00,  3.6487907564367474e+00,  3.6473909530281223e+00,  3.6459925957494690e+00,
+                 3.6445956191900022e+00,  3.6431999595013944e+00,  3.6418055544175649e+00,  3.6404123432720397e+00,
+                 3.6390202670123775e+00,  3.6376292682113194e+00,  3.6362392910742747e+00,  3.6348502814428723e+00,
+                 3.6334621867943158e+00,  3.6320749562363699e+00,  3.6306885404977955e+00,  3.6293028919141803e+00,
+                 3.6279179644090696e+00,  3.6265337134704341e+00,  3.6251500961224932e+00,  3.6237670708929710e+00,
+                 3.6223845977759588e+00,  3.6210026381904759e+00,  3.6196211549349977e+00,  3.6182401121381598e+00,
+                 3.6168594752059002e+00,  3.6154792107653324e+00,  3.6140992866057200e+00,  3.6127196716168051e+00,
+                 3.6113403357249476e+00,  3.6099612498273888e+00,  3.6085823857250565e+00,  3.6072037160542991e+00,
+                 3.6058252142179632e+00,  3.6044468543162087e+00,  3.6030686110774659e+00,  3.6016904597899426e+00,
+                 3.6003123762340623e+00,  3.5989343366162072e+00,  3.5975563175041581e+00,  3.5961782957645410e+00,
+                 3.5948002485026569e+00,  3.5934221530049433e+00,  3.5920439866844194e+00,  3.5906657270293065e+00,
+                 3.5892873515551225e+00,  3.5879088377603807e+00,  3.5865301630861390e+00,  3.5851513048794716e+00,
+                 3.5837722403610273e+00,  3.5823929465967326e+00,  3.5810134004736640e+00,  3.5796335786801570e+00,
+                 3.5782534576900771e+00,  3.5768730137512459e+00,  3.5754922228779376e+00,  3.5741110608473168e+00,
+                 3.5727295031997324e+00,  3.5713475252426541e+00,  3.5699651020581267e+00,  3.5685822085134937e+00,
+                 3.5671988192751973e+00,  3.5658149088254003e+00,  3.5644304514811944e+00,  3.5630454214161023e+00,
+                 3.5616597926836087e+00,  3.5602735392424720e+00,  3.5588866349834647e+00,  3.5574990537572821e+00,
+                 3.5561107694033729e+00,  3.5547217557793140e+00,  3.5533319867905360e+00,  3.5519414364200683e+00,
+                 3.5505500787580626e+00,  3.5491578880308374e+00,  3.5477648386291989e+00,  3.5463709051358263e+00,
+                 3.5449760623515001e+00,  3.5435802853199831e+00,  3.5421835493514000e+00,  3.5407858300439452e+00,
+                 3.5393871033037940e+00,  3.5379873453631134e+00,  3.5365865327960924e+00,  3.5351846425328710e+00,
+                 3.5337816518714256e+00,  3.5323775384872818e+00,  3.5309722804410870e+00,  3.5295658561841021e+00,
+                 3.5281582445615647e+00,  3.5267494248140472e+00,  3.5253393765768202e+00,  3.5239280798773551e+00,
+                 3.5225155151310057e+00,  3.5211016631350245e+00,  3.5196865050610127e+00,  3.5182700224459227e+00,
+                 3.5168521971817452e+00,  3.5154330115040611e+00,  3.5140124479795261e+00,  3.5125904894925224e+00,
+                 3.5111671192310414e+00,  3.5097423206720073e+00,  3.5083160775661404e+00,  3.5068883739225325e+00,
+                 3.5054591939930373e+00,  3.5040285222566463e+00,  3.5025963434039293e+00,  3.5011626423216948e+00,
+                 3.4997274040779272e+00,  3.4982906139071668e+00,  3.4968522571963550e+00,  3.4954123194712601e+00,
+                 3.4939707863835441e+00,  3.4925276436985202e+00,  3.4910828772836697e+00,  3.4896364730979292e+00,
+                 3.4881884171818074e+00,  3.4867386956483153e+00,  3.4852872946747615e+00,  3.4838342004953846e+00,
+                 3.4823793993948229e+00,  3.4809228777024273e+00,  3.4794646217873786e+00,  3.4780046180545865e+00,
+                 3.4765428529413636e+00,  3.4750793129148163e+00,  3.4736139844699196e+00,  3.4721468541282587e+00,
+                 3.4706779084373678e+00,  3.4692071339706532e+00,  3.4677345173278149e+00,  3.4662600451357908e+00,
+                 3.4647837040501046e+00,  3.4633054807566452e+00,  3.4618253619737938e+00,  3.4603433344548722e+00,
+                 3.4588593849909017e+00,  3.4573735004136115e+00,  3.4558856675986669e+00,  3.4543958734691373e+00,
+                 3.4529041049991096e+00,  3.4514103492174995e+00,  3.4499145932120068e+00,  3.4484168241332029e+00,
+                 3.4469170291987576e+00,  3.4454151956978163e+00,  3.4439113109954733e+00,  3.4424053625373991e+00,
+                 3.4408973378546084e+00,  3.4393872245683683e+00,  3.4378750103952722e+00,  3.4363606831524733e+00,
+                 3.4348442307631362e+00,  3.4333256412620634e+00,  3.4318049028015785e+00,  3.4302820036576418e+00,
+                 3.4287569322362299e+00,  3.4272296770800335e+00,  3.4257002268754362e+00,  3.4241685704598654e+00,
+                 3.4226346968294612e+00,  3.4210985951471664e+00,  3.4195602547511643e+00,  3.4180196651637678e+00,
+                 3.4164768161007104e+00,  3.4149316974808719e+00,  3.4133842994364407e+00,  3.4118346123235241e+00,
+                 3.4102826267331783e+00,  3.4087283335028631e+00,  3.4071717237283035e+00,  3.4056127887757182e+00,
+                 3.4040515202943951e+00,  3.4024879102295671e+00,  3.4009219508355146e+00,  3.3993536346888473e+00,
+                 3.3977829547018907e+00,
+            },
+            {   // BC_S23
+                 5.2108878249306949e+00,  5.2173969501283919e+00,  5.2231754288553915e+00,  5.2283114058152922e+00,
+                 5.2328785261068766e+00,  5.2369388208162526e+00,  5.2405449377603865e+00,  5.2437418818996386e+00,
+                 5.2465683850107911e+00,  5.2490579924582246e+00,  5.2512399322096002e+00,  5.2531398148589483e+00,
+                 5.2547802014753122e+00,  5.2561810673063150e+00,  5.2573601828423095e+00,  5.2583334288648329e+00,
+                 5.2591150584204414e+00,  5.2597179158624430e+00,  5.2601536209612521e+00,  5.2604327244333469e+00,
+                 5.2605648399588114e+00,  5.2605587567580816e+00,  5.2604225360142660e+00,  5.2601635938077678e+00,
+                 5.2597887727383670e+00,  5.2593044040171089e+00,  5.2587163614956731e+00,  5.2580301088468326e+00,
+                 5.2572507409040465e+00,  5.2563830200009747e+00,  5.2554314080148208e+00,  5.2544000947053267e+00,
+                 5.2532930228486583e+00,  5.2521139105889842e+00,  5.2508662713669603e+00,  5.2495534317313988e+00,
+                 5.2481785472960407e+00,  5.2467446170662431e+00,  5.2452544963289522e+00,  5.2437109082729547e+00,
+                 5.2421164544839041e+00,  5.2404736244395540e+00,  5.2387848041143901e+00,  5.2370522837888700e+00,
+                 5.2352782651466194e+00,  5.2334648677326605e+00,  5.2316141348368435e+00,  5.2297280388591085e+00,
+                 5.2278084862065377e+00,  5.2258573217663935e+00,  5.2238763329943536e+00,  5.2218672536528494e+00,
+                 5.2198317672305157e+00,  5.2177715100704942e+00,  5.2156880742323848e+00,  5.2135830101100806e+00,
+                 5.2114578288254521e+00,  5.2093140044158819e+00,  5.2071529758318533e+00,  5.2049761487593091e+00,
+                 5.2027848972800603e+00,  5.2005805653823387e+00,  5.1983644683325201e+00,  5.1961378939180900e+00,
+                 5.1939021035710464e+00,  5.1916583333802073e+00,  5.1894077950002355e+00,  5.1871516764645467e+00,
+                 5.1848911429088052e+00,  5.1826273372111924e+00,  5.1803613805552109e+00,  5.1780943729204711e+00,
+                 5.1758273935065002e+00,  5.1735615010943876e+00,  5.1712977343507394e+00,  5.1690371120782990e+00,
+                 5.1667806334172077e+00,  5.1645292780008933e+00,  5.1622840060702195e+00,  5.1600457585495363e+00,
+                 5.1578154570880157e+00,  5.1555940040695942e+00,  5.1533822825947384e+00,  5.1511811564371035e+00,
+                 5.1489914699781174e+00,  5.1468140481223914e+00,  5.1446496961967663e+00,  5.1424991998357905e+00,
+                 5.1403633248562892e+00,  5.1382428171236194e+00,  5.1361384024121364e+00,  5.1340507862623666e+00,
+                 5.1319806538372168e+00,  5.1299286697795621e+00,  5.1278954780734303e+00,  5.1258817019109246e+00,
+                 5.1238879435669320e+00,  5.1219147842836579e+00,  5.1199627841667592e+00,  5.1180324820949625e+00,
+                 5.1161243956447997e+00,  5.1142390210320361e+00,  5.1123768330712895e+00,  5.1105382851551324e+00,
+                 5.1087238092539984e+00,  5.1069338159378654e+00,  5.1051686944208310e+00,  5.1034288126293044e+00,
+                 5.1017145172945479e+00,  5.1000261340701813e+00,  5.0983639676749499e+00,  5.0967283020611136e+00,
+                 5.0951194006085299e+00,  5.0935375063443935e+00,  5.0919828421884468e+00,  5.0904556112233346e+00,
+                 5.0889559969895783e+00,  5.0874841638045725e+00,  5.0860402571048082e+00,  5.0846244038103725e+00,
+                 5.0832367127107156e+00,  5.0818772748704397e+00,  5.0805461640538869e+00,  5.0792434371669684e+00,
+                 5.0779691347148619e+00,  5.0767232812738285e+00,  5.0755058859755078e+00,  5.0743169430018806e+00,
+                 5.0731564320891032e+00,  5.0720243190382552e+00,  5.0709205562311892e+00,  5.0698450831494455e+00,
+                 5.0687978268944107e+00,  5.0677787027067058e+00,  5.0667876144830046e+00,  5.0658244552884151e+00,
+                 5.0648891078626743e+00,  5.0639814451184524e+00,  5.0631013306302375e+00,  5.0622486191122533e+00,
+                 5.0614231568841657e+00,  5.0606247823233055e+00,  5.0598533263024263e+00,  5.0591086126120901e+00,
+                 5.0583904583670432e+00,  5.0576986743960326e+00,  5.0570330656148208e+00,  5.0563934313822640e+00,
+                 5.0557795658395790e+00,  5.0551912582331537e+00,  5.0546282932213655e+00,  5.0540904511662319e+00,
+                 5.0535775084107497e+00,  5.0530892375431069e+00,  5.0526254076490753e+00,  5.0521857845540339e+00,
+                 5.0517701310563137e+00,  5.0513782071535633e+00,  5.0510097702641223e+00,  5.0506645754452570e+00,
+                 5.0503423756104464e+00,  5.0500429217476794e+00,  5.0497659631409419e+00,  5.0495112475969472e+00,
+                 5.0492785216791303e+00,  5.0490675309508841e+00,  5.0488780202298065e+00,  5.0487097338547109e+00,
+                 5.0485624159668250e+00,  5.0484358108065068e+00,  5.0483296630264594e+00,  5.0482437180222055e+00,
+                 5.0481777222802968e+00,  5.0481314237442794e+00,  5.0481045721982198e+00,  5.0480969196671364e+00,
+                 5.0481082208332788e+00,  5.0481382334668243e+00,  5.0481867188691458e+00,  5.0482534423263168e+00,
+                 5.0483381735702135e+00,  5.0484406872440397e+00,  5.0485607633688137e+00,  5.0486981878068997e+00,
+                 5.0488527527183491e+00,  5.0490242570055130e+00,  5.0492125067410516e+00,  5.0494173155743001e+00,
+                 5.0496385051106980e+00,  5.0498759052589310e+00,  5.0501293545402532e+00,  5.0503987003546271e+00,
+                 5.0506837991981630e+00,  5.0509845168267153e+00,  5.0513007283605482e+00,  5.0516323183253133e+00,
+                 5.0519791806250458e+00,  5.0523412184432352e+00,  5.0527183440686310e+00,  5.0531104786430889e+00,
+                 5.0535175518293771e+00,  5.0539395013977195e+00,  5.0543762727306571e+00,  5.0548278182467037e+00,
+                 5.0552940967442348e+00,  5.0557750726680837e+00,  5.0562707153023005e+00,  5.0567809978936475e+00,
+                 5.0573058967114806e+00,  5.0578453900507068e+00,  5.0583994571856836e+00,  5.0589680772838523e+00,
+                 5.0595512282890409e+00,  5.0601488857852566e+00,  5.0607610218527066e+00,  5.0613876039286501e+00,
+                 5.0620285936863585e+00,  5.0626839459461035e+00,  5.0633536076326138e+00,  5.0640375167937792e+00,
+                 5.0647356016956167e+00,  5.0654477800086086e+00,  5.0661739581003751e+00,  5.0669140304494631e+00,
+                 5.0676678791945156e+00,  5.0684353738325711e+00,  5.0692163710793539e+00,  5.0700107149035629e+00,
+                 5.0708182367459349e+00,  5.0716387559326241e+00,  5.0724720802909955e+00,  5.0733180069742563e+00,
+                 5.0741763234997048e+00,  5.0750468090034850e+00,  5.0759292357128025e+00,  5.0768233706345551e+00,
+                 5.0777289774572392e+00,  5.0786458186609300e+00,  5.0795736578279858e+00,  5.0805122621451018e+00,
+                 5.0814614050852960e+00,  5.0824208692564321e+00,  5.0833904494011231e+00,  5.0843699555311046e+00,
+                 5.0853592161776469e+00,  5.0863580817382346e+00,  5.0873664278986617e+00,  5.0883841591086734e+00,
+                 5.0894112120887840e+00,  5.0904475593454475e+00,  5.0914932126717058e+00,  5.0925482266105826e+00,
+                 5.0936127018590813e+00,  5.0946867885913685e+00,  5.0957706896807426e+00,  5.0968646638014858e+00,
+                 5.0979690283931447e+00,
+            },
+            {   // BC_HS_PMAX
+                 9.7788523663421373e+01,  1.0424443942707025e+02,  1.1074429103108885e+02,  1.1728765445619312e+02,
+                 1.2387415932235116e+02,  1.3050348580761300e+02,  1.3717536170694044e+02,  1.4388955962638758e+02,
+                 1.5064589430790485e+02,  1.5744422008003278e+02,  1.6428442842968096e+02,  1.7116644569029097e+02,
+                 1.7809023084167984e+02,  1.8505577341703238e+02,  1.9206309151250665e+02,  1.9911222989513408e+02,
+                 2.0620325820476560e+02,  2.1333626924596322e+02,  2.2051137736590030e+02,  2.2772871691445283e+02,
+                 2.3498844078282090e+02,  2.4229071901718260e+02,  2.4963573750399181e+02,  2.5702369672373476e+02,
+                 2.6445481057003337e+02,  2.7192930523119986e+02,  2.7944741813140342e+02,  2.8700939692881701e+02,
+                 2.9461549856819369e+02,  3.0226598838546147e+02,  3.0996113926204214e+02,  3.1770123082673661e+02,
+                 3.2548654870308479e+02,  3.3331738380026326e+02,  3.4119403164566313e+02,  3.4911679175737697e+02,
+                 3.5708596705495017e+02,  3.6510186330680727e+02,  3.7316478861287470e+02,  3.8127505292097965e+02,
+                 3.8943296757571306e+02,  3.9763884489847402e+02,  4.0589299779753412e+02,  4.1419573940698081e+02,
+                 4.2254738275350104e+02,  4.3094824044997250e+02,  4.3939862441496962e+02,  4.4789884561725057e+02,
+                 4.5644921384440659e+02,  4.6505003749488571e+02,  4.7370162339262782e+02,  4.8240427662362828e+02,
+                 4.9115830039373407e+02,  4.9996399590707762e+02,  5.0882166226451812e+02,  5.1773159638154732e+02,
+                 5.2669409292511864e+02,  5.3570944426887650e+02,  5.4477794046632368e+02,  5.5389986924142863e+02,
+                 5.6307551599625322e+02,  5.7230516383514168e+02,  5.8158909360507823e+02,  5.9092758395176929e+02,
+                 6.0032091139107524e+02,  6.0976935039536977e+02,  6.1927317349442626e+02,  6.2883265139043635e+02,
+                 6.3844805308672960e+02,  6.4811964602977503e+02,  6.5784769626402056e+02,  6.6763246859909464e+02,
+                 6.7747422678887847e+02,  6.8737323372192736e+02,  6.9732975162265529e+02,  7.0734404226267782e+02,
+                 7.1741636718163477e+02,  7.2754698791675389e+02,  7.3773616624036185e+02,  7.4798416440441042e+02,
+                 7.5829124539107818e+02,  7.6865767316831398e+02,  7.7908371294913275e+02,  7.8956963145329610e+02,
+                 8.0011569716989641e+02,  8.1072218061918056e+02,  8.2138935461175708e+02,  8.3211749450315529e+02,
+                 8.4290687844146498e+02,  8.5375778760554851e+02,  8.6467050643106177e+02,  8.7564532282122195e+02,
+                 8.8668252833897100e+02,  8.9778241837683265e+02,  9.0894529230044031e+02,  9.2017145356129402e+02,
+                 9.3146120977397129e+02,  9.4281487275254312e+02,  9.5423275850058735e+02,  9.6571518714870024e+02,
+                 9.7726248283302425e+02,  9.8887497350784531e+02,  1.0005529906849384e+03,  1.0122968690919289e+03,
+                 1.0241069462416317e+03,  1.0359835619040762e+03,  1.0479270574727288e+03,  1.0599377752164560e+03,
+                 1.0720160574088143e+03,  1.0841622453267073e+03,  1.0963766781109662e+03,  1.1086596914824393e+03,
+                 1.1210116163084990e+03,  1.1334327770167870e+03,  1.1459234898554728e+03,  1.1584840610026283e+03,
+                 1.1711147845313774e+03,  1.1838159402428500e+03,  1.1965877913853676e+03,  1.2094305822865365e+03,
+                 1.2223445359346824e+03,  1.2353298515582642e+03,  1.2483867022664313e+03,  1.2615152328315560e+03,
+                 1.2747155577155886e+03,  1.2879877594673346e+03,  1.3013318876475428e+03,  1.3147479584741654e+03,
+                 1.3282359554217844e+03,  1.3417958310583206e+03,  1.3554275104594810e+03,  1.3691308966084919e+03,
+                 1.3829058782666125e+03,  1.3967523408903764e+03,  1.4106701812759070e+03,  1.4246593267310402e+03,
+                 1.4387197597137115e+03,  1.4528515490327211e+03,  1.4670548888857879e+03,  1.4813301472122396e+03,
+                 1.4956779250649777e+03,  1.5100991289600659e+03,  1.5245950584428090e+03,  1.5391675114162022e+03,
+                 1.5538189101087564e+03,  1.5686345047912669e+03,  1.5834176413125836e+03,  1.5982813365020406e+03,
+                 1.6132305450261204e+03,  1.6282667860979304e+03,  1.6433894237583511e+03,  1.6585965914030969e+03,
+                 1.6738858449563522e+03,  1.6892546102145168e+03,  1.7047004755595119e+03,  1.7202213700575696e+03,
+                 1.7358156580847383e+03,  1.7514821745173151e+03,  1.7672202188390841e+03,  1.7830295219808386e+03,
+                 1.7989101961207398e+03,  1.8148626748676518e+03,  1.8308876490787854e+03,  1.8469860019202899e+03,
+                 1.8631587455505216e+03,  1.8794069609199855e+03,  1.8957317415610719e+03,  1.9121341418308702e+03,
+                 1.9286151298239574e+03,  1.9451755450472540e+03,  1.9618160609099091e+03,  1.9785371520931196e+03,
+                 1.9953390668891975e+03,  2.0122218045990621e+03,  2.0291850980173847e+03,  2.0462284009131549e+03,
+                 2.0633508803160016e+03,  2.0805514136728634e+03,  2.0978285924039751e+03,  2.1151807380718715e+03,
+                 2.1326059496071439e+03,  2.1501022286540638e+03,  2.1676677924830069e+03,  2.1853018131274607e+03,
+                 2.2030060787199127e+03,  2.2207885694424745e+03,  2.2386708732732368e+03,  2.2567016033938016e+03,
+                 2.2747729838046271e+03,  2.2929101913820937e+03,  2.3111140546791967e+03,  2.3293855260755586e+03,
+                 2.3477256785484246e+03,  2.3661356995268825e+03,  2.3846168818378051e+03,  2.4031706118009902e+03,
+                 2.4217983545816110e+03,  2.4405016369611917e+03,  2.4592820277439682e+03,  2.4781411160750067e+03,
+                 2.4970804880104452e+03,  2.5161017017483418e+03,  2.5352062619986405e+03,  2.5543955940307128e+03,
+                 2.5736710179566717e+03,  2.5930337237137819e+03,  2.6124847468303965e+03,  2.6320249440348534e+03,
+                 2.6516549653522225e+03,  2.6713752140600841e+03,  2.6911857749352903e+03,  2.7110862694166012e+03,
+                 2.7310755542531388e+03,  2.7511511014144157e+03,  2.7713077531707895e+03,  2.7915352896516347e+03,
+                 2.8118137981777800e+03,  2.8322323554255440e+03,  2.8527147121668427e+03,  2.8732816537328508e+03,
+                 2.8939625992456317e+03,  2.9147626369081918e+03,  2.9356745029463227e+03,  2.9566871922432892e+03,
+                 2.9777912337858825e+03,  2.9989812410148938e+03,  3.0202565171312194e+03,  3.0416204506431195e+03,
+                 3.0630792975970812e+03,  3.0846407838604496e+03,  3.1063128099952805e+03,  3.1281024184445882e+03,
+                 3.1500150916533407e+03,  3.1720543877106952e+03,  3.1942218817271446e+03,  3.2165173604736447e+03,
+                 3.2389392094185923e+03,  3.2614849309034553e+03,  3.2841517366651565e+03,  3.3069371651211368e+03,
+                 3.3298396824247734e+03,  3.3528592354225589e+03,  3.3759977337489167e+03,  3.3992594469836781e+03,
+                 3.4226513107555193e+03,  3.4461831426412427e+03,  3.4698677744812385e+03,  3.4937211121793125e+03,
+                 3.5177340225940593e+03,  3.5418722458046241e+03,  3.5661685813372455e+03,  3.5906208191522387e+03,
+                 3.6152272379535630e+03,  3.6399864108576821e+03,  3.6648970444061247e+03,  3.6899578609618784e+03,
+                 3.7151675302228418e+03,
+            },
+            {   // BC_HS_PMIN
+                -4.1557181219707716e-02,  2.5037782516696293e+03,  2.5067595684619532e+03,  2.5097550588291751e+03,
+                 2.5127658049036659e+03,  2.5157926351870110e+03,  2.5188361845822187e+03,  2.5218969408372714e+03,
+                 2.5249752803938609e+03,  2.5280714959918428e+03,  2.5311858178708217e+03,  2.5343184300083476e+03,
+                 2.5374694825178390e+03,  2.5406391010808511e+03,  2.5438273940936274e+03,  2.5470344580556016e+03,
+                 2.5502603816086689e+03,  2.5535052485434871e+03,  2.5567691400170220e+03,  2.5600521361696669e+03,
+                 2.5633543172868503e+03,  2.5666757646165333e+03,  2.5700165609279920e+03,  2.5733767908772725e+03,
+                 2.5767565412292274e+03,  2.5801559009741850e+03,  2.5835749613680991e+03,  2.5870138159180715e+03,
+                 2.5904725603297088e+03,  2.5939512924286810e+03,  2.5974501120657010e+03,  2.6009691210117448e+03,
+                 2.6045084228485130e+03,  2.6080681228577600e+03,  2.6116483279120566e+03,  2.6152491463687902e+03,
+                 2.6188706879685933e+03,  2.6225130637389716e+03,  2.6261763859035759e+03,  2.6298607677973146e+03,
+                 2.6335663237873491e+03,  2.6372931691998724e+03,  2.6410414202525094e+03,  2.6448111939921009e+03,
+                 2.6486026082376084e+03,  2.6524157815278531e+03,  2.6562508330737933e+03,  2.6601078827150427e+03,
+                 2.6639870508803392e+03,  2.6678884585516826e+03,  2.6718122272318478e+03,  2.6757584789150487e+03,
+                 2.6797273360604818e+03,  2.6837189215685207e+03,  2.6877333587593389e+03,  2.6917707713537920e+03,
+                 2.6958312834563108e+03,  2.6999150195396924e+03,  2.7040221044315704e+03,  2.7081526633024587e+03,
+                 2.7123068216552001e+03,  2.7164847053156955e+03,  2.7206864404248122e+03,  2.7249121534313363e+03,
+                 2.7291619710858931e+03,  2.7334360204357149e+03,  2.7377344288202112e+03,  2.7420573238672187e+03,
+                 2.7464048334899021e+03,  2.7507770858842046e+03,  2.7551742095268123e+03,  2.7595963331735798e+03,
+                 2.7640435858583469e+03,  2.7685160968921273e+03,  2.7730139958626055e+03,  2.7775374126339275e+03,
+                 2.7820864773467342e+03,  2.7866613204184200e+03,  2.7912620725435804e+03,  2.7958888646946307e+03,
+                 2.8005418281225730e+03,  2.8052210943578871e+03,  2.8099267952115406e+03,  2.8146590627760820e+03,
+                 2.8194180294268185e+03,  2.8242038278230730e+03,  2.8290165909094871e+03,  2.8338564519173751e+03,
+                 2.8387235443661230e+03,  2.8436180020646138e+03,  2.8485399591126829e+03,  2.8534895499025943e+03,
+                 2.8584669091205301e+03,  2.8634721717480943e+03,  2.8685054730638194e+03,  2.8735669486446832e+03,
+                 2.8786567343676243e+03,  2.8837749664110543e+03,  2.8889217812563757e+03,  2.8940973156894802e+03,
+                 2.8993017068022582e+03,  2.9045350919940784e+03,  2.9097976089732852e+03,  2.9150893957586559e+03,
+                 2.9204105906808677e+03,  2.9257613323839341e+03,  2.9311417598266462e+03,  2.9365520122839694e+03,
+                 2.9419922293484524e+03,  2.9474625509315924e+03,  2.9529631172651902e+03,  2.9584940689026794e+03,
+                 2.9640555467204358e+03,  2.9696476919190427e+03,  2.9752706460245499e+03,  2.9809245508896797e+03,
+                 2.9866095486950130e+03,  2.9923257819501250e+03,  2.9980733934946934e+03,  3.0038525264995515e+03,
+                 3.0096633244676959e+03,  3.0155059312352491e+03,  3.0213804909723676e+03,  3.0272871481840757e+03,
+                 3.0332260477110526e+03,  3.0391973347303547e+03,  3.0452011547560455e+03,  3.0512376536397683e+03,
+                 3.0573069775712247e+03,  3.0634092730785837e+03,  3.0695446870287683e+03,  3.0757133666276754e+03,
+                 3.0819154594202751e+03,  3.0881511132906098e+03,  3.0944204764616720e+03,  3.1007236974951634e+03,
+                 3.1070609252911349e+03,  3.1134323090874832e+03,  3.1198379984593244e+03,  3.1262781433181963e+03,
+                 3.1327528939111462e+03,  3.1392624008196358e+03,  3.1458068149582950e+03,  3.1523862875734972e+03,
+                 3.1590009702417742e+03,  3.1656510148680454e+03,  3.1723365736836527e+03,  3.1790577992442168e+03,
+                 3.1858148444272861e+03,  3.1926078624297993e+03,  3.1994370067653163e+03,  3.2063024312610582e+03,
+                 3.2132042900547217e+03,  3.2201427375910821e+03,  3.2271179286183569e+03,  3.2341300181843571e+03,
+                 3.2411791616323931e+03,  3.2482655145969652e+03,  3.2553892329992041e+03,  3.2625504730420789e+03,
+                 3.2697493912053624e+03,  3.2769861442403744e+03,  3.2842608891644591e+03,  3.2915737832552568e+03,
+                 3.2989249840447023e+03,  3.3063146493128256e+03,  3.3137429370812938e+03,  3.3212100056067416e+03,
+                 3.3287160133738689e+03,  3.3362611190883272e+03,  3.3438454816693870e+03,  3.3514692602424166e+03,
+                 3.3591326141311461e+03,  3.3668357028497621e+03,  3.3745786860948156e+03,  3.3823617237369763e+03,
+                 3.3901849758126323e+03,  3.3980486025153505e+03,  3.4059527641872269e+03,  3.4138976213101205e+03,
+                 3.4218833344968234e+03,  3.4299100644821419e+03,  3.4379779721139535e+03,  3.4460872183442352e+03,
+                 3.4542379642201076e+03,  3.4624303708748930e+03,  3.4706645995192544e+03,  3.4789408114324087e+03,
+                 3.4872591679534767e+03,  3.4956198304729710e+03,  3.5040229604244946e+03,  3.5124687192766610e+03,
+                 3.5209572685252911e+03,  3.5294887696859059e+03,  3.5380633842866073e+03,  3.5466812738613257e+03,
+                 3.5553425999435658e+03,  3.5640475240606106e+03,  3.5727962077283164e+03,  3.5815888124465250e+03,
+                 3.5904254996951286e+03,  3.5993064309308993e+03,  3.6082317675850991e+03,  3.6172016710619828e+03,
+                 3.6262163027382203e+03,  3.6352758239633476e+03,  3.6443803960613072e+03,  3.6535301803331586e+03,
+                 3.6627253380610373e+03,  3.6719660305134680e+03,  3.6812524189520905e+03,  3.6905846646399309e+03,
+                 3.6999629288512597e+03,  3.7093873728832004e+03,  3.7188581580691548e+03,  3.7283754457941263e+03,
+                 3.7379393975121397e+03,  3.7475501747657695e+03,  3.7572079392079654e+03,  3.7669128526262662e+03,
+                 3.7766650769695589e+03,  3.7864647743774622e+03,  3.7963121072125291e+03,  3.8062072380953696e+03,
+                 3.8161503299428482e+03,  3.8261415460095218e+03,  3.8361810499324351e+03,  3.8462690057794689e+03,
+                 3.8564055781013976e+03,  3.8665909319877983e+03,  3.8768252331270132e+03,  3.8871086478703496e+03,
+                 3.8974413433006621e+03,  3.9078234873055490e+03,  3.9182552486553595e+03,  3.9287367970861560e+03,
+                 3.9392683033879175e+03,  3.9498499394981436e+03,  3.9604818786011028e+03,  3.9711642952329416e+03,
+                 3.9818973653928933e+03,  3.9926812666608334e+03,  4.0035161783214039e+03,  4.0144022814949935e+03,
+                 4.0253397592758242e+03,  4.0363287968773925e+03,  4.0473695817855764e+03,  4.0584623039196940e+03,
+                 4.0696071558017588e+03,  4.0808043327343130e+03,  4.0920540329870873e+03,  4.1033564579928407e+03,
+                 4.1147118125527231e+03,  4.1261203050514496e+03,  4.1375821476827414e+03,  4.1490975566852749e+03,
+                 4.1606843425201123e+03,
+            },
+        };
+        alignas(64) static constexpr double band[BC_COUNT][BOUNDARY_INTERVALS] = {
+            {   // BC_HMIN
+                2.01e-09, 2.01e-09, 1.34e-09, 1.40e-09, 1.47e-09, 1.54e-09, 1.61e-09, 1.69e-09,
+                1.77e-09, 1.85e-09, 1.94e-09, 2.04e-09, 2.13e-09, 2.24e-09, 2.34e-09, 2.46e-09,
+                2.57e-09, 2.70e-09, 2.82e-09, 2.96e-09, 3.10e-09, 3.25e-09, 3.41e-09, 3.57e-09,
+                3.74e-09, 3.92e-09, 4.11e-09, 4.31e-09, 4.51e-09, 4.73e-09, 4.95e-09, 5.19e-09,
+                5.44e-09, 5.70e-09, 5.98e-09, 6.26e-09, 6.56e-09, 6.88e-09, 7.21e-09, 7.55e-09,
+                7.92e-09, 8.29e-09, 8.69e-09, 9.11e-09, 9.55e-09, 1.00e-08, 1.05e-08, 1.10e-08,
+                1.16e-08, 1.21e-08, 1.27e-08, 1.33e-08, 1.39e-08, 1.46e-08, 1.53e-08, 1.60e-08,
+                1.68e-08, 1.76e-08, 1.84e-08, 1.93e-08, 2.03e-08, 2.12e-08, 2.22e-08, 2.33e-08,
+                2.44e-08, 2.56e-08, 2.68e-08, 2.81e-08, 2.94e-08, 3.09e-08, 3.23e-08, 3.39e-08,
+                3.55e-08, 3.72e-08, 3.90e-08, 4.09e-08, 4.28e-08, 4.49e-08, 4.70e-08, 4.93e-08,
+                5.16e-08, 5.41e-08, 5.67e-08, 5.94e-08, 6.23e-08, 6.53e-08, 6.84e-08, 7.17e-08,
+                7.51e-08, 7.87e-08, 8.25e-08, 8.65e-08, 9.06e-08, 9.50e-08, 9.95e-08, 1.05e-07,
+                1.10e-07, 1.15e-07, 1.20e-07, 1.26e-07, 1.32e-07, 1.39e-07, 1.45e-07, 1.52e-07,
+                1.59e-07, 1.67e-07, 1.75e-07, 1.83e-07, 1.92e-07, 2.01e-07, 2.11e-07, 2.21e-07,
+                2.32e-07, 2.43e-07, 2.54e-07, 2.66e-07, 2.79e-07, 2.93e-07, 3.07e-07, 3.21e-07,
+                3.37e-07, 3.53e-07, 3.70e-07, 3.87e-07, 4.06e-07, 4.25e-07, 4.45e-07, 4.67e-07,
+                4.89e-07, 5.12e-07, 5.37e-07, 5.63e-07, 5.90e-07, 6.18e-07, 6.47e-07, 6.78e-07,
+                7.10e-07, 7.44e-07, 7.80e-07, 8.17e-07, 8.56e-07, 8.97e-07, 9.40e-07, 9.85e-07,
+                1.04e-06, 1.09e-06, 1.14e-06, 1.19e-06, 1.25e-06, 1.31e-06, 1.37e-06, 1.43e-06,
+                1.50e-06, 1.57e-06, 1.65e-06, 1.72e-06, 1.81e-06, 1.89e-06, 1.98e-06, 2.07e-06,
+                2.17e-06, 2.27e-06, 2.38e-06, 2.49e-06, 2.61e-06, 2.73e-06, 2.86e-06, 3.00e-06,
+                3.14e-06, 3.28e-06, 3.44e-06, 3.60e-06, 3.77e-06, 3.94e-06, 4.13e-06, 4.32e-06,
+                4.52e-06, 4.73e-06, 4.95e-06, 5.18e-06, 5.42e-06, 5.67e-06, 5.93e-06, 6.20e-06,
+                6.49e-06, 6.78e-06, 7.09e-06, 7.42e-06, 7.75e-06, 8.11e-06, 8.47e-06, 8.85e-06,
+                9.25e-06, 9.67e-06, 1.01e-05, 1.06e-05, 1.11e-05, 1.16e-05, 1.21e-05, 1.26e-05,
+                1.31e-05, 1.37e-05, 1.43e-05, 1.49e-05, 1.55e-05, 1.62e-05, 1.69e-05, 1.76e-05,
+                1.83e-05, 1.91e-05, 1.99e-05, 2.07e-05, 2.16e-05, 2.24e-05, 2.34e-05, 2.43e-05,
+                2.53e-05, 2.63e-05, 2.73e-05, 2.83e-05, 2.94e-05, 3.05e-05, 3.17e-05, 3.29e-05,
+                3.41e-05, 3.54e-05, 3.67e-05, 3.80e-05, 3.94e-05, 4.08e-05, 4.22e-05, 4.37e-05,
+                4.52e-05, 4.68e-05, 4.84e-05, 5.00e-05, 5.17e-05, 5.35e-05, 5.53e-05, 5.71e-05,
+                5.90e-05, 6.10e-05, 6.31e-05, 6.52e-05, 6.74e-05, 6.96e-05, 7.20e-05, 7.43e-05,
+                7.68e-05, 7.93e-05, 8.18e-05, 8.42e-05, 8.66e-05, 8.89e-05, 1.49e-04, 1.49e-04,
+            },
+            {   // BC_HMAX
+                8.96e-09, 8.96e-09, 5.99e-09, 6.26e-09, 6.54e-09, 6.87e-09, 7.18e-09, 7.53e-09,
+                7.88e-09, 8.26e-09, 8.65e-09, 9.06e-09, 9.48e-09, 9.96e-09, 1.05e-08, 1.10e-08,
+                1.15e-08, 1.20e-08, 1.26e-08, 1.32e-08, 1.38e-08, 1.45e-08, 1.52e-08, 1.59e-08,
+                1.67e-08, 1.75e-08, 1.83e-08, 1.92e-08, 2.01e-08, 2.10e-08, 2.21e-08, 2.31e-08,
+                2.42e-08, 2.54e-08, 2.66e-08, 2.79e-08, 2.92e-08, 3.06e-08, 3.20e-08, 3.36e-08,
+                3.52e-08, 3.69e-08, 3.86e-08, 4.05e-08, 4.24e-08, 4.45e-08, 4.66e-08, 4.88e-08,
+                5.12e-08, 5.36e-08, 5.62e-08, 5.89e-08, 6.17e-08, 6.47e-08, 6.78e-08, 7.10e-08,
+                7.44e-08, 7.80e-08, 8.17e-08, 8.56e-08, 8.97e-08, 9.41e-08, 9.86e-08, 1.04e-07,
+                1.09e-07, 1.14e-07, 1.19e-07, 1.25e-07, 1.31e-07, 1.37e-07, 1.44e-07, 1.51e-07,
+                1.58e-07, 1.66e-07, 1.73e-07, 1.82e-07, 1.90e-07, 2.00e-07, 2.09e-07, 2.19e-07,
+                2.30e-07, 2.41e-07, 2.52e-07, 2.64e-07, 2.77e-07, 2.90e-07, 3.04e-07, 3.19e-07,
+                3.34e-07, 3.50e-07, 3.67e-07, 3.85e-07, 4.03e-07, 4.22e-07, 4.43e-07, 4.64e-07,
+                4.86e-07, 5.10e-07, 5.34e-07, 5.60e-07, 5.87e-07, 6.15e-07, 6.44e-07, 6.75e-07,
+                7.08e-07, 7.42e-07, 7.78e-07, 8.15e-07, 8.54e-07, 8.95e-07, 9.38e-07, 9.84e-07,
+                1.04e-06, 1.09e-06, 1.14e-06, 1.19e-06, 1.25e-06, 1.31e-06, 1.37e-06, 1.44e-06,
+                1.51e-06, 1.58e-06, 1.66e-06, 1.74e-06, 1.82e-06, 1.91e-06, 2.00e-06, 2.10e-06,
+                2.20e-06, 2.30e-06, 2.41e-06, 2.53e-06, 2.65e-06, 2.78e-06, 2.92e-06, 3.06e-06,
+                3.20e-06, 3.36e-06, 3.52e-06, 3.69e-06, 3.87e-06, 4.06e-06, 4.26e-06, 4.47e-06,
+                4.68e-06, 4.91e-06, 5.15e-06, 5.40e-06, 5.67e-06, 5.94e-06, 6.24e-06, 6.54e-06,
+                6.86e-06, 7.20e-06, 7.55e-06, 7.92e-06, 8.31e-06, 8.72e-06, 9.15e-06, 9.60e-06,
+                1.01e-05, 1.06e-05, 1.11e-05, 1.17e-05, 1.23e-05, 1.29e-05, 1.35e-05, 1.42e-05,
+                1.49e-05, 1.56e-05, 1.64e-05, 1.72e-05, 1.81e-05, 1.90e-05, 2.00e-05, 2.10e-05,
+                2.20e-05, 2.31e-05, 2.43e-05, 2.55e-05, 2.68e-05, 2.82e-05, 2.96e-05, 3.11e-05,
+                3.27e-05, 3.43e-05, 3.60e-05, 3.79e-05, 3.98e-05, 4.18e-05, 4.39e-05, 4.61e-05,
+                4.85e-05, 5.09e-05, 5.34e-05, 5.61e-05, 5.89e-05, 6.18e-05, 6.49e-05, 6.81e-05,
+                7.14e-05, 7.48e-05, 7.84e-05, 8.21e-05, 8.60e-05, 8.99e-05, 9.40e-05, 9.82e-05,
+                1.03e-04, 1.07e-04, 1.12e-04, 1.16e-04, 1.20e-04, 1.25e-04, 1.29e-04, 1.33e-04,
+                1.37e-04, 1.40e-04, 1.43e-04, 1.46e-04, 1.48e-04, 1.49e-04, 1.49e-04, 1.49e-04,
+                1.49e-04, 1.48e-04, 1.45e-04, 1.41e-04, 1.34e-04, 1.25e-04, 1.14e-04, 9.80e-05,
+                7.90e-05, 5.56e-05, 4.91e-05, 9.83e-05, 1.57e-04, 2.25e-04, 3.04e-04, 3.96e-04,
+                5.02e-04, 6.24e-04, 7.64e-04, 9.22e-04, 1.11e-03, 1.31e-03, 1.54e-03, 1.79e-03,
+                2.07e-03, 2.37e-03, 2.70e-03, 3.06e-03, 3.44e-03, 3.83e-03, 6.51e-03, 6.51e-03,
+            },
+            {   // BC_HLIQ
+                4.96e-07, 4.96e-07, 2.93e-07, 2.65e-07, 2.38e-07, 2.12e-07, 1.86e-07, 1.61e-07,
+                1.36e-07, 1.12e-07, 8.72e-08, 6.37e-08, 4.06e-08, 2.64e-08, 4.79e-08, 6.91e-08,
+                8.99e-08, 1.11e-07, 1.31e-07, 1.51e-07, 1.71e-07, 1.90e-07, 2.09e-07, 2.28e-07,
+                2.46e-07, 2.65e-07, 2.83e-07, 3.01e-07, 3.18e-07, 3.36e-07, 3.53e-07, 3.70e-07,
+                3.87e-07, 4.04e-07, 4.21e-07, 4.38e-07, 4.54e-07, 4.71e-07, 4.87e-07, 5.03e-07,
+                5.19e-07, 5.35e-07, 5.51e-07, 5.67e-07, 5.83e-07, 5.99e-07, 6.15e-07, 6.31e-07,
+                6.47e-07, 6.63e-07, 6.79e-07, 6.95e-07, 7.11e-07, 7.27e-07, 7.43e-07, 7.59e-07,
+                7.75e-07, 7.91e-07, 8.08e-07, 8.24e-07, 8.41e-07, 8.58e-07, 8.75e-07, 8.92e-07,
+                9.09e-07, 9.27e-07, 9.44e-07, 9.62e-07, 9.80e-07, 9.98e-07, 1.02e-06, 1.04e-06,
+                1.06e-06, 1.08e-06, 1.10e-06, 1.12e-06, 1.14e-06, 1.16e-06, 1.18e-06, 1.20e-06,
+                1.22e-06, 1.24e-06, 1.27e-06, 1.29e-06, 1.31e-06, 1.33e-06, 1.36e-06, 1.38e-06,
+                1.41e-06, 1.43e-06, 1.46e-06, 1.49e-06, 1.51e-06, 1.54e-06, 1.57e-06, 1.60e-06,
+                1.63e-06, 1.66e-06, 1.69e-06, 1.72e-06, 1.75e-06, 1.79e-06, 1.82e-06, 1.86e-06,
+                1.89e-06, 1.93e-06, 1.97e-06, 2.00e-06, 2.04e-06, 2.09e-06, 2.13e-06, 2.17e-06,
+                2.22e-06, 2.26e-06, 2.31e-06, 2.36e-06, 2.41e-06, 2.46e-06, 2.51e-06, 2.57e-06,
+                2.62e-06, 2.68e-06, 2.74e-06, 2.80e-06, 2.86e-06, 2.93e-06, 3.00e-06, 3.07e-06,
+                3.14e-06, 3.21e-06, 3.29e-06, 3.37e-06, 3.45e-06, 3.54e-06, 3.63e-06, 3.72e-06,
+                3.81e-06, 3.91e-06, 4.01e-06, 4.11e-06, 4.22e-06, 4.34e-06, 4.45e-06, 4.57e-06,
+                4.70e-06, 4.83e-06, 4.97e-06, 5.11e-06, 5.25e-06, 5.41e-06, 5.56e-06, 5.73e-06,
+                5.90e-06, 6.08e-06, 6.27e-06, 6.46e-06, 6.66e-06, 6.87e-06, 7.09e-06, 7.32e-06,
+                7.56e-06, 7.81e-06, 8.07e-06, 8.34e-06, 8.63e-06, 8.93e-06, 9.24e-06, 9.57e-06,
+                9.91e-06, 1.03e-05, 1.07e-05, 1.11e-05, 1.15e-05, 1.19e-05, 1.24e-05, 1.29e-05,
+                1.34e-05, 1.39e-05, 1.45e-05, 1.50e-05, 1.57e-05, 1.63e-05, 1.70e-05, 1.77e-05,
+                1.85e-05, 1.93e-05, 2.02e-05, 2.11e-05, 2.21e-05, 2.31e-05, 2.42e-05, 2.53e-05,
+                2.66e-05, 2.79e-05, 2.93e-05, 3.08e-05, 3.24e-05, 3.41e-05, 3.60e-05, 3.80e-05,
+                4.01e-05, 4.24e-05, 4.49e-05, 4.76e-05, 5.05e-05, 5.37e-05, 5.71e-05, 6.09e-05,
+                6.50e-05, 6.96e-05, 7.46e-05, 8.01e-05, 8.62e-05, 9.30e-05, 1.01e-04, 1.10e-04,
+                1.19e-04, 1.30e-04, 1.42e-04, 1.55e-04, 1.71e-04, 1.88e-04, 2.08e-04, 2.30e-04,
+                2.56e-04, 2.86e-04, 3.19e-04, 3.58e-04, 4.03e-04, 4.54e-04, 5.15e-04, 5.86e-04,
+                6.71e-04, 7.77e-04, 9.11e-04, 1.09e-03, 1.32e-03, 1.65e-03, 2.10e-03, 2.74e-03,
+                3.63e-03, 4.87e-03, 6.56e-03, 8.79e-03, 1.16e-02, 1.50e-02, 5.11e-02, 3.12e-01,
+                3.17e-01, 3.17e-01, 2.96e-01, 7.66e-01, 3.08e+00, 1.03e+02, 8.47e+02, std::numeric_limits<double>::infinity(),
+            },
+            {   // BC_HVAP
+                1.21e-07, 1.21e-07, 7.35e-08, 7.40e-08, 7.45e-08, 7.48e-08, 7.52e-08, 7.55e-08,
+                7.57e-08, 7.58e-08, 7.58e-08, 7.58e-08, 7.58e-08, 7.58e-08, 7.58e-08, 7.56e-08,
+                7.53e-08, 7.50e-08, 7.45e-08, 7.39e-08, 7.33e-08, 7.25e-08, 7.16e-08, 7.05e-08,
+                6.94e-08, 6.81e-08, 6.67e-08, 6.51e-08, 6.33e-08, 6.15e-08, 5.94e-08, 5.72e-08,
+                5.49e-08, 5.23e-08, 4.96e-08, 4.66e-08, 4.35e-08, 4.02e-08, 3.67e-08, 3.30e-08,
+                2.90e-08, 2.48e-08, 2.05e-08, 1.58e-08, 1.10e-08, 5.81e-09, 1.11e-08, 1.73e-08,
+                2.37e-08, 3.04e-08, 3.74e-08, 4.47e-08, 5.22e-08, 6.01e-08, 6.83e-08, 7.69e-08,
+                8.57e-08, 9.49e-08, 1.05e-07, 1.15e-07, 1.25e-07, 1.36e-07, 1.47e-07, 1.58e-07,
+                1.70e-07, 1.83e-07, 1.96e-07, 2.09e-07, 2.23e-07, 2.37e-07, 2.52e-07, 2.67e-07,
+                2.83e-07, 3.00e-07, 3.17e-07, 3.34e-07, 3.53e-07, 3.72e-07, 3.92e-07, 4.13e-07,
+                4.34e-07, 4.57e-07, 4.80e-07, 5.04e-07, 5.29e-07, 5.55e-07, 5.82e-07, 6.11e-07,
+                6.40e-07, 6.71e-07, 7.03e-07, 7.36e-07, 7.70e-07, 8.06e-07, 8.44e-07, 8.83e-07,
+                9.23e-07, 9.65e-07, 1.01e-06, 1.06e-06, 1.11e-06, 1.16e-06, 1.21e-06, 1.26e-06,
+                1.31e-06, 1.37e-06, 1.43e-06, 1.49e-06, 1.55e-06, 1.62e-06, 1.69e-06, 1.76e-06,
+                1.83e-06, 1.90e-06, 1.98e-06, 2.06e-06, 2.14e-06, 2.22e-06, 2.30e-06, 2.39e-06,
+                2.48e-06, 2.57e-06, 2.66e-06, 2.75e-06, 2.85e-06, 2.95e-06, 3.05e-06, 3.15e-06,
+                3.25e-06, 3.36e-06, 3.46e-06, 3.57e-06, 3.68e-06, 3.79e-06, 3.90e-06, 4.02e-06,
+                4.14e-06, 4.26e-06, 4.38e-06, 4.51e-06, 4.64e-06, 4.78e-06, 4.92e-06, 5.06e-06,
+                5.22e-06, 5.38e-06, 5.54e-06, 5.72e-06, 5.90e-06, 6.10e-06, 6.31e-06, 6.53e-06,
+                6.77e-06, 7.02e-06, 7.29e-06, 7.58e-06, 7.89e-06, 8.22e-06, 8.58e-06, 8.96e-06,
+                9.37e-06, 9.80e-06, 1.03e-05, 1.08e-05, 1.13e-05, 1.19e-05, 1.25e-05, 1.31e-05,
+                1.38e-05, 1.45e-05, 1.52e-05, 1.60e-05, 1.68e-05, 1.77e-05, 1.86e-05, 1.95e-05,
+                2.05e-05, 2.16e-05, 2.27e-05, 2.38e-05, 2.50e-05, 2.63e-05, 2.76e-05, 2.90e-05,
+                3.04e-05, 3.19e-05, 3.36e-05, 3.53e-05, 3.71e-05, 3.90e-05, 4.10e-05, 4.31e-05,
+                4.54e-05, 4.78e-05, 5.04e-05, 5.32e-05, 5.61e-05, 5.93e-05, 6.27e-05, 6.63e-05,
+                7.02e-05, 7.44e-05, 7.90e-05, 8.39e-05, 8.92e-05, 9.50e-05, 1.02e-04, 1.09e-04,
+                1.16e-04, 1.25e-04, 1.34e-04, 1.45e-04, 1.57e-04, 1.70e-04, 1.85e-04, 2.02e-04,
+                2.21e-04, 2.42e-04, 2.66e-04, 2.94e-04, 3.25e-04, 3.59e-04, 3.98e-04, 4.42e-04,
+                4.91e-04, 5.47e-04, 6.10e-04, 6.83e-04, 7.68e-04, 8.68e-04, 9.89e-04, 1.14e-03,
+                1.33e-03, 1.58e-03, 1.89e-03, 2.30e-03, 2.82e-03, 3.50e-03, 4.36e-03, 5.45e-03,
+                6.79e-03, 8.41e-03, 1.04e-02, 1.27e-02, 1.54e-02, 1.84e-02, 1.84e-02, 6.44e-01,
+                6.51e-01, 6.59e-01, 5.00e-01, 1.19e+00, 4.45e+00, 1.25e+02, 9.52e+02, std::numeric_limits<double>::infinity(),
+            },
+            {   // BC_H13
+                1.44e-05, 1.44e-05, 8.61e-06, 8.47e-06, 8.33e-06, 8.18e-06, 8.03e-06, 7.87e-06,
+                7.70e-06, 7.53e-06, 7.36e-06, 7.19e-06, 7.01e-06, 6.83e-06, 6.64e-06, 6.46e-06,
+                6.27e-06, 6.08e-06, 5.89e-06, 5.70e-06, 5.51e-06, 5.32e-06, 5.13e-06, 4.94e-06,
+                4.75e-06, 4.57e-06, 4.38e-06, 4.20e-06, 4.02e-06, 3.84e-06, 3.66e-06, 3.49e-06,
+                3.32e-06, 3.16e-06, 3.00e-06, 2.84e-06, 2.69e-06, 2.54e-06, 2.40e-06, 2.26e-06,
+                2.12e-06, 1.99e-06, 1.87e-06, 1.75e-06, 1.64e-06, 1.53e-06, 1.42e-06, 1.33e-06,
+                1.23e-06, 1.15e-06, 1.06e-06, 9.83e-07, 9.11e-07, 8.44e-07, 7.82e-07, 7.25e-07,
+                6.73e-07, 6.25e-07, 5.81e-07, 5.42e-07, 5.07e-07, 4.76e-07, 4.49e-07, 4.25e-07,
+                4.05e-07, 3.87e-07, 3.73e-07, 3.61e-07, 3.53e-07, 3.46e-07, 3.41e-07, 3.39e-07,
+                3.41e-07, 3.44e-07, 3.48e-07, 3.52e-07, 3.58e-07, 3.63e-07, 3.69e-07, 3.75e-07,
+                3.81e-07, 3.86e-07, 3.91e-07, 3.96e-07, 4.00e-07, 4.03e-07, 4.05e-07, 4.07e-07,
+                4.07e-07, 4.07e-07, 4.07e-07, 4.07e-07, 4.05e-07, 4.03e-07, 3.99e-07, 3.95e-07,
+                3.89e-07, 3.82e-07, 3.74e-07, 3.66e-07, 3.56e-07, 3.45e-07, 3.33e-07, 3.21e-07,
+                3.08e-07, 2.94e-07, 2.80e-07, 2.65e-07, 2.50e-07, 2.34e-07, 2.19e-07, 2.03e-07,
+                1.87e-07, 1.71e-07, 1.56e-07, 1.40e-07, 1.25e-07, 1.11e-07, 9.64e-08, 8.29e-08,
+                7.01e-08, 5.80e-08, 4.66e-08, 3.61e-08, 2.64e-08, 1.76e-08, 9.73e-09, 8.12e-09,
+                1.22e-08, 1.52e-08, 1.73e-08, 1.84e-08, 1.86e-08, 1.86e-08, 1.86e-08, 1.80e-08,
+                1.65e-08, 1.43e-08, 1.13e-08, 7.55e-09, 7.11e-09, 1.30e-08, 1.92e-08, 2.57e-08,
+                3.25e-08, 3.94e-08, 4.65e-08, 5.36e-08, 6.06e-08, 6.77e-08, 7.45e-08, 8.12e-08,
+                8.77e-08, 9.38e-08, 9.97e-08, 1.06e-07, 1.11e-07, 1.15e-07, 1.20e-07, 1.23e-07,
+                1.27e-07, 1.29e-07, 1.32e-07, 1.33e-07, 1.35e-07, 1.36e-07, 1.36e-07, 1.36e-07,
+                1.36e-07, 1.36e-07, 1.35e-07, 1.35e-07, 1.33e-07, 1.32e-07, 1.30e-07, 1.28e-07,
+                1.25e-07, 1.22e-07, 1.19e-07, 1.16e-07, 1.13e-07, 1.10e-07, 1.07e-07, 1.04e-07,
+                9.97e-08, 9.65e-08, 9.33e-08, 9.01e-08, 8.71e-08, 8.42e-08, 8.14e-08, 7.88e-08,
+                7.64e-08, 7.41e-08, 7.21e-08, 7.02e-08, 6.85e-08, 6.70e-08, 6.57e-08, 6.46e-08,
+                6.37e-08, 6.29e-08, 6.24e-08, 6.20e-08, 6.18e-08, 6.21e-08, 6.24e-08, 6.29e-08,
+                6.35e-08, 6.41e-08, 6.49e-08, 6.58e-08, 6.67e-08, 6.77e-08, 6.87e-08, 6.98e-08,
+                7.09e-08, 7.21e-08, 7.33e-08, 7.46e-08, 7.59e-08, 7.72e-08, 7.85e-08, 7.99e-08,
+                8.13e-08, 8.27e-08, 8.42e-08, 8.57e-08, 8.72e-08, 8.88e-08, 9.04e-08, 9.21e-08,
+                9.38e-08, 9.56e-08, 9.75e-08, 9.94e-08, 1.02e-07, 1.04e-07, 1.06e-07, 1.08e-07,
+                1.11e-07, 1.13e-07, 1.16e-07, 1.18e-07, 1.21e-07, 1.24e-07, 1.27e-07, 1.30e-07,
+                1.33e-07, 1.36e-07, 1.39e-07, 1.42e-07, 1.45e-07, 1.49e-07, 2.48e-07, 2.48e-07,
+            },
+            {   // BC_H23
+                6.36e-03, 6.36e-03, 3.65e-03, 2.91e-03, 2.34e-03, 1.90e-03, 1.56e-03, 1.28e-03,
+                1.07e-03, 8.87e-04, 7.46e-04, 6.31e-04, 5.36e-04, 4.59e-04, 3.94e-04, 3.40e-04,
+                2.95e-04, 2.57e-04, 2.25e-04, 1.97e-04, 1.74e-04, 1.54e-04, 1.37e-04, 1.22e-04,
+                1.08e-04, 9.67e-05, 8.67e-05, 7.80e-05, 7.03e-05, 6.35e-05, 5.75e-05, 5.22e-05,
+                4.74e-05, 4.32e-05, 3.94e-05, 3.60e-05, 3.29e-05, 3.01e-05, 2.77e-05, 2.54e-05,
+                2.34e-05, 2.15e-05, 1.98e-05, 1.83e-05, 1.69e-05, 1.57e-05, 1.45e-05, 1.34e-05,
+                1.25e-05, 1.16e-05, 1.08e-05, 1.01e-05, 9.34e-06, 8.73e-06, 8.17e-06, 7.66e-06,
+                7.19e-06, 6.76e-06, 6.38e-06, 6.03e-06, 5.71e-06, 5.43e-06, 5.17e-06, 4.94e-06,
+                4.74e-06, 4.56e-06, 4.40e-06, 4.26e-06, 4.14e-06, 4.04e-06, 3.95e-06, 3.88e-06,
+                3.83e-06, 3.79e-06, 3.76e-06, 3.75e-06, 3.76e-06, 3.78e-06, 3.81e-06, 3.85e-06,
+                3.90e-06, 3.94e-06, 4.00e-06, 4.06e-06, 4.12e-06, 4.18e-06, 4.25e-06, 4.32e-06,
+                4.38e-06, 4.45e-06, 4.52e-06, 4.59e-06, 4.65e-06, 4.72e-06, 4.78e-06, 4.84e-06,
+                4.89e-06, 4.94e-06, 4.99e-06, 5.03e-06, 5.07e-06, 5.10e-06, 5.12e-06, 5.14e-06,
+                5.15e-06, 5.16e-06, 5.16e-06, 5.16e-06, 5.15e-06, 5.14e-06, 5.13e-06, 5.10e-06,
+                5.07e-06, 5.04e-06, 4.99e-06, 4.94e-06, 4.88e-06, 4.81e-06, 4.74e-06, 4.66e-06,
+                4.58e-06, 4.49e-06, 4.39e-06, 4.29e-06, 4.18e-06, 4.08e-06, 3.96e-06, 3.85e-06,
+                3.73e-06, 3.61e-06, 3.48e-06, 3.36e-06, 3.24e-06, 3.11e-06, 2.99e-06, 2.87e-06,
+                2.75e-06, 2.63e-06, 2.51e-06, 2.40e-06, 2.29e-06, 2.18e-06, 2.07e-06, 1.97e-06,
+                1.88e-06, 1.78e-06, 1.70e-06, 1.61e-06, 1.53e-06, 1.45e-06, 1.38e-06, 1.31e-06,
+                1.24e-06, 1.18e-06, 1.12e-06, 1.06e-06, 9.93e-07, 9.34e-07, 8.76e-07, 8.17e-07,
+                7.57e-07, 6.96e-07, 6.32e-07, 5.65e-07, 4.95e-07, 4.20e-07, 3.42e-07, 2.58e-07,
+                1.69e-07, 1.33e-07, 2.45e-07, 3.62e-07, 4.86e-07, 6.15e-07, 7.48e-07, 8.86e-07,
+                1.03e-06, 1.18e-06, 1.32e-06, 1.47e-06, 1.61e-06, 1.76e-06, 1.90e-06, 2.04e-06,
+                2.16e-06, 2.29e-06, 2.40e-06, 2.50e-06, 2.59e-06, 2.66e-06, 2.71e-06, 2.75e-06,
+                2.77e-06, 2.77e-06, 2.77e-06, 2.77e-06, 2.74e-06, 2.69e-06, 2.62e-06, 2.52e-06,
+                2.40e-06, 2.25e-06, 2.07e-06, 1.87e-06, 1.65e-06, 1.40e-06, 1.13e-06, 8.32e-07,
+                5.22e-07, 4.93e-07, 8.49e-07, 1.21e-06, 1.57e-06, 1.92e-06, 2.27e-06, 2.60e-06,
+                2.91e-06, 3.19e-06, 3.45e-06, 3.67e-06, 3.86e-06, 4.00e-06, 4.09e-06, 4.13e-06,
+                4.13e-06, 4.13e-06, 4.11e-06, 4.04e-06, 3.90e-06, 3.69e-06, 3.42e-06, 3.08e-06,
+                2.66e-06, 2.17e-06, 1.61e-06, 9.72e-07, 1.35e-06, 2.24e-06, 3.20e-06, 4.21e-06,
+                5.27e-06, 6.38e-06, 7.51e-06, 8.68e-06, 9.87e-06, 1.11e-05, 1.23e-05, 1.36e-05,
+                1.48e-05, 1.60e-05, 1.71e-05, 1.83e-05, 1.94e-05, 2.05e-05, 3.45e-05, 3.45e-05,
+            },
+            {   // BC_SMIN
+                1.32e-13, 1.32e-13, 8.82e-14, 9.41e-14, 9.74e-14, 1.02e-13, 1.08e-13, 1.13e-13,
+                1.20e-13, 1.24e-13, 1.30e-13, 1.38e-13, 1.42e-13, 1.50e-13, 1.56e-13, 1.65e-13,
+                1.71e-13, 1.80e-13, 1.88e-13, 1.99e-13, 2.09e-13, 2.19e-13, 2.27e-13, 2.38e-13,
+                2.52e-13, 2.63e-13, 2.74e-13, 2.87e-13, 3.00e-13, 3.16e-13, 3.31e-13, 3.46e-13,
+                3.65e-13, 3.80e-13, 4.00e-13, 4.17e-13, 4.37e-13, 4.59e-13, 4.81e-13, 5.03e-13,
+                5.28e-13, 5.54e-13, 5.79e-13, 6.08e-13, 6.36e-13, 6.67e-13, 6.99e-13, 7.32e-13,
+                7.67e-13, 8.05e-13, 8.44e-13, 8.84e-13, 9.24e-13, 9.70e-13, 1.02e-12, 1.07e-12,
+                1.12e-12, 1.17e-12, 1.23e-12, 1.29e-12, 1.35e-12, 1.41e-12, 1.48e-12, 1.55e-12,
+                1.62e-12, 1.70e-12, 1.78e-12, 1.87e-12, 1.96e-12, 2.05e-12, 2.14e-12, 2.25e-12,
+                2.35e-12, 2.47e-12, 2.58e-12, 2.71e-12, 2.84e-12, 2.97e-12, 3.11e-12, 3.26e-12,
+                3.41e-12, 3.57e-12, 3.74e-12, 3.92e-12, 4.10e-12, 4.30e-12, 4.50e-12, 4.71e-12,
+                4.93e-12, 5.17e-12, 5.41e-12, 5.66e-12, 5.93e-12, 6.21e-12, 6.49e-12, 6.80e-12,
+                7.12e-12, 7.45e-12, 7.79e-12, 8.15e-12, 8.53e-12, 8.93e-12, 9.34e-12, 9.77e-12,
+                1.03e-11, 1.07e-11, 1.12e-11, 1.17e-11, 1.23e-11, 1.28e-11, 1.34e-11, 1.40e-11,
+                1.46e-11, 1.53e-11, 1.60e-11, 1.67e-11, 1.74e-11, 1.82e-11, 1.90e-11, 1.98e-11,
+                2.07e-11, 2.16e-11, 2.25e-11, 2.35e-11, 2.45e-11, 2.56e-11, 2.66e-11, 2.77e-11,
+                2.89e-11, 3.01e-11, 3.13e-11, 3.26e-11, 3.39e-11, 3.52e-11, 3.66e-11, 3.80e-11,
+                3.94e-11, 4.09e-11, 4.24e-11, 4.39e-11, 4.55e-11, 4.71e-11, 4.87e-11, 5.03e-11,
+                5.19e-11, 5.35e-11, 5.51e-11, 5.67e-11, 5.83e-11, 5.98e-11, 6.13e-11, 6.27e-11,
+                6.40e-11, 6.53e-11, 6.64e-11, 6.73e-11, 6.81e-11, 6.87e-11, 6.91e-11, 6.92e-11,
+                6.92e-11, 6.92e-11, 6.90e-11, 6.85e-11, 6.75e-11, 6.61e-11, 6.42e-11, 6.17e-11,
+                5.85e-11, 5.46e-11, 4.98e-11, 4.42e-11, 3.74e-11, 2.95e-11, 2.03e-11, 1.68e-11,
+                3.29e-11, 5.12e-11, 7.20e-11, 9.55e-11, 1.23e-10, 1.52e-10, 1.86e-10, 2.24e-10,
+                2.66e-10, 3.13e-10, 3.66e-10, 4.24e-10, 4.90e-10, 5.62e-10, 6.43e-10, 7.32e-10,
+                8.31e-10, 9.41e-10, 1.07e-09, 1.20e-09, 1.35e-09, 1.51e-09, 1.69e-09, 1.89e-09,
+                2.11e-09, 2.34e-09, 2.61e-09, 2.90e-09, 3.21e-09, 3.56e-09, 3.94e-09, 4.35e-09,
+                4.81e-09, 5.30e-09, 5.84e-09, 6.43e-09, 7.07e-09, 7.77e-09, 8.53e-09, 9.36e-09,
+                1.03e-08, 1.13e-08, 1.23e-08, 1.35e-08, 1.47e-08, 1.60e-08, 1.75e-08, 1.90e-08,
+                2.07e-08, 2.25e-08, 2.44e-08, 2.64e-08, 2.86e-08, 3.10e-08, 3.35e-08, 3.61e-08,
+                3.90e-08, 4.20e-08, 4.51e-08, 4.85e-08, 5.20e-08, 5.57e-08, 5.96e-08, 6.37e-08,
+                6.79e-08, 7.24e-08, 7.70e-08, 8.18e-08, 8.68e-08, 9.21e-08, 9.76e-08, 1.04e-07,
+                1.10e-07, 1.16e-07, 1.23e-07, 1.31e-07, 1.39e-07, 1.49e-07, 2.51e-07, 2.51e-07,
+            },
+            {   // BC_SMAX
+                6.74e-12, 6.74e-12, 4.58e-12, 4.78e-12, 4.98e-12, 5.23e-12, 5.52e-12, 5.69e-12,
+                5.97e-12, 6.29e-12, 6.57e-12, 6.88e-12, 7.19e-12, 7.51e-12, 7.85e-12, 8.27e-12,
+                8.62e-12, 9.04e-12, 9.50e-12, 9.95e-12, 1.04e-11, 1.10e-11, 1.15e-11, 1.20e-11,
+                1.26e-11, 1.32e-11, 1.38e-11, 1.44e-11, 1.51e-11, 1.58e-11, 1.66e-11, 1.73e-11,
+                1.82e-11, 1.90e-11, 1.99e-11, 2.09e-11, 2.19e-11, 2.29e-11, 2.40e-11, 2.52e-11,
+                2.63e-11, 2.76e-11, 2.89e-11, 3.03e-11, 3.18e-11, 3.32e-11, 3.49e-11, 3.65e-11,
+                3.82e-11, 4.01e-11, 4.20e-11, 4.40e-11, 4.61e-11, 4.83e-11, 5.06e-11, 5.31e-11,
+                5.56e-11, 5.82e-11, 6.10e-11, 6.39e-11, 6.70e-11, 7.02e-11, 7.35e-11, 7.71e-11,
+                8.08e-11, 8.46e-11, 8.87e-11, 9.30e-11, 9.74e-11, 1.03e-10, 1.07e-10, 1.13e-10,
+                1.18e-10, 1.24e-10, 1.30e-10, 1.36e-10, 1.42e-10, 1.49e-10, 1.56e-10, 1.63e-10,
+                1.71e-10, 1.80e-10, 1.88e-10, 1.97e-10, 2.07e-10, 2.17e-10, 2.27e-10, 2.38e-10,
+                2.49e-10, 2.61e-10, 2.74e-10, 2.87e-10, 3.01e-10, 3.15e-10, 3.30e-10, 3.46e-10,
+                3.63e-10, 3.80e-10, 3.98e-10, 4.17e-10, 4.37e-10, 4.58e-10, 4.80e-10, 5.04e-10,
+                5.28e-10, 5.53e-10, 5.80e-10, 6.08e-10, 6.37e-10, 6.68e-10, 7.00e-10, 7.34e-10,
+                7.69e-10, 8.06e-10, 8.45e-10, 8.86e-10, 9.28e-10, 9.73e-10, 1.02e-09, 1.07e-09,
+                1.13e-09, 1.18e-09, 1.24e-09, 1.30e-09, 1.36e-09, 1.42e-09, 1.49e-09, 1.56e-09,
+                1.64e-09, 1.72e-09, 1.80e-09, 1.89e-09, 1.98e-09, 2.08e-09, 2.18e-09, 2.28e-09,
+                2.40e-09, 2.51e-09, 2.63e-09, 2.76e-09, 2.90e-09, 3.04e-09, 3.19e-09, 3.34e-09,
+                3.50e-09, 3.68e-09, 3.86e-09, 4.04e-09, 4.24e-09, 4.45e-09, 4.67e-09, 4.90e-09,
+                5.14e-09, 5.40e-09, 5.66e-09, 5.94e-09, 6.24e-09, 6.54e-09, 6.87e-09, 7.21e-09,
+                7.57e-09, 7.95e-09, 8.34e-09, 8.76e-09, 9.20e-09, 9.66e-09, 1.02e-08, 1.07e-08,
+                1.12e-08, 1.18e-08, 1.24e-08, 1.30e-08, 1.37e-08, 1.44e-08, 1.51e-08, 1.59e-08,
+                1.67e-08, 1.75e-08, 1.84e-08, 1.94e-08, 2.04e-08, 2.14e-08, 2.25e-08, 2.36e-08,
+                2.49e-08, 2.61e-08, 2.75e-08, 2.89e-08, 3.04e-08, 3.20e-08, 3.36e-08, 3.53e-08,
+                3.72e-08, 3.91e-08, 4.11e-08, 4.32e-08, 4.54e-08, 4.77e-08, 5.01e-08, 5.26e-08,
+                5.52e-08, 5.80e-08, 6.08e-08, 6.38e-08, 6.69e-08, 7.00e-08, 7.33e-08, 7.67e-08,
+                8.01e-08, 8.36e-08, 8.72e-08, 9.07e-08, 9.43e-08, 9.79e-08, 1.02e-07, 1.05e-07,
+                1.08e-07, 1.11e-07, 1.14e-07, 1.16e-07, 1.18e-07, 1.19e-07, 1.20e-07, 1.20e-07,
+                1.20e-07, 1.19e-07, 1.18e-07, 1.15e-07, 1.10e-07, 1.04e-07, 9.51e-08, 8.40e-08,
+                7.00e-08, 5.26e-08, 3.12e-08, 6.30e-08, 1.07e-07, 1.59e-07, 2.19e-07, 2.89e-07,
+                3.70e-07, 4.63e-07, 5.70e-07, 6.93e-07, 8.32e-07, 9.91e-07, 1.17e-06, 1.38e-06,
+                1.61e-06, 1.87e-06, 2.16e-06, 2.49e-06, 2.86e-06, 3.29e-06, 5.64e-06, 5.64e-06,
+            },
+            {   // BC_SLIQ
+                3.65e-09, 3.65e-09, 2.17e-09, 2.06e-09, 1.96e-09, 1.86e-09, 1.76e-09, 1.66e-09,
+                1.57e-09, 1.48e-09, 1.39e-09, 1.31e-09, 1.23e-09, 1.15e-09, 1.07e-09, 9.88e-10,
+                9.14e-10, 8.43e-10, 7.74e-10, 7.06e-10, 6.41e-10, 5.77e-10, 5.15e-10, 4.55e-10,
+                3.97e-10, 3.40e-10, 2.85e-10, 2.32e-10, 1.79e-10, 1.29e-10, 7.92e-11, 6.08e-11,
+                1.05e-10, 1.48e-10, 1.90e-10, 2.30e-10, 2.70e-10, 3.08e-10, 3.46e-10, 3.82e-10,
+                4.18e-10, 4.52e-10, 4.86e-10, 5.19e-10, 5.51e-10, 5.82e-10, 6.13e-10, 6.43e-10,
+                6.72e-10, 7.01e-10, 7.29e-10, 7.56e-10, 7.83e-10, 8.09e-10, 8.35e-10, 8.60e-10,
+                8.84e-10, 9.09e-10, 9.33e-10, 9.56e-10, 9.79e-10, 1.01e-09, 1.03e-09, 1.05e-09,
+                1.07e-09, 1.09e-09, 1.12e-09, 1.14e-09, 1.16e-09, 1.18e-09, 1.20e-09, 1.22e-09,
+                1.24e-09, 1.26e-09, 1.28e-09, 1.30e-09, 1.32e-09, 1.34e-09, 1.36e-09, 1.38e-09,
+                1.40e-09, 1.43e-09, 1.45e-09, 1.47e-09, 1.49e-09, 1.51e-09, 1.53e-09, 1.55e-09,
+                1.58e-09, 1.60e-09, 1.62e-09, 1.64e-09, 1.67e-09, 1.69e-09, 1.72e-09, 1.74e-09,
+                1.77e-09, 1.79e-09, 1.82e-09, 1.85e-09, 1.87e-09, 1.90e-09, 1.93e-09, 1.96e-09,
+                1.99e-09, 2.02e-09, 2.06e-09, 2.09e-09, 2.13e-09, 2.16e-09, 2.20e-09, 2.24e-09,
+                2.27e-09, 2.31e-09, 2.36e-09, 2.40e-09, 2.44e-09, 2.49e-09, 2.54e-09, 2.59e-09,
+                2.64e-09, 2.69e-09, 2.74e-09, 2.80e-09, 2.86e-09, 2.92e-09, 2.98e-09, 3.05e-09,
+                3.11e-09, 3.18e-09, 3.26e-09, 3.33e-09, 3.41e-09, 3.49e-09, 3.58e-09, 3.67e-09,
+                3.76e-09, 3.86e-09, 3.96e-09, 4.06e-09, 4.17e-09, 4.28e-09, 4.40e-09, 4.52e-09,
+                4.65e-09, 4.78e-09, 4.92e-09, 5.07e-09, 5.22e-09, 5.38e-09, 5.54e-09, 5.72e-09,
+                5.90e-09, 6.09e-09, 6.28e-09, 6.49e-09, 6.71e-09, 6.93e-09, 7.17e-09, 7.42e-09,
+                7.68e-09, 7.95e-09, 8.24e-09, 8.54e-09, 8.85e-09, 9.18e-09, 9.53e-09, 9.89e-09,
+                1.03e-08, 1.07e-08, 1.11e-08, 1.16e-08, 1.21e-08, 1.25e-08, 1.31e-08, 1.36e-08,
+                1.42e-08, 1.48e-08, 1.54e-08, 1.61e-08, 1.68e-08, 1.76e-08, 1.84e-08, 1.93e-08,
+                2.02e-08, 2.11e-08, 2.21e-08, 2.32e-08, 2.44e-08, 2.56e-08, 2.69e-08, 2.83e-08,
+                2.98e-08, 3.14e-08, 3.31e-08, 3.49e-08, 3.69e-08, 3.90e-08, 4.13e-08, 4.37e-08,
+                4.64e-08, 4.93e-08, 5.24e-08, 5.58e-08, 5.95e-08, 6.36e-08, 6.81e-08, 7.30e-08,
+                7.84e-08, 8.44e-08, 9.11e-08, 9.84e-08, 1.07e-07, 1.16e-07, 1.27e-07, 1.38e-07,
+                1.51e-07, 1.66e-07, 1.83e-07, 2.02e-07, 2.23e-07, 2.48e-07, 2.76e-07, 3.08e-07,
+                3.44e-07, 3.86e-07, 4.34e-07, 4.89e-07, 5.53e-07, 6.26e-07, 7.12e-07, 8.14e-07,
+                9.37e-07, 1.09e-06, 1.29e-06, 1.55e-06, 1.90e-06, 2.39e-06, 3.08e-06, 4.05e-06,
+                5.42e-06, 7.31e-06, 9.88e-06, 1.33e-05, 1.75e-05, 2.24e-05, 7.28e-05, 4.21e-04,
+                4.30e-04, 4.30e-04, 4.58e-04, 1.19e-03, 4.74e-03, 1.59e-01, 1.31e+00, std::numeric_limits<double>::infinity(),
+            },
+            {   // BC_SVAP
+                1.30e-10, 1.30e-10, 8.08e-11, 8.20e-11, 8.30e-11, 8.39e-11, 8.45e-11, 8.51e-11,
+                8.54e-11, 8.55e-11, 8.55e-11, 8.55e-11, 8.54e-11, 8.51e-11, 8.46e-11, 8.39e-11,
+                8.29e-11, 8.16e-11, 8.01e-11, 7.84e-11, 7.63e-11, 7.39e-11, 7.13e-11, 6.84e-11,
+                6.51e-11, 6.15e-11, 5.76e-11, 5.33e-11, 4.86e-11, 4.37e-11, 3.84e-11, 3.26e-11,
+                2.67e-11, 2.01e-11, 1.32e-11, 1.01e-11, 1.86e-11, 2.76e-11, 3.68e-11, 4.66e-11,
+                5.67e-11, 6.74e-11, 7.85e-11, 8.99e-11, 1.02e-10, 1.15e-10, 1.27e-10, 1.41e-10,
+                1.54e-10, 1.68e-10, 1.83e-10, 1.98e-10, 2.14e-10, 2.29e-10, 2.46e-10, 2.63e-10,
+                2.80e-10, 2.98e-10, 3.16e-10, 3.35e-10, 3.54e-10, 3.74e-10, 3.94e-10, 4.15e-10,
+                4.36e-10, 4.58e-10, 4.81e-10, 5.04e-10, 5.28e-10, 5.52e-10, 5.77e-10, 6.02e-10,
+                6.29e-10, 6.56e-10, 6.84e-10, 7.13e-10, 7.42e-10, 7.73e-10, 8.04e-10, 8.37e-10,
+                8.70e-10, 9.05e-10, 9.41e-10, 9.78e-10, 1.02e-09, 1.06e-09, 1.10e-09, 1.14e-09,
+                1.19e-09, 1.23e-09, 1.28e-09, 1.33e-09, 1.38e-09, 1.44e-09, 1.49e-09, 1.55e-09,
+                1.61e-09, 1.67e-09, 1.73e-09, 1.80e-09, 1.86e-09, 1.93e-09, 2.01e-09, 2.08e-09,
+                2.16e-09, 2.24e-09, 2.32e-09, 2.40e-09, 2.49e-09, 2.58e-09, 2.67e-09, 2.76e-09,
+                2.86e-09, 2.95e-09, 3.05e-09, 3.15e-09, 3.25e-09, 3.35e-09, 3.45e-09, 3.55e-09,
+                3.65e-09, 3.75e-09, 3.85e-09, 3.96e-09, 4.06e-09, 4.16e-09, 4.25e-09, 4.35e-09,
+                4.45e-09, 4.54e-09, 4.63e-09, 4.73e-09, 4.82e-09, 4.90e-09, 4.99e-09, 5.08e-09,
+                5.16e-09, 5.25e-09, 5.34e-09, 5.42e-09, 5.52e-09, 5.61e-09, 5.71e-09, 5.81e-09,
+                5.92e-09, 6.04e-09, 6.17e-09, 6.31e-09, 6.47e-09, 6.64e-09, 6.83e-09, 7.04e-09,
+                7.28e-09, 7.54e-09, 7.82e-09, 8.14e-09, 8.49e-09, 8.88e-09, 9.30e-09, 9.76e-09,
+                1.03e-08, 1.08e-08, 1.14e-08, 1.21e-08, 1.27e-08, 1.35e-08, 1.42e-08, 1.51e-08,
+                1.59e-08, 1.69e-08, 1.78e-08, 1.88e-08, 1.99e-08, 2.10e-08, 2.22e-08, 2.34e-08,
+                2.46e-08, 2.59e-08, 2.73e-08, 2.87e-08, 3.02e-08, 3.17e-08, 3.33e-08, 3.49e-08,
+                3.67e-08, 3.85e-08, 4.04e-08, 4.24e-08, 4.45e-08, 4.67e-08, 4.91e-08, 5.16e-08,
+                5.43e-08, 5.72e-08, 6.02e-08, 6.35e-08, 6.70e-08, 7.08e-08, 7.49e-08, 7.93e-08,
+                8.40e-08, 8.91e-08, 9.47e-08, 1.01e-07, 1.08e-07, 1.15e-07, 1.23e-07, 1.32e-07,
+                1.42e-07, 1.53e-07, 1.65e-07, 1.79e-07, 1.95e-07, 2.13e-07, 2.34e-07, 2.57e-07,
+                2.84e-07, 3.14e-07, 3.48e-07, 3.86e-07, 4.29e-07, 4.78e-07, 5.33e-07, 5.94e-07,
+                6.63e-07, 7.40e-07, 8.28e-07, 9.29e-07, 1.05e-06, 1.19e-06, 1.37e-06, 1.58e-06,
+                1.86e-06, 2.22e-06, 2.69e-06, 3.30e-06, 4.09e-06, 5.10e-06, 6.39e-06, 8.00e-06,
+                9.98e-06, 1.24e-05, 1.52e-05, 1.85e-05, 2.23e-05, 2.66e-05, 3.07e-05, 1.06e-03,
+                1.07e-03, 1.08e-03, 7.71e-04, 1.83e-03, 6.84e-03, 1.93e-01, 1.47e+00, std::numeric_limits<double>::infinity(),
+            },
+            {   // BC_S13
+                2.33e-08, 2.33e-08, 1.39e-08, 1.37e-08, 1.35e-08, 1.32e-08, 1.30e-08, 1.27e-08,
+                1.25e-08, 1.22e-08, 1.19e-08, 1.16e-08, 1.13e-08, 1.10e-08, 1.07e-08, 1.04e-08,
+                1.01e-08, 9.79e-09, 9.48e-09, 9.17e-09, 8.86e-09, 8.56e-09, 8.25e-09, 7.94e-09,
+                7.64e-09, 7.34e-09, 7.04e-09, 6.74e-09, 6.45e-09, 6.16e-09, 5.88e-09, 5.60e-09,
+                5.33e-09, 5.06e-09, 4.80e-09, 4.55e-09, 4.30e-09, 4.06e-09, 3.83e-09, 3.60e-09,
+                3.39e-09, 3.18e-09, 2.98e-09, 2.78e-09, 2.60e-09, 2.43e-09, 2.26e-09, 2.10e-09,
+                1.95e-09, 1.81e-09, 1.68e-09, 1.55e-09, 1.44e-09, 1.33e-09, 1.23e-09, 1.14e-09,
+                1.05e-09, 9.71e-10, 9.01e-10, 8.37e-10, 7.81e-10, 7.31e-10, 6.86e-10, 6.48e-10,
+                6.15e-10, 5.87e-10, 5.64e-10, 5.46e-10, 5.31e-10, 5.20e-10, 5.13e-10, 5.09e-10,
+                5.11e-10, 5.16e-10, 5.23e-10, 5.30e-10, 5.38e-10, 5.47e-10, 5.56e-10, 5.65e-10,
+                5.74e-10, 5.83e-10, 5.90e-10, 5.97e-10, 6.03e-10, 6.08e-10, 6.12e-10, 6.14e-10,
+                6.14e-10, 6.14e-10, 6.14e-10, 6.13e-10, 6.11e-10, 6.06e-10, 6.00e-10, 5.92e-10,
+                5.82e-10, 5.71e-10, 5.58e-10, 5.43e-10, 5.27e-10, 5.09e-10, 4.90e-10, 4.69e-10,
+                4.48e-10, 4.25e-10, 4.01e-10, 3.77e-10, 3.52e-10, 3.27e-10, 3.01e-10, 2.75e-10,
+                2.49e-10, 2.23e-10, 1.98e-10, 1.73e-10, 1.48e-10, 1.24e-10, 1.01e-10, 7.86e-11,
+                5.76e-11, 3.77e-11, 1.90e-11, 2.88e-11, 4.17e-11, 5.31e-11, 6.30e-11, 7.12e-11,
+                7.79e-11, 8.30e-11, 8.66e-11, 8.86e-11, 8.93e-11, 8.93e-11, 8.93e-11, 8.84e-11,
+                8.63e-11, 8.29e-11, 7.83e-11, 7.25e-11, 6.58e-11, 5.82e-11, 4.97e-11, 4.05e-11,
+                3.08e-11, 2.04e-11, 1.25e-11, 2.36e-11, 3.47e-11, 4.58e-11, 5.65e-11, 6.70e-11,
+                7.71e-11, 8.67e-11, 9.57e-11, 1.05e-10, 1.12e-10, 1.20e-10, 1.26e-10, 1.32e-10,
+                1.36e-10, 1.40e-10, 1.44e-10, 1.46e-10, 1.48e-10, 1.49e-10, 1.49e-10, 1.49e-10,
+                1.49e-10, 1.48e-10, 1.47e-10, 1.45e-10, 1.42e-10, 1.39e-10, 1.36e-10, 1.32e-10,
+                1.27e-10, 1.22e-10, 1.17e-10, 1.12e-10, 1.06e-10, 9.99e-11, 9.41e-11, 8.82e-11,
+                8.23e-11, 7.65e-11, 7.09e-11, 6.53e-11, 5.99e-11, 5.47e-11, 4.97e-11, 4.50e-11,
+                4.05e-11, 3.64e-11, 3.25e-11, 2.89e-11, 2.57e-11, 2.28e-11, 2.02e-11, 1.79e-11,
+                1.59e-11, 1.42e-11, 1.28e-11, 1.17e-11, 1.09e-11, 1.03e-11, 9.88e-12, 1.01e-11,
+                1.05e-11, 1.11e-11, 1.18e-11, 1.27e-11, 1.37e-11, 1.48e-11, 1.60e-11, 1.72e-11,
+                1.85e-11, 1.99e-11, 2.14e-11, 2.29e-11, 2.45e-11, 2.61e-11, 2.77e-11, 2.95e-11,
+                3.12e-11, 3.30e-11, 3.49e-11, 3.68e-11, 3.88e-11, 4.09e-11, 4.30e-11, 4.53e-11,
+                4.76e-11, 5.01e-11, 5.27e-11, 5.54e-11, 5.82e-11, 6.11e-11, 6.42e-11, 6.75e-11,
+                7.08e-11, 7.44e-11, 7.82e-11, 8.21e-11, 8.61e-11, 9.03e-11, 9.47e-11, 9.93e-11,
+                1.04e-10, 1.09e-10, 1.14e-10, 1.19e-10, 1.24e-10, 1.29e-10, 2.16e-10, 2.16e-10,
+            },
+            {   // BC_S23
+                1.06e-05, 1.06e-05, 6.07e-06, 4.84e-06, 3.90e-06, 3.16e-06, 2.59e-06, 2.13e-06,
+                1.77e-06, 1.48e-06, 1.25e-06, 1.05e-06, 8.93e-07, 7.64e-07, 6.56e-07, 5.67e-07,
+                4.92e-07, 4.29e-07, 3.75e-07, 3.29e-07, 2.90e-07, 2.57e-07, 2.28e-07, 2.03e-07,
+                1.82e-07, 1.63e-07, 1.46e-07, 1.32e-07, 1.19e-07, 1.08e-07, 9.71e-08, 8.83e-08,
+                8.04e-08, 7.33e-08, 6.70e-08, 6.13e-08, 5.63e-08, 5.17e-08, 4.75e-08, 4.38e-08,
+                4.04e-08, 3.73e-08, 3.46e-08, 3.20e-08, 2.97e-08, 2.76e-08, 2.57e-08, 2.39e-08,
+                2.23e-08, 2.09e-08, 1.95e-08, 1.83e-08, 1.72e-08, 1.61e-08, 1.52e-08, 1.44e-08,
+                1.36e-08, 1.29e-08, 1.22e-08, 1.16e-08, 1.11e-08, 1.06e-08, 1.01e-08, 9.69e-09,
+                9.33e-09, 9.01e-09, 8.72e-09, 8.47e-09, 8.24e-09, 8.04e-09, 7.87e-09, 7.73e-09,
+                7.60e-09, 7.50e-09, 7.41e-09, 7.35e-09, 7.30e-09, 7.26e-09, 7.24e-09, 7.24e-09,
+                7.26e-09, 7.29e-09, 7.33e-09, 7.37e-09, 7.41e-09, 7.46e-09, 7.51e-09, 7.57e-09,
+                7.62e-09, 7.67e-09, 7.73e-09, 7.78e-09, 7.83e-09, 7.87e-09, 7.91e-09, 7.95e-09,
+                7.98e-09, 8.01e-09, 8.02e-09, 8.04e-09, 8.04e-09, 8.04e-09, 8.04e-09, 8.04e-09,
+                8.02e-09, 8.00e-09, 7.97e-09, 7.93e-09, 7.88e-09, 7.83e-09, 7.76e-09, 7.68e-09,
+                7.59e-09, 7.50e-09, 7.39e-09, 7.28e-09, 7.15e-09, 7.02e-09, 6.88e-09, 6.73e-09,
+                6.57e-09, 6.41e-09, 6.24e-09, 6.07e-09, 5.89e-09, 5.70e-09, 5.52e-09, 5.33e-09,
+                5.13e-09, 4.94e-09, 4.75e-09, 4.55e-09, 4.36e-09, 4.16e-09, 3.97e-09, 3.78e-09,
+                3.60e-09, 3.42e-09, 3.24e-09, 3.07e-09, 2.90e-09, 2.74e-09, 2.58e-09, 2.43e-09,
+                2.29e-09, 2.15e-09, 2.02e-09, 1.90e-09, 1.78e-09, 1.67e-09, 1.56e-09, 1.46e-09,
+                1.36e-09, 1.27e-09, 1.18e-09, 1.10e-09, 1.01e-09, 9.27e-10, 8.45e-10, 7.64e-10,
+                6.81e-10, 5.98e-10, 5.11e-10, 4.22e-10, 3.29e-10, 2.31e-10, 1.29e-10, 2.16e-10,
+                3.43e-10, 4.77e-10, 6.18e-10, 7.65e-10, 9.18e-10, 1.08e-09, 1.25e-09, 1.41e-09,
+                1.59e-09, 1.76e-09, 1.93e-09, 2.11e-09, 2.28e-09, 2.45e-09, 2.62e-09, 2.77e-09,
+                2.92e-09, 3.06e-09, 3.18e-09, 3.29e-09, 3.38e-09, 3.45e-09, 3.50e-09, 3.53e-09,
+                3.53e-09, 3.53e-09, 3.53e-09, 3.51e-09, 3.46e-09, 3.38e-09, 3.27e-09, 3.13e-09,
+                2.96e-09, 2.76e-09, 2.53e-09, 2.27e-09, 1.98e-09, 1.66e-09, 1.32e-09, 9.51e-10,
+                5.68e-10, 6.71e-10, 1.10e-09, 1.53e-09, 1.96e-09, 2.37e-09, 2.77e-09, 3.16e-09,
+                3.51e-09, 3.83e-09, 4.12e-09, 4.36e-09, 4.56e-09, 4.70e-09, 4.79e-09, 4.81e-09,
+                4.81e-09, 4.81e-09, 4.76e-09, 4.64e-09, 4.45e-09, 4.18e-09, 3.83e-09, 3.40e-09,
+                2.89e-09, 2.30e-09, 1.62e-09, 8.69e-10, 1.85e-09, 2.88e-09, 3.98e-09, 5.13e-09,
+                6.33e-09, 7.57e-09, 8.84e-09, 1.02e-08, 1.15e-08, 1.28e-08, 1.41e-08, 1.54e-08,
+                1.67e-08, 1.80e-08, 1.92e-08, 2.04e-08, 2.15e-08, 2.26e-08, 3.80e-08, 3.80e-08,
+            },
+            {   // BC_HS_PMAX
+                3.50e-05, 3.50e-05, 2.08e-05, 1.96e-05, 1.84e-05, 1.74e-05, 1.63e-05, 1.54e-05,
+                1.44e-05, 1.35e-05, 1.27e-05, 1.19e-05, 1.11e-05, 1.04e-05, 9.66e-06, 9.01e-06,
+                8.38e-06, 7.79e-06, 7.23e-06, 6.69e-06, 6.19e-06, 5.71e-06, 5.25e-06, 4.82e-06,
+                4.41e-06, 4.03e-06, 3.66e-06, 3.32e-06, 2.99e-06, 2.68e-06, 2.39e-06, 2.12e-06,
+                1.86e-06, 1.62e-06, 1.39e-06, 1.17e-06, 9.69e-07, 7.82e-07, 6.06e-07, 4.43e-07,
+                2.91e-07, 1.51e-07, 2.10e-07, 3.11e-07, 4.02e-07, 4.84e-07, 5.58e-07, 6.23e-07,
+                6.81e-07, 7.30e-07, 7.72e-07, 8.06e-07, 8.33e-07, 8.54e-07, 8.67e-07, 8.74e-07,
+                8.74e-07, 8.74e-07, 8.74e-07, 8.68e-07, 8.56e-07, 8.38e-07, 8.14e-07, 7.84e-07,
+                7.49e-07, 7.09e-07, 6.63e-07, 6.12e-07, 5.56e-07, 4.96e-07, 4.31e-07, 3.62e-07,
+                2.88e-07, 2.11e-07, 1.30e-07, 1.34e-07, 2.27e-07, 3.22e-07, 4.19e-07, 5.16e-07,
+                6.15e-07, 7.13e-07, 8.11e-07, 9.08e-07, 1.01e-06, 1.10e-06, 1.19e-06, 1.27e-06,
+                1.34e-06, 1.41e-06, 1.47e-06, 1.52e-06, 1.55e-06, 1.58e-06, 1.58e-06, 1.58e-06,
+                1.58e-06, 1.57e-06, 1.53e-06, 1.48e-06, 1.39e-06, 1.28e-06, 1.14e-06, 9.54e-07,
+                7.37e-07, 4.78e-07, 5.77e-07, 1.04e-06, 1.54e-06, 2.11e-06, 2.73e-06, 3.42e-06,
+                4.15e-06, 4.94e-06, 5.78e-06, 6.65e-06, 7.55e-06, 8.46e-06, 9.37e-06, 1.03e-05,
+                1.11e-05, 1.18e-05, 1.23e-05, 1.26e-05, 1.26e-05, 1.26e-05, 1.25e-05, 1.21e-05,
+                1.11e-05, 9.47e-06, 7.03e-06, 7.46e-06, 1.56e-05, 2.60e-05, 3.91e-05, 5.53e-05,
+                7.54e-05, 9.99e-05, 1.30e-04, 1.66e-04, 2.09e-04, 2.61e-04, 8.24e-02, 1.27e+00,
+                1.27e+00, 1.27e+00, 1.10e-01, 6.95e-03, 8.48e-03, 8.17e-03, 7.88e-03, 7.68e-03,
+                7.71e-03, 6.55e-03, 1.01e-02, 1.23e-02, 1.27e-02, 1.27e-02, 1.27e-02, 1.27e-02,
+                1.13e-02, 8.17e-03, 1.15e-02, 1.51e-02, 1.72e-02, 1.73e-02, 1.74e-02, 1.74e-02,
+                1.74e-02, 1.56e-02, 1.19e-02, 1.23e-02, 1.74e-02, 2.09e-02, 2.26e-02, 2.26e-02,
+                2.26e-02, 2.26e-02, 2.23e-02, 2.06e-02, 1.82e-02, 1.78e-02, 2.39e-02, 3.08e-02,
+                3.69e-02, 2.01e-01, 2.14e-01, 2.27e-01, 7.33e-02, 4.89e-02, 4.89e-02, 4.72e-02,
+                3.75e-02, 2.39e-02, 2.80e-02, 3.65e-02, 4.31e-02, 4.78e-02, 5.07e-02, 5.19e-02,
+                5.19e-02, 5.19e-02, 5.19e-02, 5.12e-02, 4.86e-02, 4.41e-02, 3.78e-02, 3.01e-02,
+                2.15e-02, 1.28e-02, 5.31e-03, 4.55e-03, 9.23e-03, 1.16e-02, 1.41e-01, 3.62e-01,
+                3.62e-01, 3.62e-01, 3.00e-02, 1.17e-02, 6.64e-03, 2.75e-03, 1.77e-03, 1.77e-03,
+                1.77e-03, 1.72e-03, 1.34e-03, 8.14e-04, 4.81e-04, 6.79e-04, 7.55e-04, 7.55e-04,
+                7.55e-04, 7.25e-04, 6.11e-04, 4.37e-04, 2.38e-04, 4.57e-04, 6.52e-04, 8.18e-04,
+                9.50e-04, 1.05e-03, 1.12e-03, 1.15e-03, 1.16e-03, 2.70e-02, 2.47e-01, 2.47e-01,
+                2.47e-01, 3.55e-02, 2.23e-04, 1.45e-04, 7.72e-05, 2.71e-05, 4.62e-05, 4.62e-05,
+            },
+            {   // BC_HS_PMIN
+                2.41e+04, 2.41e+04, 2.51e+03, 1.09e-04, 8.27e-05, 6.30e-05, 4.78e-05, 3.60e-05,
+                2.70e-05, 2.01e-05, 1.48e-05, 1.08e-05, 7.67e-06, 5.36e-06, 3.62e-06, 2.32e-06,
+                1.36e-06, 6.44e-07, 4.84e-07, 6.52e-07, 7.59e-07, 8.20e-07, 8.48e-07, 8.51e-07,
+                8.51e-07, 8.51e-07, 8.37e-07, 8.12e-07, 7.79e-07, 7.41e-07, 7.00e-07, 6.59e-07,
+                6.17e-07, 5.77e-07, 5.38e-07, 5.01e-07, 4.66e-07, 4.33e-07, 4.02e-07, 3.73e-07,
+                3.47e-07, 3.23e-07, 3.00e-07, 2.80e-07, 2.61e-07, 2.44e-07, 2.29e-07, 2.14e-07,
+                2.02e-07, 1.90e-07, 1.80e-07, 1.70e-07, 1.62e-07, 1.54e-07, 1.47e-07, 1.41e-07,
+                1.36e-07, 1.31e-07, 1.27e-07, 1.23e-07, 1.20e-07, 1.17e-07, 1.15e-07, 1.13e-07,
+                1.11e-07, 1.09e-07, 1.08e-07, 1.07e-07, 1.06e-07, 1.06e-07, 1.05e-07, 1.05e-07,
+                1.04e-07, 1.04e-07, 1.04e-07, 1.05e-07, 1.05e-07, 1.05e-07, 1.06e-07, 1.06e-07,
+                1.06e-07, 1.07e-07, 1.07e-07, 1.08e-07, 1.08e-07, 1.09e-07, 1.09e-07, 1.10e-07,
+                1.10e-07, 1.11e-07, 1.12e-07, 1.12e-07, 1.13e-07, 1.13e-07, 1.14e-07, 1.14e-07,
+                1.15e-07, 1.16e-07, 1.16e-07, 1.17e-07, 1.17e-07, 1.18e-07, 1.18e-07, 1.19e-07,
+                1.19e-07, 1.20e-07, 1.20e-07, 1.21e-07, 1.21e-07, 1.22e-07, 1.22e-07, 1.23e-07,
+                1.23e-07, 1.24e-07, 1.24e-07, 1.25e-07, 1.25e-07, 1.25e-07, 1.26e-07, 1.26e-07,
+                1.26e-07, 1.27e-07, 1.27e-07, 1.27e-07, 1.27e-07, 1.27e-07, 1.28e-07, 1.28e-07,
+                1.28e-07, 1.28e-07, 1.28e-07, 1.28e-07, 1.28e-07, 1.28e-07, 1.27e-07, 1.27e-07,
+                1.27e-07, 1.27e-07, 1.27e-07, 1.26e-07, 1.26e-07, 1.25e-07, 1.25e-07, 1.24e-07,
+                1.23e-07, 1.23e-07, 1.22e-07, 1.21e-07, 1.20e-07, 1.19e-07, 1.18e-07, 1.16e-07,
+                1.15e-07, 1.14e-07, 1.12e-07, 1.11e-07, 1.09e-07, 1.07e-07, 1.05e-07, 1.03e-07,
+                1.01e-07, 9.88e-08, 9.66e-08, 9.43e-08, 9.19e-08, 8.95e-08, 8.69e-08, 8.43e-08,
+                8.16e-08, 7.88e-08, 7.59e-08, 7.30e-08, 7.00e-08, 6.70e-08, 6.38e-08, 6.06e-08,
+                5.74e-08, 5.42e-08, 5.09e-08, 4.75e-08, 4.42e-08, 4.08e-08, 3.74e-08, 3.41e-08,
+                3.08e-08, 2.75e-08, 2.42e-08, 2.10e-08, 1.78e-08, 1.47e-08, 1.17e-08, 8.82e-09,
+                6.07e-09, 3.49e-09, 3.40e-09, 5.24e-09, 6.87e-09, 8.21e-09, 9.25e-09, 1.00e-08,
+                1.04e-08, 1.04e-08, 1.04e-08, 1.04e-08, 1.01e-08, 9.24e-09, 8.02e-09, 6.27e-09,
+                4.01e-09, 6.31e-09, 1.10e-08, 1.64e-08, 2.26e-08, 2.95e-08, 3.72e-08, 4.59e-08,
+                5.54e-08, 6.59e-08, 7.74e-08, 9.00e-08, 1.04e-07, 1.19e-07, 1.35e-07, 1.53e-07,
+                1.72e-07, 1.92e-07, 2.14e-07, 2.37e-07, 2.62e-07, 2.88e-07, 3.17e-07, 3.47e-07,
+                3.79e-07, 4.13e-07, 4.49e-07, 4.87e-07, 5.28e-07, 5.71e-07, 6.16e-07, 6.64e-07,
+                7.14e-07, 7.67e-07, 8.23e-07, 8.82e-07, 9.44e-07, 1.01e-06, 1.08e-06, 1.15e-06,
+                1.23e-06, 1.31e-06, 1.39e-06, 1.48e-06, 1.57e-06, 1.76e-02, 1.70e-01, 1.70e-01,
+            },
+        };
+    };
+    // END BoundaryTables
+    template<class Unused> constexpr double BoundaryTables<Unused>::u0[BC_COUNT];
+    template<class Unused> constexpr double BoundaryTables<Unused>::du[BC_COUNT];
+    template<class Unused> constexpr double BoundaryTables<Unused>::y[BC_COUNT][BOUNDARY_INTERVALS + 1];
+    template<class Unused> constexpr double BoundaryTables<Unused>::band[BC_COUNT][BOUNDARY_INTERVALS];
+
+    class BoundaryCurve{
+        /// One (p,X) region boundary X(p), an enthalpy or entropy along an isotherm, the B23 line or
+        /// a side of the saturation dome, tabulated at uniform steps of ln(p) and read back by 4-point
+        /// Lagrange interpolation.  With a linear axis the steps are uniform in the argument itself,
+        /// as for the (h,s) domain boundaries h(s).  Each interval carries an error band, 16 times the largest
+        /// interpolation error measured at its quarter points and those of its neighbours, plus a few
+        /// ulps.  at(x, u, X) returns the interpolated value when X lies outside the band, and otherwise
+        /// the exact value itself.  The band is a heuristic, not a proven bound on the interpolation
+        /// error: that comparing X against the interpolated value gives the same answer as against the
+        /// exact one is checked, not guaranteed, by the near-boundary sweeps in IF97.cpp.  An interval
+        /// ending at a singular point (the critical point, where the saturation curves have infinite
+        /// slope) has an infinite band and always returns the exact value.
+        ///
+        /// The nodes and bands are compile-time tables in IAPWS units (MPa, kJ), written into this file
+        /// by tabulate() through IF97_kernelgen --boundaries, so a curve is constant-initialized and
+        /// costs nothing to set up.  Where a curve passes through Region 3 its nodes come from the
+        /// iterated density solver, and the generator widens the bands to cover the direct one too.
+    public:
+        typedef double (*Exact)(IF97parameters key, double x);
+        static const int N = BOUNDARY_INTERVALS;
+        constexpr BoundaryCurve(Exact exact, IF97parameters key, double u0, double du, const double *y, const double *band)
+            : exact(exact), key(key), u0(u0), du(du), y(y), band(band) {}
+        /// The curve stored in row id of BoundaryTables.
+        constexpr BoundaryCurve(Exact exact, IF97parameters key, int id)
+            : BoundaryCurve(exact, key, BoundaryTables<>::u0[id], BoundaryTables<>::du[id], BoundaryTables<>::y[id],
+                            BoundaryTables<>::band[id]) {}
+        /// The boundary value at x, in the units of the library, or an interpolated stand-in on the
+        /// same side of X.  u is x on the table axis: ln(p/p_fact) for a pressure, x/R_fact otherwise.
+        double at(double x, double u, double X) const{
+            const int k = interval(u0, du, u);
+            const double b = R_fact*interpolate(y, u0, du, u, k);
+            return (std::abs(X - b) > R_fact*band[k]) ? b : exact(key, x);
+        }
+        /// Tabulates exact(key, x) for lo <= x <= hi into u0, du, y[N+1] and band[N], in IAPWS units,
+        /// at uniform steps of ln(x) or, with log_axis false, of x.  With singular_hi the last interval
+        /// gets an infinite band.  Used by IF97_kernelgen to write BoundaryTables, and by IF97.cpp to
+        /// check them.
+        static void tabulate(Exact exact, IF97parameters key, double lo, double hi, bool singular_hi, bool log_axis,
+                             double &u0, double &du, double y[], double band[]){
+            const double a = log_axis ? p_fact : R_fact;           // Library units per table unit
+            u0 = log_axis ? log(lo/a) : lo/a;
+            du = ((log_axis ? log(hi/a) : hi/a) - u0)/N;
+            for (int k = 0; k <= N; ++k){
+                const double u = u0 + k*du;
+                y[k] = exact(key, (k == 0) ? lo : (k == N) ? hi : (log_axis ? a*std::exp(u) : a*u))/R_fact;
+            }
+            double scale = 0;
+            for (int k = 0; k <= N; ++k) scale = std::max(scale, std::abs(y[k]));
+            std::vector<double> err(N, 0.0);
+            for (int k = 0; k < N; ++k)
+                for (int q = 1; q < 4; ++q){
+                    const double u = u0 + (k + 0.25*q)*du;
+                    const double x = log_axis ? a*std::exp(u) : a*u;
+                    err[k] = std::max(err[k], std::abs(interpolate(y, u0, du, u, k) - exact(key, x)/R_fact));
+                }
+            for (int k = 0; k < N; ++k)
+                band[k] = 16*std::max(err[k], std::max(err[std::max(k - 1, 0)], err[std::min(k + 1, N - 1)]))
+                          + 64*std::numeric_limits<double>::epsilon()*scale;
+            if (singular_hi) band[N-1] = std::numeric_limits<double>::infinity();
+        }
+    private:
+        Exact exact;
+        IF97parameters key;
+        double u0, du;
+        const double *y, *band;
+        static int interval(double u0, double du, double u){
+            const double t = (u - u0)/du;
+            return (t <= 0) ? 0 : (t >= N - 1) ? N - 1 : int(t);
+        }
+        static double interpolate(const double *y, double u0, double du, double u, int k){
+            const int j = std::min(std::max(k - 1, 0), N - 3);   // Nodes j .. j+3 around interval k
+            const double t = (u - u0)/du - j;
+            return -(t - 1)*(t - 2)*(t - 3)/6*y[j] + t*(t - 2)*(t - 3)/2*y[j+1]
+                   - t*(t - 1)*(t - 3)/2*y[j+2] + t*(t - 1)*(t - 2)/6*y[j+3];
+        }
+    };
+
+    class PXBoundaries{
+        /// The (p,X) boundaries used by RegionDetermination_pX for one of X = h or s, read from rows
+        /// first .. first+5 of BoundaryTables: X at Tmin and Tmax, X' and X'' on the saturation dome,
+        /// and, above P23min, X at T23min (Region 1 / 3a) and on the B23 line (Region 2 / 3b).
+    public:
+        static double Xmin(IF97parameters key, double p){ return Regions::R1.output(key, Tmin, p); }
+        static double Xmax(IF97parameters key, double p){ return Regions::R2.output(key, Tmax, p); }
+        static double Xliq(IF97parameters key, double p){ return RegionOutput(key, Tsat97(p), p, LIQUID); }
+        static double Xvap(IF97parameters key, double p){ return RegionOutput(key, Tsat97(p), p, VAPOR); }
+        static double X13(IF97parameters key, double p){ return Regions::R1.output(key, T23min, p); }
+        static double X23(IF97parameters key, double p){ return Regions::R2.output(key, Region23_p(p), p); }
+        constexpr PXBoundaries(IF97parameters key, int first)
+            : min(&Xmin, key, first), max(&Xmax, key, first + 1), liq(&Xliq, key, first + 2), vap(&Xvap, key, first + 3),
+              r13(&X13, key, first + 4), r23(&X23, key, first + 5) {}
+        const BoundaryCurve min, max, liq, vap, r13, r23;
+    };
+
+    // The one constant-initialized set of (p,h) and (p,s) boundary curves, kept like RegionRegistry.
+    // The (h,s) curves, which need the backward equations, are in HSBoundaryRegistry further down.
+    template<class Unused = void> struct BoundaryRegistry
+    {
+        static constexpr PXBoundaries pXh{IF97_HMASS, BC_HMIN};
+        static constexpr PXBoundaries pXs{IF97_SMASS, BC_SMIN};
+    };
+    template<class Unused> constexpr PXBoundaries BoundaryRegistry<Unused>::pXh;
+    template<class Unused> constexpr PXBoundaries BoundaryRegistry<Unused>::pXs;
+
+    inline const PXBoundaries &pX_boundaries(IF97parameters inkey){
+        return (inkey == IF97_HMASS) ? BoundaryRegistry<>::pXh : BoundaryRegistry<>::pXs;
+    };
+
+    inline IF97STATUS RegionDetermination_pX(double p, double X, IF97parameters inkey, IF97REGIONS &region){
+        // Non-throwing form of RegionDetermination_pX(p,X,inkey); region is only set when STATUS_OK is
+        // returned.  Same decisions as RegionDetermination_pX_exact(), with each boundary read from its
+        // precomputed curve and only evaluated exactly when X falls within the curve's error band.
+        if ((inkey != IF97_HMASS) && (inkey != IF97_SMASS)) return RegionDetermination_pX_exact(p, X, inkey, region);
+        if ((p < Pmin) || (p > Pmax)) return STATUS_P_RANGE;
+        const PXBoundaries &B = pX_boundaries(inkey);
+        const double u = log(p/p_fact);
+        if ((X < B.min.at(p, u, X)) || (X > B.max.at(p, u, X - 1.0E-10) + 1.0E-10)) return STATUS_X_RANGE;
+        double Xliq = 0, Xvap = 0;
+        if (p <= Pcrit){                                      // Check saturation Dome first
+            Xliq = B.liq.at(p, u, X);
+            if (Xliq <= X){
+                Xvap = B.vap.at(p, u, X);
+                if (X <= Xvap){ region = REGION_4; return STATUS_OK; }
+            }
+        }
+        if (p <= P23min)                                      // Xvap is only read when X >= Xliq
+            region = (X < Xliq) ? REGION_1 : (X > Xvap) ? REGION_2 : REGION_4;
+        else if (X <= B.r13.at(p, u, X))                      // T23min is also the Temp between R1 & R3a
+            region = REGION_1;
+        else if (X >= B.r23.at(p, u, X))                      // compare with X along B23 curve
+            region = REGION_2;
+        else
+            region = REGION_3;
+        return STATUS_OK;
+    };
+
+    inline IF97REGIONS RegionDetermination_pX(double p, double X, IF97parameters inkey){
+        IF97REGIONS region = REGION_1;
+        switch (RegionDetermination_pX(p, X, inkey, region)){
+            case STATUS_P_RANGE: throw std::out_of_range("Pressure out of range");
+            case STATUS_X_RANGE: throw std::out_of_range((inkey == IF97_HMASS) ? "Enthalpy out of range" : "Entropy out of range");
+            default: return region;
+        }
+    };
+
 
     inline int BackwardRegion(double p, double X, IF97parameters inkey){
         // This routine is for testing purposes only.  It returns the
@@ -4038,51 +6467,24 @@ namespace IF97
         }
     }
 
-    inline double RegionOutputBackward(double p, double X, IF97parameters inkey, bool Clip, IF97SatState State) {
-        // Note that this routine returns only temperature (IF97_T).  All other values should be
-        // calculated from this temperature and the known pressure using forward equations.
-        // Setup Backward Regions for output
-        static const Backwards::Region1H B1H;
-        static const Backwards::Region1S B1S;
-        static const Backwards::Region2aH B2aH;
-        static const Backwards::Region2bH B2bH;
-        static const Backwards::Region2cH B2cH;
-        static const Backwards::Region2aS B2aS;
-        static const Backwards::Region2bS B2bS;
-        static const Backwards::Region2cS B2cS;
-        static const Backwards::Region3aH B3aH;
-        static const Backwards::Region3bH B3bH;
-        static const Backwards::Region3aS B3aS;
-        static const Backwards::Region3bS B3bS;
-
-        // NOTE: Uncertainty in these reverse functions are ±25 mK, as documented in
-        //       IAPWS R7-97(2012) and IAPWS SR3-03(2014). This can result in temperatures
-        //       that are very slightly (within 25 mK) on the opposite side of the
-        //       saturation curve from S/H values that are very near saturation.  Use of these
-        //       temperatures (with specified pressure) to calculate other properties can
-        //       result in wildly inacurate properties returned from the wrong side of the
-        //       saturation curve. Code is added here in 2024 to limit T to the correct side 
-        //       of the saturation curve based on the (p,S) or (p,H) deternmined Region.
-        //
-        //       There are times, however, when we don't want to adjust the return temp,
-        //       like when directly calcualating other properties in Region 4.  The
-        //       boolean parameter Clip is provided to make that choice.  If Clip is false,
-        //       this function limiits to IF97's Tmin and Tmax; aka, no clipping.
-        //
-        // Make sure input and output keys are valid for Backward formulas
-        if ((inkey != IF97_HMASS) && (inkey != IF97_SMASS))
-        throw std::invalid_argument("Backward Formulas take variable inputs of Enthalpy or Entropy only.");
-
-        double tmin = Tmin, tmax = Tmax;  // Initialize tmin, tmax as clipping limits on sat. curve
-        const double eps = 1.0E-6;        // Saturation temperature offset of .001 mK
-                                          // When limiting to Tsat, this will keep
-                                          // temperature in Region 1 or Region 2.
-        if ((p < Pcrit) && Clip) {        // If below Pcrit (where Tsat is available),
-            double Tsat = Tsat97(p);      //     Only calculate Tsat ± eps once and 
-            tmin = Tsat + eps;            //     set tmin just above and
-            tmax = Tsat - eps;            //     tmax just below saturation.
-        }
-        else if (p == Pcrit) {            // Handle cases directly on the Critical Point
+    inline double BackwardOutput_pX(double p, double X, IF97parameters inkey, IF97REGIONS region, double tmin, double tmax) {
+        // T(p,X) from the backward formulas of a region already determined by the caller, limited
+        // to tmax in Regions 1 and 3a and to tmin in Regions 2 and 3b.  Points directly on the
+        // critical point return Tcrit.
+        const Backwards::Region1H &B1H = Regions::B1H;
+        const Backwards::Region1S &B1S = Regions::B1S;
+        const Backwards::Region2aH &B2aH = Regions::B2aH;
+        const Backwards::Region2bH &B2bH = Regions::B2bH;
+        const Backwards::Region2cH &B2cH = Regions::B2cH;
+        const Backwards::Region2aS &B2aS = Regions::B2aS;
+        const Backwards::Region2bS &B2bS = Regions::B2bS;
+        const Backwards::Region2cS &B2cS = Regions::B2cS;
+        const Backwards::Region3aH &B3aH = Regions::B3aH;
+        const Backwards::Region3bH &B3bH = Regions::B3bH;
+        const Backwards::Region3aS &B3aS = Regions::B3aS;
+        const Backwards::Region3bS &B3bS = Regions::B3bS;
+
+        if (p == Pcrit) {                 // Handle cases directly on the Critical Point
             switch (inkey) {
                 case IF97_HMASS:
                     if (X == Backwards::H3ab_p(Pcrit)) return Tcrit;
@@ -4095,22 +6497,6 @@ namespace IF97
             }
         }
 
-        // Determine IF97 Region for reverse calculation of temperature
-        IF97REGIONS region = RegionDetermination_pX(p, X, inkey);
-
-        // Override Region if State specified other than NONE in call parameter
-        if (State == LIQUID) {
-            if (p <= P23min)
-                    region = REGION_1;
-            else
-                    region = REGION_3;
-        } else if (State == VAPOR) {
-            if (p <= P23min)
-                    region = REGION_2;
-            else
-                    region = REGION_3;
-        }
-
         switch (region) {
         case REGION_1:
             if (inkey == IF97_HMASS)                          // Enthalpy
@@ -4159,8 +6545,142 @@ namespace IF97
         default:
                 throw std::out_of_range("Unable to match region");
         }
+    }  // Backward output (region known)
+
+    inline double RegionOutputBackward(double p, double X, IF97parameters inkey, bool Clip, IF97SatState State) {
+        // Note that this routine returns only temperature (IF97_T).  All other values should be
+        // calculated from this temperature and the known pressure using forward equations.
+        // NOTE: Uncertainty in these reverse functions are ±25 mK, as documented in
+        //       IAPWS R7-97(2012) and IAPWS SR3-03(2014). This can result in temperatures
+        //       that are very slightly (within 25 mK) on the opposite side of the
+        //       saturation curve from S/H values that are very near saturation.  Use of these
+        //       temperatures (with specified pressure) to calculate other properties can
+        //       result in wildly inacurate properties returned from the wrong side of the
+        //       saturation curve. Code is added here in 2024 to limit T to the correct side 
+        //       of the saturation curve based on the (p,S) or (p,H) deternmined Region.
+        //
+        //       There are times, however, when we don't want to adjust the return temp,
+        //       like when directly calcualating other properties in Region 4.  The
+        //       boolean parameter Clip is provided to make that choice.  If Clip is false,
+        //       this function limiits to IF97's Tmin and Tmax; aka, no clipping.
+        //
+        // Make sure input and output keys are valid for Backward formulas
+        if ((inkey != IF97_HMASS) && (inkey != IF97_SMASS))
+        throw std::invalid_argument("Backward Formulas take variable inputs of Enthalpy or Entropy only.");
+
+        double tmin = Tmin, tmax = Tmax;  // Initialize tmin, tmax as clipping limits on sat. curve
+        const double eps = 1.0E-6;        // Saturation temperature offset of .001 mK
+                                          // When limiting to Tsat, this will keep
+                                          // temperature in Region 1 or Region 2.
+        if ((p < Pcrit) && Clip) {        // If below Pcrit (where Tsat is available),
+            double Tsat = Tsat97(p);      //     Only calculate Tsat ± eps once and 
+            tmin = Tsat + eps;            //     set tmin just above and
+            tmax = Tsat - eps;            //     tmax just below saturation.
+        }
+
+        // Determine IF97 Region for reverse calculation of temperature
+        IF97REGIONS region = RegionDetermination_pX(p, X, inkey);
+
+        // Override Region if State specified other than NONE in call parameter
+        if (State == LIQUID) {
+            if (p <= P23min)
+                    region = REGION_1;
+            else
+                    region = REGION_3;
+        } else if (State == VAPOR) {
+            if (p <= P23min)
+                    region = REGION_2;
+            else
+                    region = REGION_3;
+        }
+
+        return BackwardOutput_pX(p, X, inkey, region, tmin, tmax);
     }  // Region Output backward
 
+
+    inline void RegionOutputBackward(const double *p, const double *X, std::size_t n, IF97parameters inkey, bool Clip,
+                                     double *T, IF97STATUS *status = 0, IF97SIMD level = simd_level()){
+        // Batch form of RegionOutputBackward(p, X, inkey, Clip, NONE) for n points.  The points are
+        // classified first, down to the backward subregion (1, 2a/2b/2c, 3a/3b), and their indices
+        // stable-partitioned by subregion, so that each T(p,X) table is summed over one contiguous
+        // bucket by the lane kernels of BackwardsRegion.  The Tsat clipping is then applied over each
+        // bucket as a plain min or max against a per-point limit, and the results are scattered back
+        // in input order.  A point whose p or X is out of range gets NaN and STATUS_P_RANGE or
+        // STATUS_X_RANGE in status[i]; with status null the scalar form's exception is thrown.
+        if ((inkey != IF97_HMASS) && (inkey != IF97_SMASS))
+            throw std::invalid_argument("Backward Formulas take variable inputs of Enthalpy or Entropy only.");
+        const bool H = (inkey == IF97_HMASS);
+        const Backwards::BackwardsRegion *const table[2][BACK_4] = {
+            {&Regions::B1S, &Regions::B2aS, &Regions::B2bS, &Regions::B2cS, &Regions::B3aS, &Regions::B3bS},
+            {&Regions::B1H, &Regions::B2aH, &Regions::B2bH, &Regions::B2cH, &Regions::B3aH, &Regions::B3bH}};
+        const double eps = 1.0E-6;        // Saturation temperature offset, as in the scalar form
+        // Buckets: the six backward subregions BACK_1 .. BACK_3B, then points already set (Region 4,
+        // the critical point) and bad points
+        const int DONE = BACK_4, BAD = BACK_4 + 1;
+        std::vector<unsigned char> bucket(n);
+        std::vector<double> limit(n);     // tmax for subregions 1 and 3a, tmin for the rest
+        std::size_t start[BAD + 2] = {0};
+        for (std::size_t i = 0; i < n; ++i){
+            const double pi = p[i], Xi = X[i];
+            IF97REGIONS region = REGION_1;
+            const IF97STATUS code = RegionDetermination_pX(pi, Xi, inkey, region);
+            int b = BAD;
+            if (code == STATUS_OK){
+                double tmin = Tmin, tmax = Tmax;
+                if ((pi < Pcrit) && Clip){
+                    const double Tsat = Tsat97(pi);
+                    tmin = Tsat + eps;
+                    tmax = Tsat - eps;
+                }
+                if ((pi == Pcrit) && (Xi == (H ? Backwards::H3ab_p(Pcrit) : Scrit))){
+                    T[i] = Tcrit;
+                    b = DONE;
+                }
+                else switch (region){
+                    case REGION_1: b = BACK_1; limit[i] = tmax; break;
+                    case REGION_2:
+                        if (pi <= P2amax) b = BACK_2A;
+                        else if ((pi <= P2bcmin) || (Xi >= (H ? Backwards::H2b2c_p(pi) : S2bc))) b = BACK_2B;
+                        else b = BACK_2C;
+                        limit[i] = tmin;
+                        break;
+                    case REGION_3:
+                        if (Xi <= (H ? Backwards::H3ab_p(pi) : Scrit)){ b = BACK_3A; limit[i] = tmax; }
+                        else { b = BACK_3B; limit[i] = tmin; }
+                        break;
+                    default: T[i] = Tsat97(pi); b = DONE; break;   // Region 4
+                }
+            }
+            else if (!status) RegionDetermination_pX(pi, Xi, inkey);   // Throws the matching exception
+            else T[i] = std::numeric_limits<double>::quiet_NaN();
+            if (status) status[i] = code;
+            bucket[i] = (unsigned char)b;
+            ++start[b + 1];
+        }
+        // Stable counting sort of the indices by subregion, with (p,X) and the limits gathered
+        for (int b = 0; b <= BAD; ++b) start[b+1] += start[b];
+        std::size_t first[BAD + 2];
+        std::copy(start, start + BAD + 2, first);
+        const std::size_t m = first[DONE];   // Points that need a T(p,X) sum
+        std::vector<std::size_t> row(m);
+        std::vector<double> pg(m), Xg(m), lg(m), Tg(m);
+        for (std::size_t i = 0; i < n; ++i){
+            if (bucket[i] >= DONE) continue;
+            const std::size_t j = start[bucket[i]]++;
+            row[j] = i; pg[j] = p[i]; Xg[j] = X[i]; lg[j] = limit[i];
+        }
+        for (int b = BACK_1; b < DONE; ++b){
+            const std::size_t j = first[b], k = first[b+1];
+            if (j == k) continue;
+            table[H][b]->T_pX(&pg[j], &Xg[j], k - j, &Tg[j], level);
+            if ((b == BACK_1) || (b == BACK_3A))   // Limit to below Tsat
+                for (std::size_t i = j; i < k; ++i) Tg[i] = std::min(lg[i], Tg[i]);
+            else                                   // Limit to above Tsat
+                for (std::size_t i = j; i < k; ++i) Tg[i] = std::max(lg[i], Tg[i]);
+        }
+        for (std::size_t j = 0; j < m; ++j) T[row[j]] = Tg[j];
+    }  // Region Output backward (batch)
+
     inline double rho_pX(double p, double X, IF97parameters inkey){
         // NOTE: This implementation does not work. While with the 2016 Supplementary Release
         //       for v(p,T) for Region 3 implemented it is no longer iterative, it is not
@@ -4168,8 +6688,6 @@ namespace IF97
         //       TODO: the 2014 Supplementary Release for v(p,h) and v(p,s) are 
         //       more direct and may be slightly faster, since only one algebraic 
         //       equation is needed instead of two in Region 3.
-        static const Region1 R1;
-        static const Region2 R2;
         const double T = RegionOutputBackward( p, X, inkey,true,NONE);  // Get Adjusted value of T
         if (RegionDetermination_pX(p, X, inkey) == REGION_4){      // If in saturation dome
             const double Tsat = Tsat97(p);
@@ -4202,9 +6720,9 @@ namespace IF97
             // There are no reverse functions for other than (p,H) or (p,S)
             throw std::invalid_argument("Reverse state cannot be determined for these inputs.");
 
-        static const Region1 R1;
-        static const Region2 R2;
-        static const Region3 R3;
+        const Region1 &R1 = Regions::R1;
+        const Region2 &R2 = Regions::R2;
+        const Region3 &R3 = Regions::R3;
 
         double Xliq = 0.0, Xvap = 0.0, Yliq = 0.0, Yvap = 0.0;
         double TL = 0.0, TV = 0.0;
@@ -4309,6 +6827,88 @@ namespace IF97
     }
 
 
+    inline FlashState flash_pX(double p, double X, IF97parameters inkey, bool Clip = true){
+        // Full state at (p,h) or (p,s) from a single region determination and a single backward
+        // T(p,X) sum, in place of one Y_pX() call per property.  The results follow Y_pX(): a
+        // single-phase point is evaluated at the unclipped backward temperature, while the reported
+        // T is clipped to the correct side of Tsat as in T_phmass() and T_psmass().  Under the vapor
+        // dome the quality comes from the saturation values of X at Tsat, and each phase is then
+        // evaluated once, at the backward temperature of its saturation X, and mixed by quality.
+        // With Clip false T is reported unclipped, as from RegionOutputBackward(p,X,inkey,false,NONE).
+        if ((inkey != IF97_HMASS) && (inkey != IF97_SMASS))
+            // There are no reverse functions for other than (p,H) or (p,S)
+            throw std::invalid_argument("Reverse state cannot be determined for these inputs.");
+
+        const Region1 &R1 = Regions::R1;
+        const Region2 &R2 = Regions::R2;
+        const Region3 &R3 = Regions::R3;
+
+        const double nan = std::numeric_limits<double>::quiet_NaN();
+        const State blank = {nan, p, nan, nan, nan, nan, nan, nan, nan, nan, nan, nan, nan, REGION_1};
+        FlashState fs = {p, nan, nan, nan, nan, nan, nan, nan, nan, REGION_1};
+        const bool H = (inkey == IF97_HMASS);
+
+        fs.region = RegionDetermination_pX(p, X, inkey);
+        switch (fs.region) {
+            case REGION_4: {                                      // Saturation dome (p <= Pcrit)
+                const double Tsat = Tsat97(p);
+                const bool R3sat = (p > P23min);                  // Saturation line in Region 3
+                const double Xliq = R3sat ? R3.output(inkey, Tsat, p, LIQUID) : R1.output(inkey, Tsat, p);
+                const double Xvap = R3sat ? R3.output(inkey, Tsat, p, VAPOR) : R2.output(inkey, Tsat, p);
+                const double Q = std::min(1.0, std::max(0.0, (X - Xliq) / (Xvap - Xliq)));
+                // Saturated phases at the un-clipped backward temperatures of Xliq and Xvap
+                const double TL = BackwardOutput_pX(p, Xliq, inkey, R3sat ? REGION_3 : REGION_1, Tmin, Tmax);
+                const double TV = BackwardOutput_pX(p, Xvap, inkey, R3sat ? REGION_3 : REGION_2, Tmin, Tmax);
+                const unsigned int mask = PROP_DMASS | PROP_HMASS | PROP_SMASS | PROP_UMASS;
+                State liq = blank, vap = blank;
+                if (R3sat) {
+                    R3.fill(TL, p, mask, LIQUID, liq);
+                    R3.fill(TV, p, mask, VAPOR, vap);
+                } else {
+                    R1.fill(TL, p, mask, liq);
+                    R2.fill(TV, p, mask, vap);
+                }
+                fs.T = Tsat;
+                fs.rhomass = 1.0 / ((1.0 / liq.rhomass) * (1 - Q) + Q * (1.0 / vap.rhomass));
+                fs.hmass = liq.hmass * (1 - Q) + Q * vap.hmass;
+                fs.smass = liq.smass * (1 - Q) + Q * vap.smass;
+                fs.umass = liq.umass * (1 - Q) + Q * vap.umass;
+                fs.Q = Q;
+            }; break;
+
+            case REGION_1:
+            case REGION_2:
+            case REGION_3: {
+                const double T = BackwardOutput_pX(p, X, inkey, fs.region, Tmin, Tmax);  // no clipping
+                const unsigned int mask = PROP_DMASS | PROP_HMASS | PROP_SMASS | PROP_UMASS | PROP_CPMASS | PROP_W;
+                // Regions 1 and 3a are liquid-like and limited to below Tsat, 2 and 3b to above it
+                const bool liquid = (fs.region == REGION_1) ||
+                                    ((fs.region == REGION_3) && (X <= (H ? Backwards::H3ab_p(p) : Scrit)));
+                State st = blank;
+                if (fs.region == REGION_1)      R1.fill(T, p, mask, st);
+                else if (fs.region == REGION_2) R2.fill(T, p, mask, st);
+                else                            R3.fill(T, p, mask, liquid ? LIQUID : VAPOR, st);
+                fs.T = T;
+                if ((p < Pcrit) && Clip) {                        // Same clipping as RegionOutputBackward()
+                    const double Tsat = Tsat97(p);
+                    fs.T = liquid ? std::min(Tsat - 1.0E-6, T) : std::max(Tsat + 1.0E-6, T);
+                }
+                fs.rhomass = st.rhomass;
+                fs.hmass = st.hmass;
+                fs.smass = st.smass;
+                fs.umass = st.umass;
+                fs.cpmass = st.cpmass;
+                fs.speed_sound = st.speed_sound;
+                fs.Q = liquid ? 0.0 : 1.0;
+            }; break;
+
+            default:  // all other regions
+                throw std::invalid_argument("Reverse state functions not defined in REGION 5");
+        }
+        if (H) fs.hmass = X; else fs.smass = X;                   // Trivial result, as in Y_pX()
+        return fs;
+    }
+
     inline double Q_pX(double p, double X, IF97parameters inkey){
         double Xliq, Xvap;
         if ((p<Pmin) || (p>Pmax)) {
@@ -4384,16 +6984,81 @@ namespace IF97
         return -1;  // Should never occur but eliminates warnings.
     };
 
+    inline void MixtureFill(const SatState &sat, double Q, MixtureState &mix){
+        // Mixes the saturated end points in sat by quality, with the same expressions as X_pQ()
+        mix.T = sat.T;
+        mix.p = sat.p;
+        mix.Q = Q;
+        mix.rhomass = 1.0/(Q*(1.0/sat.vap.rhomass) + (1-Q)*(1.0/sat.liq.rhomass));
+        mix.v = 1.0/mix.rhomass;
+        mix.hmass = Q*sat.vap.hmass + (1-Q)*sat.liq.hmass;
+        mix.smass = Q*sat.vap.smass + (1-Q)*sat.liq.smass;
+        mix.umass = Q*sat.vap.umass + (1-Q)*sat.liq.umass;
+        mix.liq = sat.liq;
+        mix.vap = sat.vap;
+    };
+
+    inline IF97STATUS MixtureCheck(double X, double Q, bool given_T){
+        // Range of a (p,Q) or (T,Q) mixture point; X is T when given_T, else p
+        if (given_T ? ((X < Ttrip) || (X > Tcrit)) : ((X < Ptrip) || (X > Pcrit)))
+            return given_T ? STATUS_T_RANGE : STATUS_P_RANGE;
+        if ((Q < 0.0) || (Q > 1.0))
+            return STATUS_Q_RANGE;
+        return STATUS_OK;
+    };
+
+    inline MixtureState MixtureOutput(double X, double Q, bool given_T, unsigned int mask){
+        // Mixture state at (p,Q), or at (T,Q) when given_T, with Tsat or psat computed once and each
+        // saturated phase evaluated once.  h, s, u and rho of both phases are always evaluated, the
+        // rest of their properties only when selected in mask.
+        switch (MixtureCheck(X, Q, given_T)){
+            case STATUS_T_RANGE: throw std::out_of_range("Temperature out of range");
+            case STATUS_P_RANGE: throw std::out_of_range("Pressure out of range");
+            case STATUS_Q_RANGE: throw std::out_of_range("Quality out of range");
+            default: break;
+        }
+        mask |= PROP_DMASS | PROP_HMASS | PROP_SMASS | PROP_UMASS;
+        MixtureState mix;
+        MixtureFill(given_T ? SatOutput(X, psat97(X), mask) : SatOutput(Tsat97(X), X, mask), Q, mix);
+        return mix;
+    };
 
-    static const double HTmaxdata[] = {
+    inline void MixtureOutput(const double *X, const double *Q, std::size_t n, bool given_T, unsigned int mask,
+                              MixtureState *mix, IF97STATUS *status = 0){
+        // Batch form of MixtureOutput() for n points.  The saturated phases are only evaluated again
+        // when p (or T) changes from one point to the next, so that a quality sweep at one pressure
+        // costs a single saturation state.  A point out of range gets NaN and STATUS_P_RANGE,
+        // STATUS_T_RANGE or STATUS_Q_RANGE in status[i]; with status null the exception is thrown.
+        const double nan = std::numeric_limits<double>::quiet_NaN();
+        const State blank = {nan, nan, nan, nan, nan, nan, nan, nan, nan, nan, nan, nan, nan, REGION_1};
+        const MixtureState bad = {nan, nan, nan, nan, nan, nan, nan, nan, blank, blank};
+        mask |= PROP_DMASS | PROP_HMASS | PROP_SMASS | PROP_UMASS;
+        SatState sat = {nan, nan, blank, blank};
+        bool have = false;                      // sat holds the phases at X[i-1]
+        for (std::size_t i = 0; i < n; ++i){
+            const IF97STATUS code = MixtureCheck(X[i], Q[i], given_T);
+            if (status) status[i] = code;
+            if (code != STATUS_OK){
+                if (!status) MixtureOutput(X[i], Q[i], given_T, mask);   // Throws the matching exception
+                mix[i] = bad;
+                continue;
+            }
+            if (!have || (X[i] != (given_T ? sat.T : sat.p))){
+                sat = given_T ? SatOutput(X[i], psat97(X[i]), mask) : SatOutput(Tsat97(X[i]), X[i], mask);
+                have = true;
+            }
+            MixtureFill(sat, Q[i], mix[i]);
+        }
+    };
+
+
+    alignas(64) static constexpr double HTmaxdata[] = {
         1.00645619394616E4,
         1.94706669580164E5,
         -4.67105212810782E5,
         -3.38175262587035E4
     };
 
-    static const std::vector<double> Hmax_n(HTmaxdata, HTmaxdata + sizeof(HTmaxdata)/sizeof(double));
-
     inline double Hmax(double s){
     // This function covers the top and right domain boundaries of constant Pmax and Tmax
         const double s_star = 1*R_fact, h_star = 1*R_fact, sigma = s/s_star;
@@ -4404,7 +7069,7 @@ namespace IF97
         // This linear combination fit h(s)=a*ln(s)+b/s+c/s²+d is not perfect, but it's close
         // and can serve as a limit along that Tmax boundary. Coefficients in HTmaxdata above.
         // There is a better way to do this using Newton-Raphson on Tmax = T(p,s), but it is iterative and slow.
-            double ETA = Hmax_n[0]*log(sigma) + Hmax_n[1]/sigma + Hmax_n[2]/powi(sigma,2) +Hmax_n[3];
+            double ETA = HTmaxdata[0]*log(sigma) + HTmaxdata[1]/sigma + HTmaxdata[2]/powi(sigma,2) +HTmaxdata[3];
             return ETA*h_star;
         }
     };
@@ -4420,15 +7085,69 @@ namespace IF97
         }
     };
 
+    class HSBoundaries{
+        /// The (h,s) domain boundaries checked by RegionDetermination_HS, read from BoundaryTables:
+        /// Hmax(s) along Pmax below STPmax and Hmin(s) along Pmin above Sgtrip.  The rest of both
+        /// boundaries (the Tmax fit and the line across the triple point) is cheap and stays exact.
+    public:
+        static double HPmax(IF97parameters, double s){
+            return RegionOutput( IF97_HMASS, RegionOutputBackward(Pmax, s, IF97_SMASS, false, NONE), Pmax, NONE);
+        }
+        static double HPmin(IF97parameters, double s){
+            return RegionOutput( IF97_HMASS, RegionOutputBackward(Pmin, s, IF97_SMASS, false, NONE), Pmin, NONE);
+        }
+        constexpr HSBoundaries() : max(&HPmax, IF97_HMASS, BC_HS_PMAX), min(&HPmin, IF97_HMASS, BC_HS_PMIN) {}
+        const BoundaryCurve max, min;
+    };
+
+    template<class Unused = void> struct HSBoundaryRegistry
+    {
+        static constexpr HSBoundaries hs{};
+    };
+    template<class Unused> constexpr HSBoundaries HSBoundaryRegistry<Unused>::hs;
+
+    inline const HSBoundaries &hs_boundaries(){
+        return HSBoundaryRegistry<>::hs;
+    };
+
+    // How each row of BoundaryTables is tabulated: its exact function, key, and range, whether
+    // its upper end is singular, and whether its axis is ln(p).
+    struct BoundarySpec{
+        const char *name;
+        BoundaryCurve::Exact exact;
+        IF97parameters key;
+        double lo, hi;
+        bool singular_hi, log_axis;
+    };
+    inline BoundarySpec boundary_spec(int id){
+        static const char *const names[BC_COUNT] = {"BC_HMIN", "BC_HMAX", "BC_HLIQ", "BC_HVAP", "BC_H13", "BC_H23",
+                                                    "BC_SMIN", "BC_SMAX", "BC_SLIQ", "BC_SVAP", "BC_S13", "BC_S23",
+                                                    "BC_HS_PMAX", "BC_HS_PMIN"};
+        if (id == BC_HS_PMAX){ BoundarySpec b = {names[id], &HSBoundaries::HPmax, IF97_HMASS, Smin, STPmax, false, false}; return b; }
+        if (id == BC_HS_PMIN){ BoundarySpec b = {names[id], &HSBoundaries::HPmin, IF97_HMASS, Sgtrip, Smax, false, false}; return b; }
+        const IF97parameters key = (id < BC_SMIN) ? IF97_HMASS : IF97_SMASS;
+        BoundarySpec b = {names[id], &PXBoundaries::Xmin, key, Pmin, Pmax, false, true};
+        switch (id % 6){
+            case 1: b.exact = &PXBoundaries::Xmax; break;
+            case 2: b.exact = &PXBoundaries::Xliq; b.hi = Pcrit; b.singular_hi = true; break;
+            case 3: b.exact = &PXBoundaries::Xvap; b.hi = Pcrit; b.singular_hi = true; break;
+            case 4: b.exact = &PXBoundaries::X13; b.lo = P23min; break;
+            case 5: b.exact = &PXBoundaries::X23; b.lo = P23min; break;
+        }
+        return b;
+    };
+
     inline IF97BACKREGIONS RegionDetermination_HS(double h, double s){
-        static const Backwards::Boundary13HS b13;
-        static const Backwards::Boundary23HS b23hs;
-        static const Backwards::Region2cHS R2c;
+        const Backwards::Boundary13HS &b13 = Regions::b13HS;
+        const Backwards::Boundary23HS &b23hs = Regions::b23HS;
+        const Backwards::Region2cHS &R2c = Regions::B2cHS;
 
         // Check Overall Boundaries
         if ( (s < Smin) || (s > Smax) ) 
             throw std::out_of_range("Entropy out of range");
-        if ( (h > Hmax(s)) || (h < Hmin(s)) )
+        // Hmax(s) and Hmin(s) read from their precomputed curves where those are defined
+        const HSBoundaries &B = hs_boundaries();
+        if ( (h > ((s < STPmax) ? B.max.at(s, s/R_fact, h) : Hmax(s))) || (h < ((s < Sgtrip) ? Hmin(s) : B.min.at(s, s/R_fact, h))) )
             throw std::out_of_range("Enthalpy out of range");
 
         // ============================================================================
@@ -4493,13 +7212,13 @@ namespace IF97
         // Note that this routine returns only temperature (IF97_T).  All other values should be
         // calculated from this temperature and the known pressure using forward equations.
         // Setup Backward Regions for output
-        static const Backwards::Region1HS B1HS;
-        static const Backwards::Region2aHS B2aHS;
-        static const Backwards::Region2bHS B2bHS;
-        static const Backwards::Region2cHS B2cHS;
-        static const Backwards::Region3aHS B3aHS;
-        static const Backwards::Region3bHS B3bHS;
-        static const Backwards::Region4HS B4HS;
+        const Backwards::Region1HS &B1HS = Regions::B1HS;
+        const Backwards::Region2aHS &B2aHS = Regions::B2aHS;
+        const Backwards::Region2bHS &B2bHS = Regions::B2bHS;
+        const Backwards::Region2cHS &B2cHS = Regions::B2cHS;
+        const Backwards::Region3aHS &B3aHS = Regions::B3aHS;
+        const Backwards::Region3bHS &B3bHS = Regions::B3bHS;
+        const Backwards::Region4HS &B4HS = Regions::B4HS;
         //
         double Pval, Tval;
 
@@ -4538,12 +7257,64 @@ namespace IF97
                 return RegionOutputBackward(Pval,h,IF97_HMASS,false,NONE);  // Not REGION 4 Calc from Backward T(p,h)
     }  // Region Output backward
 
+    inline FlashState flash_HS(double h, double s){
+        // Full state at (h,s) from one (h,s) region determination.  Outside Region 4 the pressure
+        // comes from the backward p(h,s) of that subregion and the rest from the (p,h) flash at that
+        // pressure without clipping, so that p and T match BackwardOutputHS().  In Region 4, where
+        // T(h,s) is only defined for s >= s"(T23min), Tsat comes from T(h,s) and the quality from s,
+        // with both saturated phases evaluated once at Tsat in Regions 1 and 2.
+        const Backwards::Region1HS &B1HS = Regions::B1HS;
+        const Backwards::Region2aHS &B2aHS = Regions::B2aHS;
+        const Backwards::Region2bHS &B2bHS = Regions::B2bHS;
+        const Backwards::Region2cHS &B2cHS = Regions::B2cHS;
+        const Backwards::Region3aHS &B3aHS = Regions::B3aHS;
+        const Backwards::Region3bHS &B3bHS = Regions::B3bHS;
+        const Backwards::Region4HS &B4HS = Regions::B4HS;
+        //
+        double Pval;
+
+        switch (RegionDetermination_HS(h, s)){
+        case BACK_1:   Pval = B1HS.p_hs(h,s);  break;
+        case BACK_2A:  Pval = B2aHS.p_hs(h,s); break;
+        case BACK_2B:  Pval = B2bHS.p_hs(h,s); break;
+        case BACK_2C:  Pval = B2cHS.p_hs(h,s); break;
+        case BACK_3A:  Pval = B3aHS.p_hs(h,s); break;
+        case BACK_3B:  Pval = B3bHS.p_hs(h,s); break;
+        case BACK_4: {
+            if (s < SgT23)   // T(h,s) only defined over part of the 2-phase region
+                throw std::out_of_range("Entropy out of range");
+            const double nan = std::numeric_limits<double>::quiet_NaN();
+            const double Tsat = B4HS.t_hs(h,s);
+            const double p = psat97(Tsat);
+            const unsigned int mask = PROP_DMASS | PROP_SMASS | PROP_UMASS;
+            State liq = {Tsat, p, nan, nan, nan, nan, nan, nan, nan, nan, nan, nan, nan, REGION_1}, vap = liq;
+            Regions::R1.fill(Tsat, p, mask, liq);            // Sat. Liquid
+            Regions::R2.fill(Tsat, p, mask, vap);            // Sat. Vapor
+            const double Q = std::min(1.0, std::max(0.0, (s - liq.smass) / (vap.smass - liq.smass)));
+            const FlashState fs = {p, Tsat, 1.0 / ((1.0 / liq.rhomass) * (1 - Q) + Q * (1.0 / vap.rhomass)), h, s,
+                                   liq.umass * (1 - Q) + Q * vap.umass, nan, nan, Q, REGION_4};
+            return fs;
+        }
+        default: throw std::out_of_range("Unable to match region");
+        }
+        FlashState fs = flash_pX(Pval, h, IF97_HMASS, false);
+        fs.smass = s;                    // Trivial result
+        return fs;
+    }  // Flash HS
+
     // ******************************************************************************** //
     //                                     API                                          //
     // ******************************************************************************** //
 
     /// Get the mass density [kg/m^3] as a function of T [K] and p [Pa]
     inline double rhomass_Tp(double T, double p){ return RegionOutput( IF97_DMASS, T, p, NONE); };
+    /// Get the mass density [kg/m^3] as a function of T [K] and p [Pa], solving Region 3 with the given
+    /// solver settings instead of the process-wide ones; iter returns the Region 3 iterations taken
+    inline double rhomass_Tp(double T, double p, const Region3Solver &solver, int &iter){
+        iter = 0;
+        if (RegionDetermination_TP(T, p) == REGION_3) return Regions::R3.rho_Tp(T, p, NONE, solver, iter);
+        return RegionOutput( IF97_DMASS, T, p, NONE);
+    };
     /// Get the mass enthalpy [J/kg] as a function of T [K] and p [Pa]
     inline double hmass_Tp(double T, double p){ return RegionOutput( IF97_HMASS, T, p, NONE); };
     /// Get the mass entropy [J/kg/K] as a function of T [K] and p [Pa]
@@ -4567,8 +7338,7 @@ namespace IF97
     /// Used for function verification only
     inline double visc_TRho(double T, double rho) {	
         // Since we have density, we don't need to determine the region for viscosity.
-        static const Region1 R1;  // All regions use base region equations for visc(T,rho).
-        return R1.visc( T, rho );
+        return Regions::TR.visc( T, rho );  // All regions share the transport equations for visc(T,rho).
     };
     /// Get the viscosity [Pa-s] as a function of T [K] and p [Pa]
     inline double visc_Tp(double T, double p) { return RegionOutput(IF97_MU, T, p, NONE); };
@@ -4577,7 +7347,7 @@ namespace IF97
     /// Used for function verification only
     inline double tcond_TpRho(double T, double p, double rho) {
         // Since we have density, we don't need to determine the region for viscosity.
-        static const Region1 R1;  // All regions use base region equations for tcond(T,p,rho).
+        const Region1 &R1 = Regions::R1;  // All regions use base region equations for tcond(T,p,rho).
         return R1.tcond(T, p, rho);
     };
     /// Get the thermal conductivity [W/m-K] as a function of T [K] and p [Pa]
@@ -4586,7 +7356,13 @@ namespace IF97
 
     /// Calculate the Prandtl number [dimensionless] as a function of T [K] and p [Pa]
     inline double prandtl_Tp(double T, double p) { 
-        return visc_Tp(T,p) * cpmass_Tp(T,p) * (1000/R_fact) / tcond_Tp(T,p);
+        return props_Tp(T, p, PROP_PR).prandtl;   // mu, cp and k from one region evaluation
+    };
+    /// Get density, cp, viscosity, thermal conductivity, and Prandtl number together as a function
+    /// of T [K] and p [Pa].  The region, derivatives, and viscosity are evaluated once for all five.
+    /// Region 3 densities are solved with the given solver settings, as in props_Tp().
+    inline State transport_Tp(double T, double p, const Region3Solver &solver = region3_solver()) {
+        return props_Tp(T, p, PROP_DMASS | PROP_CPMASS | PROP_MU | PROP_K | PROP_PR, solver);
     };
 
     // ******************************************************************************** //
@@ -4641,6 +7417,13 @@ namespace IF97
     inline double prandtlliq_p(double p) { return viscliq_p(p) * cpliq_p(p) * (1000/R_fact) / tcondliq_p(p); };
     /// Calculate the saturated vapor Prandtl number [dimensionless] as a function of p [Pa]
     inline double prandtlvap_p(double p) { return viscvap_p(p) * cpvap_p(p) * (1000/R_fact) / tcondvap_p(p); };
+    // ******************************************************************************** //
+    /// Get every saturated liquid and vapor property as a function of p [Pa], with Tsat and each
+    /// phase evaluated only once
+    inline SatState sat_p(double p){ return SatOutput(Tsat97(p), p); };
+    /// Get every saturated liquid and vapor property as a function of T [K], with psat and each
+    /// phase evaluated only once
+    inline SatState sat_T(double T){ return SatOutput(T, psat97(T)); };
 
 
     // ******************************************************************************** //
@@ -4648,17 +7431,17 @@ namespace IF97
     // ******************************************************************************** //
     /// Get the saturation temperature [K] as a function of p [Pa]
     inline double Tsat97(double p){
-        static const Region4 R4;
+        const Region4 &R4 = Regions::R4;
         return R4.T_p(p);
     };
     /// Get the saturation pressure [Pa] as a function of T [K]
     inline double psat97(double T){
-        static const Region4 R4;
+        const Region4 &R4 = Regions::R4;
         return R4.p_T(T);
     };
     /// Get surface tension [N/m] as a function of T [K]
 	inline double sigma97(double T){
-		static const Region4 R4;
+		const Region4 &R4 = Regions::R4;
 		return R4.sigma_t(T);
 	};
     // ******************************************************************************** //
@@ -4674,6 +7457,14 @@ namespace IF97
     inline double T_psmass(double p,double s){
         return RegionOutputBackward( p, s, IF97_SMASS,true,NONE);
     };
+    /// T(p,h) and T(p,s) at n points, see the batch RegionOutputBackward().  Points out of range
+    /// get NaN and a status code, or throw when status is null.
+    inline void T_phmass(const double *p, const double *h, std::size_t n, double *T, IF97STATUS *status = 0){
+        RegionOutputBackward(p, h, n, IF97_HMASS, true, T, status);
+    };
+    inline void T_psmass(const double *p, const double *s, std::size_t n, double *T, IF97STATUS *status = 0){
+        RegionOutputBackward(p, s, n, IF97_SMASS, true, T, status);
+    };
     inline double rhomass_psmass(double p,double s){
 //        return rho_pX( p, s, IF97_SMASS); << Replace with the IF97 Suppliment Backward formula
         return Y_pX(IF97_DMASS, p, s, IF97_SMASS);  // Use this one for now.
@@ -4684,6 +7475,19 @@ namespace IF97
     inline double T_hsmass(double h, double s){
         return BackwardOutputHS(IF97_T, h, s);
     };
+    /// Get the full state [FlashState] at p [Pa] and h [J/kg], or at p [Pa] and s [J/kg/K], from one
+    /// region determination and one backward temperature; see flash_pX()
+    inline FlashState flash_ph(double p, double h){
+        return flash_pX(p, h, IF97_HMASS);
+    };
+    inline FlashState flash_ps(double p, double s){
+        return flash_pX(p, s, IF97_SMASS);
+    };
+    /// Get the full state [FlashState] at h [J/kg] and s [J/kg/K], including p [Pa], from one (h,s)
+    /// region determination; see flash_HS()
+    inline FlashState flash_hs(double h, double s){
+        return flash_HS(h, s);
+    };
     inline double hmass_psmass(double p, double s) {
         return Y_pX(IF97_HMASS, p, s, IF97_SMASS);
     };
@@ -4715,6 +7519,332 @@ namespace IF97
     inline double get_MW() { return MW; };
     inline double get_Rgas() { return Rgas; };
     inline double get_Acentric() { return -log10(psat97(0.7*Tcrit)/Pcrit) - 1; };
+    /// Get or set the Region 3 density solver used by every (T,p) property call that is not given
+    /// its own Region3Solver.  Not synchronized: set it before starting threads that evaluate
+    /// properties, and pass a Region3Solver to props_Tp(), transport_Tp() or batch::eval_Tp()
+    /// to use other settings alongside it.
+    inline Region3Solver get_region3_solver(){ return region3_solver(); };
+    inline void set_region3_solver(IF97R3SOLVER method, double tol = 1.0e-9, int max_iter = 100){
+        if (!(tol > 0)) throw std::invalid_argument("Region 3 solver tolerance must be positive");
+        if (max_iter < 1) throw std::invalid_argument("Region 3 solver needs at least one iteration");
+        const Region3Solver solver = {method, tol, max_iter};
+        region3_solver() = solver;
+    };
+    // ******************************************************************************** //
+    //                               Batch Functions                                    //
+    // ******************************************************************************** //
+    namespace batch{
+
+        /// Number of property columns addressable through a PROP_* mask
+        constexpr int PROP_COUNT = 11;
+
+        /// Strided element access: element i of a column that starts at x and advances
+        /// stride bytes per element, so that fields can be read in place from arrays of records.
+        inline double at(const double *x, std::size_t stride, std::size_t i){
+            return *reinterpret_cast<const double *>(reinterpret_cast<const char *>(x) + i*stride);
+        };
+
+        /// Copies the properties selected in mask from st to element i of the output columns
+        inline void store(const State &st, unsigned int mask, double *const *outputs, std::size_t i){
+            static const double State::*const column[PROP_COUNT] = {
+                &State::rhomass, &State::hmass, &State::smass, &State::umass, &State::cpmass, &State::cvmass,
+                &State::speed_sound, &State::drhodp, &State::visc, &State::tcond, &State::prandtl};
+            for (int k = 0; k < PROP_COUNT; ++k)
+                if (mask & (1u << k)) outputs[k][i] = st.*column[k];
+        };
+
+        /// Evaluates one homogeneous Region 1, 2 or 5 bucket of m points: the Gibbs bundles come from
+        /// the lane kernels a chunk at a time, and the states are scattered back to their input rows.
+        inline void fill_bucket(const BaseRegion &R, const double *T, const double *p, const std::size_t *row,
+                                std::size_t m, unsigned int mask, double *const *outputs, const State &blank, IF97SIMD level){
+            const std::size_t chunk = 64;
+            GibbsDerivatives d[chunk];
+            for (std::size_t i = 0; i < m; i += chunk){
+                const std::size_t c = std::min(chunk, m - i);
+                R.derivs(T + i, p + i, c, d, level);
+                for (std::size_t k = 0; k < c; ++k){
+                    State st = blank;
+                    R.fill(T[i+k], p[i+k], mask, d[k], st);
+                    store(st, mask, outputs, row[i+k]);
+                }
+            }
+        };
+
+        /// As above for m Region 3 points of SR5-05 subregion region, whose densities are solved
+        /// together first with the given solver settings.  Points that fail to converge keep blank
+        /// outputs and get STATUS_NO_CONVERGENCE.
+        inline void fill_bucket(const Region3 &R, char region, const double *T, const double *p, const std::size_t *row,
+                                std::size_t m, unsigned int mask, double *const *outputs, IF97STATUS *status,
+                                const State &blank, const Region3Solver &solver, IF97SIMD level){
+            std::vector<double> rho(m);
+            std::vector<IF97STATUS> code(m);
+            R.rho_Tp(region, T, p, m, &rho[0], &code[0], solver, level);
+            const bool need_phi = (mask & ~(PROP_DMASS | PROP_MU)) != 0;
+            const std::size_t chunk = 64;
+            HelmholtzDerivatives d[chunk];
+            for (std::size_t i = 0; i < m; i += chunk){
+                const std::size_t c = std::min(chunk, m - i);
+                if (need_phi) R.derivs(T + i, &rho[i], c, d, level);
+                for (std::size_t k = 0; k < c; ++k){
+                    State st = blank;
+                    if (code[i+k] == STATUS_OK)
+                        R.fill(T[i+k], p[i+k], rho[i+k], mask, need_phi ? d[k] : HelmholtzDerivatives(), st);
+                    store(st, mask, outputs, row[i+k]);
+                    if (status) status[row[i+k]] = code[i+k];
+                }
+            }
+        };
+
+        /// Runs the tasks of a batch call.  run(ntasks, task) must call task(0) ... task(ntasks-1) once
+        /// each, in any order and on any threads, and return when all have finished.  The tasks are
+        /// independent and write disjoint outputs.  Derive from this to run the batch functions on an
+        /// existing thread pool (TBB, OpenMP, ...).
+        class Executor{
+        public:
+            virtual ~Executor(){}
+            virtual void run(std::size_t ntasks, const std::function<void(std::size_t)> &task) = 0;
+        };
+
+        /// Runs the tasks in order on the calling thread.
+        class SerialExecutor : public Executor{
+        public:
+            void run(std::size_t ntasks, const std::function<void(std::size_t)> &task){
+                for (std::size_t i = 0; i < ntasks; ++i) task(i);
+            }
+        };
+
+        /// A fixed set of worker threads with work stealing.  Each run() hands every thread, the
+        /// calling thread included, a contiguous block of the task indices in its own queue.  A thread
+        /// takes its tasks from the front of its queue and, once that is empty, steals from the back of
+        /// the others', so that threads whose blocks hold cheap Region 1/2 tasks take over the expensive
+        /// Region 3 tasks of the rest.  The first exception thrown by a task is rethrown by run(), after
+        /// all other tasks have finished.  run() may be called from one thread at a time.
+        class ThreadPool : public Executor{
+        public:
+            /// nthreads counts the calling thread; 0 selects std::thread::hardware_concurrency().
+            explicit ThreadPool(unsigned nthreads = 0)
+                : nthreads(nthreads ? nthreads : std::max(1u, std::thread::hardware_concurrency())),
+                  queues(new Queue[this->nthreads]), job(0), generation(0), busy(0), stop(false){
+                for (unsigned w = 1; w < this->nthreads; ++w) workers.push_back(std::thread(&ThreadPool::worker, this, w));
+            }
+            ~ThreadPool(){
+                {
+                    std::lock_guard<std::mutex> lock(m);
+                    stop = true;
+                }
+                wake.notify_all();
+                for (std::size_t w = 0; w < workers.size(); ++w) workers[w].join();
+            }
+            unsigned size() const{ return nthreads; }
+            void run(std::size_t ntasks, const std::function<void(std::size_t)> &task){
+                if (ntasks == 0) return;
+                std::lock_guard<std::mutex> running(run_lock);
+                {
+                    std::unique_lock<std::mutex> lock(m);
+                    done.wait(lock, [this]{ return busy == 0; });   // Stragglers of the last run
+                    for (unsigned w = 0; w < nthreads; ++w){
+                        std::lock_guard<std::mutex> q(queues[w].lock);
+                        for (std::size_t t = ntasks*w/nthreads; t < ntasks*(w + 1)/nthreads; ++t) queues[w].tasks.push_back(t);
+                    }
+                    job = &task;
+                    error = std::exception_ptr();
+                    ++generation;
+                    ++busy;
+                }
+                wake.notify_all();
+                work(0);
+                std::unique_lock<std::mutex> lock(m);
+                if (--busy) done.wait(lock, [this]{ return busy == 0; });
+                job = 0;
+                if (error) std::rethrow_exception(error);
+            }
+        private:
+            struct Queue{
+                std::mutex lock;
+                std::deque<std::size_t> tasks;
+            };
+            ThreadPool(const ThreadPool &);
+            ThreadPool &operator=(const ThreadPool &);
+            bool pop(unsigned w, std::size_t &t){
+                std::lock_guard<std::mutex> q(queues[w].lock);
+                if (queues[w].tasks.empty()) return false;
+                t = queues[w].tasks.front();
+                queues[w].tasks.pop_front();
+                return true;
+            }
+            bool steal(unsigned w, std::size_t &t){
+                for (unsigned k = 1; k < nthreads; ++k){
+                    Queue &victim = queues[(w + k) % nthreads];
+                    std::lock_guard<std::mutex> q(victim.lock);
+                    if (victim.tasks.empty()) continue;
+                    t = victim.tasks.back();
+                    victim.tasks.pop_back();
+                    return true;
+                }
+                return false;
+            }
+            void work(unsigned w){
+                // No tasks are added during a run, so once every queue is empty this thread is done
+                std::size_t t;
+                while (pop(w, t) || steal(w, t)){
+                    try{
+                        (*job)(t);
+                    }
+                    catch (...){
+                        std::lock_guard<std::mutex> lock(m);
+                        if (!error) error = std::current_exception();
+                    }
+                }
+            }
+            void worker(unsigned w){
+                std::size_t seen = 0;
+                std::unique_lock<std::mutex> lock(m);
+                for (;;){
+                    wake.wait(lock, [&]{ return stop || generation != seen; });
+                    if (stop) return;
+                    seen = generation;
+                    if (!job) continue;   // Woke after the run had already finished
+                    ++busy;
+                    lock.unlock();
+                    work(w);
+                    lock.lock();
+                    if (--busy == 0) done.notify_all();
+                }
+            }
+            const unsigned nthreads;
+            std::unique_ptr<Queue[]> queues;
+            std::vector<std::thread> workers;
+            std::mutex m, run_lock;
+            std::condition_variable wake, done;
+            const std::function<void(std::size_t)> *job;
+            std::exception_ptr error;
+            std::size_t generation, busy;
+            bool stop;
+        };
+
+        /// Evaluates the properties selected in mask at n (T,p) points.
+        ///   T, p        Input temperatures [K] and pressures [Pa*], read with byte strides T_stride and
+        ///               p_stride (sizeof(double) for plain arrays, sizeof(record) for arrays of records)
+        ///   outputs     One column of n doubles per property, indexed by mask bit: outputs[k] receives
+        ///               the property with bit (1 << k), e.g. outputs[9] the conductivity for PROP_K.
+        ///               Columns for unselected properties are not touched and may be null.
+        ///   status      Per-point result codes, or null.  A point that is out of range, on the
+        ///               saturation line, or fails to converge gets NaN outputs and its error code,
+        ///               and the rest of the batch is still evaluated; nothing is thrown.
+        ///   exec        Runs the tasks, e.g. a ThreadPool.  The results do not depend on it: they are
+        ///               identical to those of the serial overload below.
+        ///   level       Widest SIMD kernel set to use (by default the widest the CPU supports);
+        ///               with SIMD_SCALAR the results are bit-identical to props_Tp().
+        ///   solver      Region 3 density solver settings, by default the process-wide ones.  They are
+        ///               copied on entry, so every point of the call uses the same settings.
+        /// The points are taken in blocks of BLOCK, so that the scratch arrays stay bounded (about 30 bytes
+        /// per block point) however large n is.  Within a block all points are classified first, Region 3
+        /// points down to their SR5-05 subregion, and their indices stable-partitioned by region, so that
+        /// each bucket is evaluated by its own batch kernels without a per-point region switch, and the
+        /// results are scattered back in input order.  Classification, partition and buckets are all split
+        /// into tasks of TASK points; bucket tasks start at multiples of TASK within their bucket, so the
+        /// SIMD lane groups never depend on the executor.
+        constexpr std::size_t TASK = 1024;         // A multiple of the 64-point kernel chunks
+        constexpr std::size_t BLOCK = 1024*TASK;   // Points classified, partitioned and evaluated together
+        inline void eval_Tp(const double *T, const double *p, std::size_t n, unsigned int mask,
+                            double *const *outputs, IF97STATUS *status, Executor &exec,
+                            std::size_t T_stride = sizeof(double), std::size_t p_stride = sizeof(double),
+                            IF97SIMD level = simd_level(), const Region3Solver &solver = region3_solver()){
+            const Region3Solver r3 = solver;
+            const double nan = std::numeric_limits<double>::quiet_NaN();
+            const State blank = {nan, nan, nan, nan, nan, nan, nan, nan, nan, nan, nan, nan, nan, REGION_1};
+            // Buckets: Regions 1, 2 and 5, the 26 Region 3 subregions 'A'..'Z', and the bad points
+            enum { B_R1, B_R2, B_R5, B_R3, B_BAD = B_R3 + 26, NBUCKET };
+            const std::size_t nmax = std::min(n, BLOCK);
+            std::vector<unsigned char> bucket(nmax);
+            std::vector<IF97STATUS> code(nmax);
+            std::vector<std::size_t> row(nmax);
+            std::vector<double> Tg(nmax), pg(nmax);
+            // Per classification task and bucket: the point count, then the task's first slot in the bucket
+            std::vector<std::size_t> slot(((nmax + TASK - 1)/TASK)*NBUCKET);
+            std::vector<std::size_t> task_begin, task_end;
+            std::vector<int> task_bucket;
+            const BaseRegion *const gibbs[] = {&Regions::R1, &Regions::R2, &Regions::R5};
+            for (std::size_t i0 = 0; i0 < n; i0 += BLOCK){
+                const std::size_t nb = std::min(BLOCK, n - i0), ntask = (nb + TASK - 1)/TASK;
+                exec.run(ntask, [&](std::size_t t){
+                    std::size_t *count = &slot[t*NBUCKET];
+                    std::fill(count, count + NBUCKET, std::size_t(0));
+                    for (std::size_t k = t*TASK; k < std::min(nb, (t + 1)*TASK); ++k){
+                        const double Ti = at(T, T_stride, i0 + k), pi = at(p, p_stride, i0 + k);
+                        IF97REGIONS region = REGION_1;
+                        code[k] = RegionDetermination_TP(Ti, pi, region);
+                        if ((code[k] == STATUS_OK) && (region == REGION_4)) code[k] = STATUS_SATURATED;
+                        int b = B_BAD;
+                        if (code[k] == STATUS_OK) switch (region){
+                            case REGION_1: b = B_R1; break;
+                            case REGION_2: b = B_R2; break;
+                            case REGION_5: b = B_R5; break;
+                            default:{
+                                const char sub = Region3Backwards::BackwardsRegion3RegionDetermination(Ti, pi);
+                                if (sub >= 'A' && sub <= 'Z') b = B_R3 + (sub - 'A');
+                                else code[k] = STATUS_P_RANGE;   // Outside every SR5-05 pressure band
+                            }
+                        }
+                        bucket[k] = (unsigned char)b;
+                        ++count[b];
+                    }
+                });
+                // Stable counting sort of the block by bucket: each task writes its points of bucket b
+                // from slot[t*NBUCKET + b] on, after those of the tasks before it.  The (T,p) pairs are
+                // gathered into unit-stride columns on the way.
+                std::size_t first[NBUCKET + 1];
+                std::size_t next = 0;
+                for (int b = 0; b < NBUCKET; ++b){
+                    first[b] = next;
+                    for (std::size_t t = 0; t < ntask; ++t){
+                        const std::size_t c = slot[t*NBUCKET + b];
+                        slot[t*NBUCKET + b] = next;
+                        next += c;
+                    }
+                }
+                first[NBUCKET] = next;
+                exec.run(ntask, [&](std::size_t t){
+                    std::size_t *to = &slot[t*NBUCKET];
+                    for (std::size_t k = t*TASK; k < std::min(nb, (t + 1)*TASK); ++k){
+                        const std::size_t j = to[bucket[k]]++;
+                        row[j] = i0 + k; Tg[j] = at(T, T_stride, i0 + k); pg[j] = at(p, p_stride, i0 + k);
+                        if (status) status[i0 + k] = code[k];
+                    }
+                });
+                // One task per TASK points of each bucket
+                task_begin.clear(); task_end.clear(); task_bucket.clear();
+                for (int b = 0; b < NBUCKET; ++b)
+                    for (std::size_t j = first[b]; j < first[b+1]; j += TASK){
+                        task_begin.push_back(j);
+                        task_end.push_back(std::min(first[b+1], j + TASK));
+                        task_bucket.push_back(b);
+                    }
+                exec.run(task_bucket.size(), [&](std::size_t t){
+                    const std::size_t j = task_begin[t], m = task_end[t] - task_begin[t];
+                    const int b = task_bucket[t];
+                    if (b < B_R3)
+                        fill_bucket(*gibbs[b], &Tg[j], &pg[j], &row[j], m, mask, outputs, blank, level);
+                    else if (b < B_BAD)
+                        fill_bucket(Regions::R3, (char)('A' + (b - B_R3)), &Tg[j], &pg[j], &row[j], m, mask, outputs, status, blank,
+                                    r3, level);
+                    else
+                        for (std::size_t k = j; k < j + m; ++k) store(blank, mask, outputs, row[k]);
+                });
+            }
+        };
+
+        /// Serial form of eval_Tp(), on the calling thread.
+        inline void eval_Tp(const double *T, const double *p, std::size_t n, unsigned int mask,
+                            double *const *outputs, IF97STATUS *status,
+                            std::size_t T_stride = sizeof(double), std::size_t p_stride = sizeof(double),
+                            IF97SIMD level = simd_level(), const Region3Solver &solver = region3_solver()){
+            SerialExecutor serial;
+            eval_Tp(T, p, n, mask, outputs, status, serial, T_stride, p_stride, level, solver);
+        };
+
+    }; /* namespace batch */
+
     // ******************************************************************************** //
     //                              Utility Functions                                   //
     // ******************************************************************************** //
@@ -4742,6 +7872,26 @@ namespace IF97
     inline double rhomass_pQ(double p,double Q){
         return X_pQ(IF97_DMASS, p, Q);
     };
+    /// Get the mixture state [MixtureState] at p [Pa] or T [K] and vapor quality Q, with h, s, u, v and
+    /// rho of the mixture and the saturated liquid and vapor end points, from one evaluation per phase.
+    /// The end points also carry the other properties selected in mask.
+    inline MixtureState mixture_pQ(double p, double Q, unsigned int mask = PROP_ALL){
+        return MixtureOutput(p, Q, false, mask);
+    };
+    inline MixtureState mixture_TQ(double T, double Q, unsigned int mask = PROP_ALL){
+        return MixtureOutput(T, Q, true, mask);
+    };
+    /// Mixture states at n points, see the batch MixtureOutput().  A quality sweep at one p or T
+    /// evaluates the saturated phases once.  Points out of range get NaN and a status code, or throw
+    /// when status is null.
+    inline void mixture_pQ(const double *p, const double *Q, std::size_t n, MixtureState *mix,
+                           IF97STATUS *status = 0, unsigned int mask = PROP_ALL){
+        MixtureOutput(p, Q, n, false, mask, mix, status);
+    };
+    inline void mixture_TQ(const double *T, const double *Q, std::size_t n, MixtureState *mix,
+                           IF97STATUS *status = 0, unsigned int mask = PROP_ALL){
+        MixtureOutput(T, Q, n, true, mask, mix, status);
+    };
     inline double Q_phmass(double p,double h){
         return Q_pX(p, h, IF97_HMASS);
     };
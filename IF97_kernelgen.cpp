@@ -0,0 +1,411 @@
+// IF97 kernel generator
+//
+// Reads the coefficient tables compiled into IF97.h and writes IF97_kernels.h, a header of fully
+// unrolled, branch-free evaluators, one per table, with every exponent fixed at compile time.
+// When a program defines IF97_KERNELS and has the generated header on its include path, the
+// region constructors name these kernels with IF97_KERNEL() and use them in place of their
+// table-walking loops (see the "Compiler Switches" section of README.md).
+//
+// Integer powers are built with the same products PowerLadder and powi() form, and every sum is
+// accumulated in table order with the same expressions as the table-walking code, so the kernels
+// reproduce the Region 1/2/3/5 and Region 3 v(T,p) results bit for bit.  Gibbs tables below
+// IF97::LADDER_MIN_TERMS (Region 5) follow BaseRegion::derivs_powi(), which derivs() uses for them,
+// and the others BaseRegion::derivs_termwise().  The verification program compares every kernel
+// with the table-walking code when it is built with IF97_KERNELS.  The Backwards
+// T(p,h)/T(p,s)/p(h,s) tables, which the table-walking code evaluates with std::pow(), agree to
+// rounding.
+//
+// With --boundaries it instead tabulates the (p,X) and (h,s) boundary curves, BoundaryCurve::tabulate()
+// for every boundary_spec(), and rewrites the BoundaryTables block of the given IF97.h in place.  The
+// tables are in IAPWS units, so this program is built with IAPWS_UNITS (which the kernels do not use).
+// Curves that pass through Region 3 are tabulated with the iterated density solver, and each band is
+// widened by 16 times the largest difference, at the nodes around its interval, between those values
+// and the direct solver's, so that the tables hold whichever solver set_region3_solver() selects.
+//
+// Usage:  IF97_kernelgen [output file]      (writes to stdout when no file is given)
+//         IF97_kernelgen --boundaries IF97.h
+//
+#define IAPWS_UNITS
+#include "IF97.h"
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+    struct Term { double I, J, n; };
+
+    std::vector<Term> terms(const RegionResidualElement *d, std::size_t N){
+        std::vector<Term> t;
+        for (std::size_t i = 0; i < N; ++i){ Term e = {double(d[i].I), double(d[i].J), d[i].n}; t.push_back(e); }
+        return t;
+    }
+    std::vector<Term> terms(const RegionIdealElement *d, std::size_t N){
+        std::vector<Term> t;
+        for (std::size_t i = 0; i < N; ++i){ Term e = {0, double(d[i].J), d[i].n}; t.push_back(e); }
+        return t;
+    }
+    std::vector<Term> terms(const IF97::Backwards::BackwardRegionResidualElement *d, std::size_t N){
+        std::vector<Term> t;
+        for (std::size_t i = 0; i < N; ++i){ Term e = {d[i].I, d[i].J, d[i].n}; t.push_back(e); }
+        return t;
+    }
+
+    std::string num(double v){               // Round-trip exact literal
+        char buf[40];
+        snprintf(buf, sizeof(buf), "%.17g", v);
+        std::string s(buf);
+        if (s.find_first_of(".eEn") == std::string::npos) s += ".0";
+        return (v < 0) ? "(" + s + ")" : s;
+    }
+    std::string ifac(int k){ std::ostringstream o; if (k < 0) o << "(" << k << ")"; else o << k; return o.str(); }
+
+    // Powers of one kernel argument.  Integer exponents are emitted as a chain of const locals,
+    // x^k = x^(k-h)*x^h with h the largest power of two below k (the PowerLadder/powi() product);
+    // non-integer exponents get one std::pow() call each.
+    class Powers{
+    public:
+        explicit Powers(const std::string &var) : var(var){}
+        std::string operator()(double e){
+            if (e == int(e)){ need(int(e)); return name(int(e)); }
+            std::map<double, std::string>::iterator it = fracnames.find(e);
+            if (it != fracnames.end()) return it->second;
+            std::ostringstream o; o << var << "_f" << fracnames.size();
+            return fracnames[e] = o.str();
+        }
+        void emit(std::ostream &out) const{
+            std::vector<int> order(ints.begin(), ints.end());   // Each power after the two it is built from
+            std::stable_sort(order.begin(), order.end(), by_magnitude);
+            for (std::vector<int>::const_iterator it = order.begin(); it != order.end(); ++it){
+                const int k = *it, a = std::abs(k);
+                out << "        const double " << name(k) << " = ";
+                if (k == 0) out << "1.0";
+                else if (k == 1) out << var;
+                else if (k == -1) out << "1.0/" << var;
+                else {
+                    const int h = top(a), s = (k < 0) ? -1 : 1;
+                    out << name(s*(a - h)) << "*" << name(s*h);
+                }
+                out << ";\n";
+            }
+            for (std::map<double, std::string>::const_iterator it = fracnames.begin(); it != fracnames.end(); ++it)
+                out << "        const double " << it->second << " = std::pow(" << var << ", " << num(it->first) << ");\n";
+        }
+    private:
+        static bool by_magnitude(int a, int b){ return std::abs(a) < std::abs(b); }
+        static int top(int a){ int h = 1; while (2*h < a) h *= 2; return h; }
+        std::string name(int k) const{ std::ostringstream o; o << var << "_" << (k < 0 ? "m" : "") << std::abs(k); return o.str(); }
+        void need(int k){
+            if (ints.count(k)) return;
+            ints.insert(k);
+            const int a = std::abs(k), s = (k < 0) ? -1 : 1;
+            if (a >= 2){ const int h = top(a); need(s*(a - h)); need(s*h); }
+        }
+        std::string var;
+        std::set<int> ints;
+        std::map<double, std::string> fracnames;
+    };
+
+    void open_kernel(std::ostream &out, const std::string &name, const std::string &what){
+        out << "    // " << what << "\n";
+        out << "    inline void " << name << "(double x, double y, double out[]){\n";
+    }
+    void close_kernel(std::ostream &out, const Powers &X, const Powers &Y, const std::ostringstream &body){
+        X.emit(out);
+        Y.emit(out);
+        out << body.str() << "    }\n\n";
+    }
+
+    // Gibbs residual sums of Regions 1, 2 and 5: out[0..5] += gammar, d/dPI, d2/dPI2, d/dTAU,
+    // d2/dTAU2, d2/dPIdTAU at x = PI, y = TAU, as in BaseRegion::derivs_termwise(), or as in
+    // BaseRegion::derivs_powi() for a table below LADDER_MIN_TERMS.
+    void gibbs(std::ostream &out, const std::string &table, const std::vector<Term> &t){
+        Powers X("x"), Y("y");
+        std::ostringstream b;
+        const bool ladders = t.size() >= IF97::LADDER_MIN_TERMS;
+        b << "        double g = out[0], g_p = out[1], g_pp = out[2], g_t = out[3], g_tt = out[4], g_pt = out[5];\n";
+        for (std::size_t i = 0; i < t.size(); ++i){
+            const int I = int(t[i].I), J = int(t[i].J);
+            const std::string n = num(t[i].n);
+            if (!ladders){
+                // derivs_powi(): x^(I-2) and y^(J-2) from powi(), the higher powers multiplied up from them
+                b << "        { const double PIm2 = " << X(I-2) << ", PIm1 = PIm2*x, TAUm2 = " << Y(J-2) << ", TAUm1 = TAUm2*y;\n";
+                b << "          const double nPI = " << n << "*PIm1*x;";
+                if (I != 0) b << " const double nIPIm1 = " << n << "*" << ifac(I) << "*PIm1;";
+                b << "\n          g += nPI*TAUm1*y;";
+                if (I != 0) b << " g_p += nIPIm1*TAUm1*y;";
+                if (I != 0 && I != 1) b << " g_pp += " << n << "*" << ifac(I) << "*" << ifac(I-1) << "*PIm2*TAUm1*y;";
+                if (J != 0) b << " g_t += nPI*" << ifac(J) << "*TAUm1;";
+                if (J != 0 && J != 1) b << " g_tt += nPI*" << ifac(J) << "*" << ifac(J-1) << "*TAUm2;";
+                if (I != 0 && J != 0) b << " g_pt += nIPIm1*" << ifac(J) << "*TAUm1;";
+                b << " }\n";
+                continue;
+            }
+            b << "        { const double nPI = " << n << "*" << X(I) << ";";
+            if (I != 0) b << " const double nIPIm1 = " << n << "*" << ifac(I) << "*" << X(I-1) << ";";
+            b << "\n          g += nPI*" << Y(J) << ";";
+            if (I != 0) b << " g_p += nIPIm1*" << Y(J) << ";";
+            if (I != 0 && I != 1) b << " g_pp += " << n << "*" << ifac(I) << "*" << ifac(I-1) << "*" << X(I-2) << "*" << Y(J) << ";";
+            if (J != 0) b << " g_t += nPI*" << ifac(J) << "*" << Y(J-1) << ";";
+            if (J != 0 && J != 1) b << " g_tt += nPI*" << ifac(J) << "*" << ifac(J-1) << "*" << Y(J-2) << ";";
+            if (I != 0 && J != 0) b << " g_pt += nIPIm1*" << ifac(J) << "*" << Y(J-1) << ";";
+            b << " }\n";
+        }
+        b << "        out[0] = g; out[1] = g_p; out[2] = g_pp; out[3] = g_t; out[4] = g_tt; out[5] = g_pt;\n";
+        open_kernel(out, table, table + ": Gibbs residual sums, x = PI, y = TAU");
+        close_kernel(out, X, Y, b);
+    }
+
+    // Gibbs ideal-gas sums of Regions 2 and 5: out[0..2] += gamma0 (less ln PI), d/dTAU, d2/dTAU2
+    // at x = TAU0; y is unused.  Formed as in BaseRegion::ideal_derivs() when the region's residual
+    // table takes the ladders, else as in BaseRegion::derivs_powi().
+    void ideal(std::ostream &out, const std::string &table, const std::vector<Term> &t, bool ladders){
+        Powers X("x"), Y("y");
+        std::ostringstream b;
+        b << "        double g0 = out[0], g0_t = out[1], g0_tt = out[2];\n";
+        for (std::size_t i = 0; i < t.size(); ++i){
+            const int J = int(t[i].J);
+            const std::string n = num(t[i].n);
+            if (!ladders){
+                b << "        { const double nTAUm2 = " << n << "*" << X(J-2) << ", nTAUm1 = nTAUm2*x; g0 += nTAUm1*x;";
+                if (J != 0) b << " g0_t += nTAUm1*" << ifac(J) << ";";
+                if (J != 0 && J != 1) b << " g0_tt += nTAUm2*" << ifac(J) << "*" << ifac(J-1) << ";";
+                b << " }\n";
+                continue;
+            }
+            b << "        g0 += " << n << "*" << X(J) << ";";
+            if (J != 0) b << " g0_t += " << n << "*" << ifac(J) << "*" << X(J-1) << ";";
+            if (J != 0 && J != 1) b << " g0_tt += " << n << "*" << ifac(J) << "*" << ifac(J-1) << "*" << X(J-2) << ";";
+            b << "\n";
+        }
+        b << "        out[0] = g0; out[1] = g0_t; out[2] = g0_tt;\n";
+        open_kernel(out, table, table + ": Gibbs ideal-gas sums, x = TAU0");
+        out << "        (void)y;\n";
+        close_kernel(out, X, Y, b);
+    }
+
+    // Coefficient factor of one Region 3 term in the sum of the given Region3 member function, and
+    // its delta exponent offset; the factor is empty when it is zero.  The factors follow the member
+    // functions exactly so that the constants fold to the same doubles.
+    std::string helmholtz_factor(int part, const Term &t, int &dI){
+        const int I = int(t.I), J = int(t.J);
+        const std::string n = num(t.n);
+        std::string f;
+        dI = 0;
+        switch (part){
+            case 0: f = n; break;
+            case 1: if (I) f = n + "*" + ifac(I); dI = -1; break;
+            case 2: if (I && I != 1) f = n + "*" + ifac(I) + "*" + num(I - 1.0); dI = -2; break;
+            case 3: if (I) f = n + "*" + ifac(I); break;
+            case 4: if (J) f = n + "*" + ifac(J); break;
+            case 5: if (I && I != 1) f = n + "*" + ifac(I) + "*" + ifac(I-1); break;
+            case 6: if (J && J != 1) f = n + "*" + ifac(J) + "*" + ifac(J-1); break;
+            case 7: if (I && J) f = n + "*" + ifac(J) + "*" + ifac(I); break;
+            case 8: if (I && I != 1 && I != 2) f = n + "*" + ifac(I) + "*" + num(I - 1.0) + "*" + num(I - 2.0); dI = -3; break;
+        }
+        return f;
+    }
+
+    // Several Region 3 Helmholtz sums in one sweep over terms 1..39, out[k] += sum for part[k].
+    void fused(std::ostream &out, const std::string &name, const std::string &comment, const std::vector<Term> &t,
+               const int *part, int N){
+        Powers X("x"), Y("y");
+        std::ostringstream b;
+        b << "        double";
+        for (int k = 0; k < N; ++k) b << (k ? ", " : " ") << "s" << k << " = out[" << k << "]";
+        b << ";\n";
+        for (std::size_t i = 1; i < t.size(); ++i){
+            b << "       ";
+            for (int k = 0; k < N; ++k){
+                int dI;
+                const std::string f = helmholtz_factor(part[k], t[i], dI);
+                if (!f.empty()) b << " s" << k << " += " << f << "*" << X(int(t[i].I) + dI) << "*" << Y(int(t[i].J)) << ";";
+            }
+            b << "\n";
+        }
+        b << "       ";
+        for (int k = 0; k < N; ++k) b << " out[" << k << "] = s" << k << ";";
+        b << "\n";
+        open_kernel(out, name, comment);
+        close_kernel(out, X, Y, b);
+    }
+
+    // Region 3 Helmholtz sums over terms 1..39 (the ln(delta) term is left to the caller), one kernel
+    // per Region3 member function, out[0] += sum at x = delta, y = tau, and one kernel for the whole
+    // Region3::derivs() bundle, out[0..5] += phi, delta*dphi/ddelta, delta^2*d2phi/ddelta2,
+    // tau*dphi/dtau, tau^2*d2phi/dtau2, delta*tau*d2phi/ddelta/dtau, and one for the density
+    // solver, out[0..2] += dphi/ddelta, d2phi/ddelta2, d3phi/ddelta3.
+    void helmholtz(std::ostream &out, const std::string &table, const std::vector<Term> &t){
+        static const char *parts[] = {"phi", "dphi_ddelta", "d2phi_ddelta2", "delta_dphi_ddelta", "tau_dphi_dtau",
+                                      "delta2_d2phi_ddelta2", "tau2_d2phi_dtau2", "deltatau_d2phi_ddelta_dtau"};
+        for (int part = 0; part < 8; ++part){
+            Powers X("x"), Y("y");
+            std::ostringstream b;
+            b << "        double summer = out[0];\n";
+            for (std::size_t i = 1; i < t.size(); ++i){
+                int dI;
+                const std::string f = helmholtz_factor(part, t[i], dI);
+                if (!f.empty()) b << "        summer += " << f << "*" << X(int(t[i].I) + dI) << "*" << Y(int(t[i].J)) << ";\n";
+            }
+            b << "        out[0] = summer;\n";
+            const std::string name = table + "_" + parts[part];
+            open_kernel(out, name, table + ": Region3::" + parts[part] + "() sum, x = delta, y = tau");
+            close_kernel(out, X, Y, b);
+        }
+        static const int bundle[] = {0, 3, 5, 4, 6, 7};   // HelmholtzDerivatives member order
+        fused(out, table + "_derivs", table + ": Region3::derivs() bundle, x = delta, y = tau", t, bundle, 6);
+        static const int ddelta[] = {1, 2, 8};             // dphi/ddelta, d2phi/ddelta2, d3phi/ddelta3
+        fused(out, table + "_ddelta", table + ": Region3::ddelta_derivs() sums, x = delta, y = tau", t, ddelta, 3);
+    }
+
+    // Plain double sums of the backward equations: out[0] += sum n*x^I*y^J, the base values being
+    // formed by the caller (Region3BackwardsRegion::v, Backwards::BackwardsRegion).
+    void plain(std::ostream &out, const std::string &table, const std::vector<Term> &t){
+        Powers X("x"), Y("y");
+        std::ostringstream b;
+        b << "        double summer = out[0];\n";
+        for (std::size_t i = 0; i < t.size(); ++i)
+            b << "        summer += " << num(t[i].n) << "*" << X(t[i].I) << "*" << Y(t[i].J) << ";\n";
+        b << "        out[0] = summer;\n";
+        open_kernel(out, table, table + ": sum of n*x^I*y^J");
+        close_kernel(out, X, Y, b);
+    }
+
+    // The BoundaryTables block of IF97.h, BEGIN and END lines included.  Nodes are written with 17
+    // significant digits, so they read back exactly; bands with 3, rounded up.
+    std::string band_literal(double v){
+        if (v == std::numeric_limits<double>::infinity()) return "std::numeric_limits<double>::infinity()";
+        char buf[40];
+        for (double w = v; ; w *= 1.001){
+            snprintf(buf, sizeof(buf), "%.2e", w);
+            if (strtod(buf, 0) >= v) return buf;
+        }
+    }
+    std::string boundary_tables(){
+        const int N = IF97::BoundaryCurve::N;
+        std::vector<double> u0(IF97::BC_COUNT), du(IF97::BC_COUNT);
+        std::vector<std::vector<double> > y(IF97::BC_COUNT, std::vector<double>(N + 1)), band(IF97::BC_COUNT, std::vector<double>(N));
+        std::vector<double> y_direct(N + 1), band_direct(N);
+        for (int id = 0; id < IF97::BC_COUNT; ++id){
+            const IF97::BoundarySpec b = IF97::boundary_spec(id);
+            double u, d;
+            IF97::set_region3_solver(IF97::R3_DIRECT);
+            IF97::BoundaryCurve::tabulate(b.exact, b.key, b.lo, b.hi, b.singular_hi, b.log_axis, u, d, &y_direct[0], &band_direct[0]);
+            IF97::set_region3_solver(IF97::R3_NEWTON, 1.0E-9, 100);
+            IF97::BoundaryCurve::tabulate(b.exact, b.key, b.lo, b.hi, b.singular_hi, b.log_axis, u0[id], du[id], &y[id][0], &band[id][0]);
+            for (int k = 0; k < N; ++k){
+                double spread = 0;
+                for (int j = std::max(k - 1, 0); j <= std::min(k + 2, N); ++j) spread = std::max(spread, std::abs(y_direct[j] - y[id][j]));
+                band[id][k] += 16*spread;
+            }
+        }
+        std::ostringstream out;
+        char buf[40];
+        out << "    // BEGIN BoundaryTables -- written by IF97_kernelgen --boundaries; do not edit\n";
+        out << "    template<class Unused = void> struct BoundaryTables\n    {\n";
+        const char *axes[2] = {"u0", "du"};
+        for (int a = 0; a < 2; ++a){
+            out << "        static constexpr double " << axes[a] << "[BC_COUNT] = {";
+            for (int id = 0; id < IF97::BC_COUNT; ++id){
+                snprintf(buf, sizeof(buf), "% .16e", a ? du[id] : u0[id]);
+                out << ((id % 4) ? " " : "\n            ") << buf << ",";
+            }
+            out << "\n        };\n";
+        }
+        out << "        alignas(64) static constexpr double y[BC_COUNT][BOUNDARY_INTERVALS + 1] = {\n";
+        for (int id = 0; id < IF97::BC_COUNT; ++id){
+            out << "            {   // " << IF97::boundary_spec(id).name;
+            for (int k = 0; k <= N; ++k){
+                snprintf(buf, sizeof(buf), "% .16e", y[id][k]);
+                out << ((k % 4) ? " " : "\n                ") << buf << ",";
+            }
+            out << "\n            },\n";
+        }
+        out << "        };\n";
+        out << "        alignas(64) static constexpr double band[BC_COUNT][BOUNDARY_INTERVALS] = {\n";
+        for (int id = 0; id < IF97::BC_COUNT; ++id){
+            out << "            {   // " << IF97::boundary_spec(id).name;
+            for (int k = 0; k < N; ++k)
+                out << ((k % 8) ? " " : "\n                ") << band_literal(band[id][k]) << ",";
+            out << "\n            },\n";
+        }
+        out << "        };\n    };\n    // END BoundaryTables\n";
+        return out.str();
+    }
+
+    // Replaces the BoundaryTables block of the header at path with boundary_tables().
+    int write_boundaries(const char *path){
+        FILE *f = fopen(path, "rb");
+        if (!f){ fprintf(stderr, "IF97_kernelgen: cannot open %s\n", path); return 1; }
+        std::string text;
+        char buf[4096];
+        for (std::size_t n; (n = fread(buf, 1, sizeof(buf), f)) > 0; ) text.append(buf, n);
+        fclose(f);
+        std::size_t begin = text.find("// BEGIN BoundaryTables"), end = text.find("// END BoundaryTables");
+        if ((begin == std::string::npos) || (end == std::string::npos) || (end < begin)){
+            fprintf(stderr, "IF97_kernelgen: no BoundaryTables block in %s\n", path);
+            return 1;
+        }
+        begin = text.rfind('\n', begin) + 1;                        // Whole lines, indentation included
+        end = text.find('\n', end) + 1;
+        text.replace(begin, end - begin, boundary_tables());
+        f = fopen(path, "wb");
+        if (!f){ fprintf(stderr, "IF97_kernelgen: cannot open %s for writing\n", path); return 1; }
+        fputs(text.c_str(), f);
+        fclose(f);
+        return 0;
+    }
+
+}
+
+#define N_OF(a) (sizeof(a)/sizeof((a)[0]))
+#define R3B(t) plain(out, #t, terms(IF97::Region3Backwards::t, N_OF(IF97::Region3Backwards::t)))
+#define BWD(t) plain(out, #t, terms(IF97::Backwards::t, N_OF(IF97::Backwards::t)))
+
+int main(int argc, char *argv[]){
+    if ((argc > 1) && (std::string(argv[1]) == "--boundaries")){
+        if (argc < 3){ fprintf(stderr, "usage: IF97_kernelgen --boundaries IF97.h\n"); return 1; }
+        return write_boundaries(argv[2]);
+    }
+    std::ostringstream out;
+    out << "// IF97_kernels.h -- generated by IF97_kernelgen from the coefficient tables of IF97.h " << IF97::IF97VERSION << ".\n";
+    out << "// Do not edit; regenerate whenever a table in IF97.h changes.  Included by IF97.h when IF97_KERNELS is defined.\n";
+    out << "#ifndef IF97_KERNELS_H\n#define IF97_KERNELS_H\n\nnamespace IF97 {\nnamespace kernels {\n\n";
+
+    gibbs(out, "Region1residdata", terms(IF97::Region1residdata, N_OF(IF97::Region1residdata)));
+    gibbs(out, "Region2residdata", terms(IF97::Region2residdata, N_OF(IF97::Region2residdata)));
+    ideal(out, "Region2idealdata", terms(IF97::Region2idealdata, N_OF(IF97::Region2idealdata)),
+          N_OF(IF97::Region2residdata) >= IF97::LADDER_MIN_TERMS);
+    gibbs(out, "Region5residdata", terms(IF97::Region5residdata, N_OF(IF97::Region5residdata)));
+    ideal(out, "Region5idealdata", terms(IF97::Region5idealdata, N_OF(IF97::Region5idealdata)),
+          N_OF(IF97::Region5residdata) >= IF97::LADDER_MIN_TERMS);
+    helmholtz(out, "Region3residdata", terms(IF97::Region3residdata, N_OF(IF97::Region3residdata)));
+
+    R3B(Region3Adata); R3B(Region3Bdata); R3B(Region3Cdata); R3B(Region3Ddata); R3B(Region3Edata); R3B(Region3Fdata);
+    R3B(Region3Gdata); R3B(Region3Hdata); R3B(Region3Idata); R3B(Region3Jdata); R3B(Region3Kdata); R3B(Region3Ldata);
+    R3B(Region3Mdata); R3B(Region3Ndata); R3B(Region3Odata); R3B(Region3Pdata); R3B(Region3Qdata); R3B(Region3Rdata);
+    R3B(Region3Sdata); R3B(Region3Tdata); R3B(Region3Udata); R3B(Region3Vdata); R3B(Region3Wdata); R3B(Region3Xdata);
+    R3B(Region3Ydata); R3B(Region3Zdata);
+
+    BWD(Coeff1H);   BWD(Coeff1S);   BWD(Coeff1HS);
+    BWD(Coeff2aH);  BWD(Coeff2bH);  BWD(Coeff2cH);  BWD(Coeff2aS);  BWD(Coeff2bS);  BWD(Coeff2cS);
+    BWD(Coeff2aHS); BWD(Coeff2bHS); BWD(Coeff2cHS);
+    BWD(Coeff3aH);  BWD(Coeff3bH);  BWD(Coeff3aS);  BWD(Coeff3bS);  BWD(Coeff3aHS); BWD(Coeff3bHS);
+    BWD(Coeffb14HS); BWD(Coeffb3a4HS); BWD(Coeffb2abHS); BWD(Coeffb2c3bHS); BWD(Coeffb13HS);
+    BWD(CoeffTb23HS); BWD(CoeffT4HS);
+
+    out << "}  // namespace kernels\n}  // namespace IF97\n\n#endif\n";
+
+    if (argc > 1){
+        FILE *f = fopen(argv[1], "w");
+        if (!f){ fprintf(stderr, "IF97_kernelgen: cannot open %s for writing\n", argv[1]); return 1; }
+        fputs(out.str().c_str(), f);
+        fclose(f);
+    }
+    else fputs(out.str().c_str(), stdout);
+    return 0;
+}